@@ -35,4 +35,10 @@ target("ImGui")
         add_linkdirs(os.getenv("VULKAN_SDK") .. "/Lib")
         add_syslinks("vulkan-1")
         remove_files("ImGui/imgui_impl_dx12.cpp", "ImGui/imgui_impl_dx12.h")
+    elseif get_config("rhi") == "null" then
+        remove_files("ImGui/imgui_impl_dx12.cpp", "ImGui/imgui_impl_dx12.h")
+    end
+
+    if not is_plat("windows") then
+        remove_files("ImGui/imgui_impl_win32.cpp", "ImGui/imgui_impl_win32.h", "ImGui/imgui_impl_dx11.cpp", "ImGui/imgui_impl_dx11.h")
     end
@@ -0,0 +1,62 @@
+/**
+ *  Author: Amélie Heinrich
+ *  Company: Amélie Games
+ *  License: MIT
+ *  Create Time: 17/10/2026 17:40
+ */
+
+// NOTE(amelie.h): Shared by the Packed and Quantized vertex formats. The input assembler expands the snorm/unorm/half
+// attributes to floats, the instance transforms already contain the mesh PositionOffset/PositionScale.
+struct VertexIn
+{
+    float3 Position : POSITION;
+    float2 Normal : NORMAL;
+    float2 TextureCoords: TEXCOORD;
+};
+
+struct VertexOut
+{
+    float4 Position : SV_POSITION;
+    float3 Normal : NORMAL;
+    float2 TextureCoords: TEXCOORD;
+};
+
+struct SceneData
+{
+    row_major float4x4 View;
+    row_major float4x4 Projection;
+};
+
+struct DrawData
+{
+    uint InstanceOffset;
+};
+
+struct InstanceData
+{
+    row_major float4x4 Transform;
+};
+
+ConstantBuffer<SceneData> SceneBuffer : register(b0);
+ConstantBuffer<DrawData> DrawBuffer : register(b0, space1);
+StructuredBuffer<InstanceData> Instances : register(t4);
+
+float3 DecodeOctahedral(float2 Encoded)
+{
+    float3 Normal = float3(Encoded.xy, 1.0f - abs(Encoded.x) - abs(Encoded.y));
+    float Fold = saturate(-Normal.z);
+    Normal.xy += Normal.xy >= 0.0f ? -Fold : Fold;
+    return normalize(Normal);
+}
+
+VertexOut VSMain(VertexIn Input, uint InstanceID : SV_InstanceID)
+{
+    float4x4 Transform = Instances[DrawBuffer.InstanceOffset + InstanceID].Transform;
+    VertexOut Output = (VertexOut)0;
+    Output.Position = mul(float4(Input.Position, 1.0f), Transform);
+    Output.Position = mul(Output.Position, SceneBuffer.View);
+    Output.Position = mul(Output.Position, SceneBuffer.Projection);
+    Output.Normal = DecodeOctahedral(Input.Normal);
+    Output.TextureCoords = Input.TextureCoords;
+    return Output;
+}
@@ -23,15 +23,27 @@ struct SceneData
 {
     row_major float4x4 View;
     row_major float4x4 Projection;
+};
+
+struct DrawData
+{
+    uint InstanceOffset;
+};
+
+struct InstanceData
+{
     row_major float4x4 Transform;
 };
 
 ConstantBuffer<SceneData> SceneBuffer : register(b0);
+ConstantBuffer<DrawData> DrawBuffer : register(b0, space1);
+StructuredBuffer<InstanceData> Instances : register(t4);
 
-VertexOut VSMain(VertexIn Input)
+VertexOut VSMain(VertexIn Input, uint InstanceID : SV_InstanceID)
 {
+    float4x4 Transform = Instances[DrawBuffer.InstanceOffset + InstanceID].Transform;
     VertexOut Output = (VertexOut)0;
-    Output.Position = mul(float4(Input.Position, 1.0f), SceneBuffer.Transform);
+    Output.Position = mul(float4(Input.Position, 1.0f), Transform);
     Output.Position = mul(Output.Position, SceneBuffer.View);
     Output.Position = mul(Output.Position, SceneBuffer.Projection);
     Output.Normal = Input.Normal;
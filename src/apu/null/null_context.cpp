@@ -0,0 +1,20 @@
+/**
+ *  Author: Amélie Heinrich
+ *  Company: Amélie Games
+ *  License: MIT
+ *  Create Time: 17/10/2026 11:20
+ */
+
+#include "apu/apu_context.hpp"
+
+#include "systems/log_system.hpp"
+
+void ApuInit()
+{
+    LogInfo("Null APU: Audio output is disabled");
+}
+
+void ApuExit()
+{
+
+}
@@ -0,0 +1,88 @@
+/**
+ *  Author: Amélie Heinrich
+ *  Company: Amélie Games
+ *  License: MIT
+ *  Create Time: 17/10/2026 11:22
+ */
+
+#include "apu/apu_source.hpp"
+
+#include "systems/log_system.hpp"
+
+#include <cstdlib>
+#include <dr_libs/dr_wav.h>
+
+// NOTE(amelie.h): Sources are decoded like on the real backends so load times stay comparable, then discarded.
+
+void ApuSourceInitPCM(apu_source *Source, int SampleRate, int Channels, int SampleCount, short *Samples, bool Loop)
+{
+    Source->Handle = nullptr;
+    Source->Samples = nullptr;
+    Source->SampleRate = SampleRate;
+    Source->SampleCount = SampleCount;
+    Source->Channels = Channels;
+    Source->Looping = Loop;
+    Source->Paused = false;
+    Source->PauseCursor = 0;
+    Source->Type = apu_source_type::Music;
+
+    free(Samples);
+}
+
+void ApuSourceInitFile(apu_source *Source, const char *File, bool Loop)
+{
+    drwav Wave;
+    if (!drwav_init_file(&Wave, File, nullptr))
+    {
+        LogError("Failed to open sound file %s!", File);
+        ApuSourceInitPCM(Source, 0, 0, 0, nullptr, Loop);
+        return;
+    }
+
+    int SampleRate = Wave.sampleRate;
+    int SampleCount = Wave.totalPCMFrameCount;
+    int Channels = Wave.channels;
+    short *Samples = reinterpret_cast<short*>(malloc(SampleCount * sizeof(short) * Wave.channels));
+
+    int ReadSamples = drwav_read_pcm_frames_s16(&Wave, SampleCount, Samples);
+    if (ReadSamples != SampleCount)
+        LogWarn(".wav loader loaded %d/%d PCM frames!", ReadSamples, SampleCount);
+    ApuSourceInitPCM(Source, SampleRate, Channels, SampleCount, Samples, Loop);
+
+    drwav_uninit(&Wave);
+}
+
+void ApuSourceFree(apu_source *)
+{
+
+}
+
+void ApuSourcePlay(apu_source *)
+{
+
+}
+
+void ApuSourceStop(apu_source *)
+{
+
+}
+
+void ApuSourceUpdate(apu_source *)
+{
+
+}
+
+void ApuSourcePause(apu_source *Source)
+{
+    Source->Paused = !Source->Paused;
+}
+
+void ApuSourceSetLoop(apu_source *Source, bool Loop)
+{
+    Source->Looping = Loop;
+}
+
+void ApuSourceSetType(apu_source *Source, apu_source_type Type)
+{
+    Source->Type = Type;
+}
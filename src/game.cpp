@@ -15,13 +15,18 @@
 #include "gui/gui.hpp"
 #include "gui/settings_panel.hpp"
 #include "renderer/renderer.hpp"
+#include "game_data.hpp"
 #include "systems/event_system.hpp"
 #include "systems/input_system.hpp"
 #include "systems/shader_system.hpp"
 #include "systems/log_system.hpp"
 
 #include <ImGui/imgui.h>
-#include <chrono>
+#include <cstring>
+
+#define FRAME_STATS_WINDOW 512
+#define GAME_HELMET_SPACING 3.0f
+#define GAME_PICK_DISTANCE 10000.0f // NOTE(amelie.h): The camera's far plane.
 
 struct game_state
 {
@@ -31,9 +36,16 @@ struct game_state
     bool SettingsFocus;
 
     timer Timer;
-    float LastFrame;
+    uint64_t LastFrame;
+    frame_stats FrameStats;
     noclip_camera Camera;
 
+    // NOTE(amelie.h): Every entity points at the same helmet, the renderer collapses them into instanced draws. Visible
+    // is what the scene BVH kept this frame.
+    loaded_model Helmet;
+    game_scene Scene;
+    std::vector<uint32_t> Visible;
+
     apu_source Source;
 };
 
@@ -65,6 +77,35 @@ bool GameResize(event_type Type, void *Sender, void *Listener, event_data Data)
     return false;
 }
 
+// NOTE(amelie.h): scene_grid helmets per side, in rows going away from the camera with the first row centered on the origin.
+void GameSpawnEntities()
+{
+    int32_t Grid = HMM_MAX(EgcI32(EgcFile, "scene_grid"), 1);
+    ModelLoad(&GameState.Helmet, "assets/models/SciFiHelmet.gltf");
+
+    SceneInit(&GameState.Scene);
+    for (int32_t Row = 0; Row < Grid; Row++)
+    {
+        for (int32_t Column = 0; Column < Grid; Column++)
+        {
+            transform Transform = {};
+            Transform.Position = HMM_Vec3((Column - (Grid - 1) / 2) * GAME_HELMET_SPACING, 0.0f, -Row * GAME_HELMET_SPACING);
+            Transform.Scale = HMM_Vec3(1.0f, 1.0f, 1.0f);
+            SceneAddEntity(&GameState.Scene, &GameState.Helmet, Transform);
+        }
+    }
+}
+
+camera_data GameGetCameraData()
+{
+    camera_data Data;
+    Data.View = GameState.Camera.View;
+    Data.Projection = GameState.Camera.Projection;
+    Data.Position = GameState.Camera.Position;
+    memcpy(Data.Planes, GameState.Camera.Planes, sizeof(Data.Planes));
+    return Data;
+}
+
 void GameInit()
 {
     GameState.TerminalOpen = false;
@@ -74,8 +115,34 @@ void GameInit()
     EventSystemRegister(event_type::Resize, nullptr, GameResize);
     DevTerminalInit();
 
+    DevTerminalAddCommand("frame_stats", [](const std::vector<std::string>&) {
+        frame_stats_summary Summary = FrameStatsSummarize(&GameState.FrameStats);
+        LogInfo("Frame stats over %u frames: min %.3fms, avg %.3fms, max %.3fms, p99 %.3fms (%.1f FPS)",
+                Summary.Samples, Summary.Min, Summary.Average, Summary.Max, Summary.P99,
+                Summary.Average > 0.0f ? 1000.0f / Summary.Average : 0.0f);
+
+        gpu_frame_metrics Metrics = GpuGetFrameMetrics();
+        LogInfo("GPU pacing: %u frames in flight, CPU wait %.3fms, frame latency %.3fms",
+                Metrics.FramesInFlight, Metrics.CpuWaitMs, Metrics.FrameLatencyMs);
+    });
+
+    DevTerminalAddCommand("pick_entity", [](const std::vector<std::string>&) {
+        bvh_ray_hit Hit = ScenePick(&GameState.Scene, GameState.Camera.Position, GameState.Camera.Front, GAME_PICK_DISTANCE);
+        if (Hit.Hit)
+            LogInfo("Scene: Entity %u is %.2f units in front of the camera", Hit.UserData, Hit.Distance);
+        else
+            LogInfo("Scene: No entity in front of the camera");
+    });
+    DevTerminalAddCommand("validate_scene", [](const std::vector<std::string>&) {
+        camera_data Data = GameGetCameraData();
+        DevTerminalReportFailures("validate_scene", SceneValidate(&GameState.Scene, &Data));
+    });
+
     RendererInit();
+    GameSpawnEntities();
     TimerInit(&GameState.Timer);
+    GameState.LastFrame = 0;
+    FrameStatsInit(&GameState.FrameStats, FRAME_STATS_WINDOW);
     NoClipCameraInit(&GameState.Camera);
 
     ApuSourceInitFile(&GameState.Source, "assets/bgm/TITLE.wav", true);
@@ -85,9 +152,10 @@ void GameInit()
 
 void GameUpdate()
 {
-    float Time = TimerGetElapsed(&GameState.Timer);
-    float DT = (Time - GameState.LastFrame) / 1000.0f;
+    uint64_t Time = TimerGetElapsedNanoseconds(&GameState.Timer);
+    float DT = (float)((Time - GameState.LastFrame) / 1'000'000'000.0);
     GameState.LastFrame = Time;
+    FrameStatsPush(&GameState.FrameStats, DT * 1000.0f);
 
     ApuSourceUpdate(&GameState.Source);
 
@@ -96,13 +164,13 @@ void GameUpdate()
     NoClipCameraUpdate(&GameState.Camera, DT);
     NoClipCameraUpdateFrustum(&GameState.Camera);
 
-    camera_data Data;
-    Data.View = GameState.Camera.View;
-    Data.Projection = GameState.Camera.Projection;
-    Data.Position = GameState.Camera.Position;
+    camera_data Data = GameGetCameraData();
 
     RendererStartSync();
 
+    SceneQueryFrustum(&GameState.Scene, Data.Planes, GameState.Visible);
+    for (uint32_t Entity : GameState.Visible)
+        RendererDrawEntity(&GameState.Scene.Entities[Entity]);
     RendererConstructFrame(&Data);
     
     RendererStartRender();
@@ -120,9 +188,17 @@ void GameUpdate()
     RendererEndSync();
 }
 
+frame_stats* GameGetFrameStats()
+{
+    return &GameState.FrameStats;
+}
+
 void GameExit()
 {
     ApuSourceFree(&GameState.Source);
     DevTerminalShutdown();
+    GpuWait();
+    SceneFree(&GameState.Scene);
+    ModelFree(&GameState.Helmet);
     RendererExit();
 }
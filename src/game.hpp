@@ -7,6 +7,9 @@
 
 #pragma once
 
+#include "timer.hpp"
+
 void GameInit();
 void GameUpdate();
 void GameExit();
+frame_stats* GameGetFrameStats();
@@ -19,7 +19,7 @@ void GpuBufferInit(gpu_buffer *Buffer, uint64_t Size, uint64_t Stride, gpu_buffe
     Buffer->Reserved = (void*)(new dx12_buffer);
 
     dx12_buffer *Private = (dx12_buffer*)Buffer->Reserved;
-    Private->HeapIndex = -1;
+    Private->HeapIndex = GPU_DESCRIPTOR_INVALID;
 
     D3D12MA::ALLOCATION_DESC AllocDesc = {};
     AllocDesc.HeapType = Type == gpu_buffer_type::Uniform ? D3D12_HEAP_TYPE_UPLOAD : D3D12_HEAP_TYPE_DEFAULT;
@@ -51,7 +51,9 @@ void GpuBufferInit(gpu_buffer *Buffer, uint64_t Size, uint64_t Stride, gpu_buffe
         case gpu_buffer_type::Index: {
             Private->IndexView.BufferLocation = Private->Resource->GetGPUVirtualAddress();
             Private->IndexView.SizeInBytes = Size;
-            Private->IndexView.Format = DXGI_FORMAT_R32_UINT;
+            Private->IndexView.Format = Stride == sizeof(uint16_t) ? DXGI_FORMAT_R16_UINT : DXGI_FORMAT_R32_UINT;
+            if (Stride != sizeof(uint16_t) && Stride != sizeof(uint32_t))
+                LogError("D3D12: Index buffer stride must be 2 or 4 bytes, got %llu!", Stride);
         } break;
         case gpu_buffer_type::Uniform: {
             Private->ConstantDesc.BufferLocation = Private->Resource->GetGPUVirtualAddress();
@@ -71,7 +73,7 @@ void GpuBufferInitForCopy(gpu_buffer *Buffer, uint64_t Size)
     Buffer->Reserved = (void*)(new dx12_buffer);
 
     dx12_buffer *Private = (dx12_buffer*)Buffer->Reserved;
-    Private->HeapIndex = -1;
+    Private->HeapIndex = GPU_DESCRIPTOR_INVALID;
 
     D3D12MA::ALLOCATION_DESC AllocDesc = {};
     AllocDesc.HeapType = D3D12_HEAP_TYPE_READBACK;
@@ -101,7 +103,7 @@ void GpuBufferInitForUpload(gpu_buffer *Buffer, uint64_t Size)
     Buffer->Reserved = (void*)(new dx12_buffer);
 
     dx12_buffer *Private = (dx12_buffer*)Buffer->Reserved;
-    Private->HeapIndex = -1;
+    Private->HeapIndex = GPU_DESCRIPTOR_INVALID;
 
     D3D12MA::ALLOCATION_DESC AllocDesc = {};
     AllocDesc.HeapType = D3D12_HEAP_TYPE_UPLOAD;
@@ -128,7 +130,7 @@ void GpuBufferFree(gpu_buffer *Buffer)
 {
     dx12_buffer *Private = (dx12_buffer*)Buffer->Reserved;
 
-    if (Private->HeapIndex != -1)
+    if (Private->HeapIndex != GPU_DESCRIPTOR_INVALID)
         Dx12DescriptorHeapFreeSpace(&DX12.CBVSRVUAVHeap, Private->HeapIndex);
     SafeRelease(Private->Resource);
     delete Private;
@@ -149,27 +151,8 @@ void GpuBufferUpload(gpu_buffer *Buffer, const void *Data, uint64_t Size)
     }
     else
     {
-        gpu_buffer Temp;
-        GpuBufferInitForUpload(&Temp, Size);
-
-        dx12_buffer *TempPrivate = (dx12_buffer*)Temp.Reserved;
-        void *Pointer;
-        HRESULT Result = TempPrivate->Resource->Map(0, nullptr, &Pointer);
-        if (FAILED(Result))
-            LogError("D3D12: Failed to map buffer in range (0, %d)", Size);
-        memcpy(Pointer, Data, Size);
-        TempPrivate->Resource->Unmap(0, nullptr);
-    
-        gpu_command_buffer Command;
-        GpuCommandBufferInit(&Command, gpu_command_buffer_type::Graphics);
-        GpuCommandBufferBegin(&Command);
-        GpuCommandBufferBufferBarrier(&Command, &Temp, gpu_buffer_layout::ImageLayoutCommon, gpu_buffer_layout::ImageLayoutCopySource);
-        GpuCommandBufferBufferBarrier(&Command, Buffer, gpu_buffer_layout::ImageLayoutCommon, gpu_buffer_layout::ImageLayoutCopyDest);
-        GpuCommandBufferCopyBufferToBuffer(&Command, &Temp, Buffer);
-        GpuCommandBufferBufferBarrier(&Command, Buffer, gpu_buffer_layout::ImageLayoutCopyDest, gpu_buffer_layout::ImageLayoutGenericRead);
-        GpuCommandBufferEnd(&Command);
-        GpuCommandBufferFlush(&Command);
-        
-        GpuBufferFree(&Temp);
+        // NOTE(amelie.h): The copy is batched on the upload queue. Buffers decay back to COMMON once the copy queue is done
+        // with them and get promoted implicitly on first use, so no barriers are needed on either side.
+        Dx12UploaderBuffer(&DX12.Uploader, Private->Resource, 0, Data, Size);
     }
 }
@@ -8,6 +8,7 @@
 #pragma once
 
 #include "gpu/gpu_buffer.hpp"
+#include "gpu/gpu_descriptor_allocator.hpp"
 
 #include <d3d12.h>
 #include <D3D12MA/D3D12MemAlloc.h>
@@ -17,7 +18,7 @@ struct dx12_buffer
     ID3D12Resource* Resource;
     D3D12MA::Allocation *Allocation;
 
-    int HeapIndex;
+    gpu_descriptor_handle HeapIndex;
     D3D12_VERTEX_BUFFER_VIEW VertexView;
     D3D12_INDEX_BUFFER_VIEW IndexView;
     D3D12_CONSTANT_BUFFER_VIEW_DESC ConstantDesc;
@@ -12,6 +12,7 @@
 #include <stb/stb_image_write.h>
 #include <sstream>
 #include <algorithm>
+#include <cstring>
 
 #include "dx12_buffer.hpp"
 #include "dx12_context.hpp"
@@ -60,12 +61,70 @@ D3D12_RESOURCE_STATES GetStateFromImageLayout(gpu_image_layout Layout)
     }
 }
 
+void Dx12CommandBufferPushBarrier(dx12_command_buffer *Private, D3D12_RESOURCE_BARRIER *Barrier)
+{
+    // NOTE(amelie.h): Two plain transitions of the same resource with nothing recorded in between fold into one, and
+    // disappear if the second one undoes the first. Folding never reaches past an aliasing or UAV barrier, and pending
+    // barriers keep their order, the render graph relies on activations landing before the transitions that follow.
+    if (Barrier->Type == D3D12_RESOURCE_BARRIER_TYPE_TRANSITION && Barrier->Flags == D3D12_RESOURCE_BARRIER_FLAG_NONE)
+    {
+        for (uint32_t BarrierIndex = Private->PendingBarrierCount; BarrierIndex > 0; BarrierIndex--)
+        {
+            D3D12_RESOURCE_BARRIER *Pending = &Private->PendingBarriers[BarrierIndex - 1];
+            if (Pending->Type != D3D12_RESOURCE_BARRIER_TYPE_TRANSITION)
+                break;
+            if (Pending->Flags != D3D12_RESOURCE_BARRIER_FLAG_NONE || Pending->Transition.pResource != Barrier->Transition.pResource ||
+                Pending->Transition.StateAfter != Barrier->Transition.StateBefore)
+                continue;
+
+            Pending->Transition.StateAfter = Barrier->Transition.StateAfter;
+            if (Pending->Transition.StateBefore == Pending->Transition.StateAfter)
+            {
+                memmove(Pending, Pending + 1, (Private->PendingBarrierCount - BarrierIndex) * sizeof(D3D12_RESOURCE_BARRIER));
+                Private->PendingBarrierCount--;
+            }
+            return;
+        }
+    }
+
+    if (Private->PendingBarrierCount == DX12_MAX_PENDING_BARRIERS)
+        Dx12CommandBufferFlushBarriers(Private);
+    Private->PendingBarriers[Private->PendingBarrierCount++] = *Barrier;
+}
+
+void Dx12CommandBufferFlushBarriers(dx12_command_buffer *Private)
+{
+    if (!Private->PendingBarrierCount)
+        return;
+
+    Private->List->ResourceBarrier(Private->PendingBarrierCount, Private->PendingBarriers);
+    Private->PendingBarrierCount = 0;
+}
+
+void Dx12CommandBufferPushTransition(dx12_command_buffer *Private, ID3D12Resource *Resource, gpu_image_layout Old, gpu_image_layout New, D3D12_RESOURCE_BARRIER_FLAGS Flags)
+{
+    D3D12_RESOURCE_BARRIER Barrier = {};
+    Barrier.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
+    Barrier.Flags = Flags;
+    Barrier.Transition.pResource = Resource;
+    Barrier.Transition.StateBefore = GetStateFromImageLayout(Old);
+    Barrier.Transition.StateAfter = GetStateFromImageLayout(New);
+    Barrier.Transition.Subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES;
+
+    if (Barrier.Transition.StateBefore == Barrier.Transition.StateAfter)
+        return;
+
+    Dx12CommandBufferPushBarrier(Private, &Barrier);
+}
+
 void GpuCommandBufferInit(gpu_command_buffer *Buffer, gpu_command_buffer_type Type)
 {
     Buffer->Type = Type;
     Buffer->Private = (void*)(new dx12_command_buffer);
 
     dx12_command_buffer *Private = (dx12_command_buffer*)Buffer->Private;
+    Private->GraphicsPipeline = nullptr;
+    Private->PendingBarrierCount = 0;
 
     HRESULT Result = DX12.Device->CreateCommandAllocator(Dx12CommandBufferType(Type), IID_PPV_ARGS(&Private->Allocator));
     if (FAILED(Result))
@@ -122,6 +181,8 @@ void GpuCommandBufferBindPipeline(gpu_command_buffer *Command, gpu_pipeline *Pip
         case gpu_pipeline_type::Graphics:
             Private->List->IASetPrimitiveTopology(D3D12_PRIMITIVE_TOPOLOGY::D3D10_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
             Private->List->SetGraphicsRootSignature(PipelinePrivate->Signature);
+            Private->List->SetGraphicsRoot32BitConstant(PipelinePrivate->DrawConstantIndex, 0, 0);
+            Private->GraphicsPipeline = PipelinePrivate;
             break;
     }
 }
@@ -142,6 +203,22 @@ void GpuCommandBufferBindConstantBuffer(gpu_command_buffer *Command, gpu_pipelin
     }
 }
 
+void GpuCommandBufferBindFrameAllocation(gpu_command_buffer *Command, gpu_pipeline_type Type, gpu_frame_allocation *Allocation, int Offset)
+{
+    dx12_command_buffer *Private = (dx12_command_buffer*)Command->Private;
+    gpu_descriptor_handle Descriptor = Dx12FrameAllocatorDescriptor(&DX12.FrameAllocator, Allocation);
+
+    switch (Type)
+    {
+        case gpu_pipeline_type::Graphics:
+            Private->List->SetGraphicsRootDescriptorTable(Offset, Dx12DescriptorHeapGPU(&DX12.CBVSRVUAVHeap, Descriptor));
+            break;
+        case gpu_pipeline_type::Compute:
+            Private->List->SetComputeRootDescriptorTable(Offset, Dx12DescriptorHeapGPU(&DX12.CBVSRVUAVHeap, Descriptor));
+            break;
+    }
+}
+
 void GpuCommandBufferBindShaderResource(gpu_command_buffer *Command, gpu_pipeline_type Type, gpu_image *Image, int Offset)
 {
     dx12_command_buffer *Private = (dx12_command_buffer*)Command->Private;
@@ -204,6 +281,8 @@ void GpuCommandBufferBindRenderTarget(gpu_command_buffer *Command, gpu_image *Im
         DSV = Dx12DescriptorHeapCPU(&DX12.DSVHeap, DepthPrivate->DSV);
     }
 
+    // NOTE(amelie.h): Whatever records into the targets next may bypass this command buffer, like the GUI does.
+    Dx12CommandBufferFlushBarriers(Private);
     Private->List->OMSetRenderTargets(1, &RTV, false, Depth != nullptr ? &DSV : nullptr);
 }
 
@@ -215,6 +294,7 @@ void GpuCommandBufferClearColor(gpu_command_buffer *Command, gpu_image *Image, f
     float Clear[4] = { Red, Green, Blue, Alpha };
 
     auto CPUHandle = Dx12DescriptorHeapCPU(&DX12.RTVHeap, ImagePrivate->RTV);
+    Dx12CommandBufferFlushBarriers(Private);
     Private->List->ClearRenderTargetView(CPUHandle, Clear, 0, nullptr);
 }
 
@@ -224,6 +304,7 @@ void GpuCommandBufferClearDepth(gpu_command_buffer *Command, gpu_image *Image, f
     dx12_image *ImagePrivate = (dx12_image*)Image->Private;
 
     auto CPUHandle = Dx12DescriptorHeapCPU(&DX12.DSVHeap, ImagePrivate->DSV);
+    Dx12CommandBufferFlushBarriers(Private);
     Private->List->ClearDepthStencilView(CPUHandle, D3D12_CLEAR_FLAG_DEPTH, Depth, Stencil, 0, nullptr);
 }
 
@@ -253,20 +334,56 @@ void GpuCommandBufferDraw(gpu_command_buffer *Command, int VertexCount)
 {
     dx12_command_buffer *Private = (dx12_command_buffer*)Command->Private;
 
+    Dx12CommandBufferFlushBarriers(Private);
     Private->List->DrawInstanced(VertexCount, 1, 0, 0);
 }
 
-void GpuCommandBufferDrawIndexed(gpu_command_buffer *Command, int IndexCount)
+void GpuCommandBufferDrawIndexed(gpu_command_buffer *Command, int IndexCount, int FirstIndex)
 {
     dx12_command_buffer *Private = (dx12_command_buffer*)Command->Private;
 
-    Private->List->DrawIndexedInstanced(IndexCount, 1, 0, 0, 0);
+    Dx12CommandBufferFlushBarriers(Private);
+    Private->List->DrawIndexedInstanced(IndexCount, 1, FirstIndex, 0, 0);
+}
+
+void GpuCommandBufferDrawIndexedInstanced(gpu_command_buffer *Command, int IndexCount, int InstanceCount, int FirstIndex)
+{
+    dx12_command_buffer *Private = (dx12_command_buffer*)Command->Private;
+
+    Dx12CommandBufferFlushBarriers(Private);
+    Private->List->DrawIndexedInstanced(IndexCount, InstanceCount, FirstIndex, 0, 0);
+}
+
+void GpuCommandBufferDrawIndexedIndirect(gpu_command_buffer *Command, gpu_frame_allocation *Arguments, uint32_t FirstDraw, uint32_t MaxDrawCount, gpu_frame_allocation *Counts, uint32_t CountIndex)
+{
+    dx12_command_buffer *Private = (dx12_command_buffer*)Command->Private;
+    if (!Private->GraphicsPipeline)
+    {
+        LogError("D3D12: Indirect draw recorded without a graphics pipeline bound!");
+        return;
+    }
+
+    // NOTE(amelie.h): Frame memory lives in upload heaps, which are always readable as indirect arguments.
+    uint64_t ArgumentOffset;
+    ID3D12Resource *ArgumentResource = Dx12FrameAllocationResource(&DX12.FrameAllocator, Arguments, &ArgumentOffset);
+    ArgumentOffset += (uint64_t)FirstDraw * sizeof(gpu_draw_indexed_arguments);
+
+    uint64_t CountOffset = 0;
+    ID3D12Resource *CountResource = nullptr;
+    if (Counts)
+    {
+        CountResource = Dx12FrameAllocationResource(&DX12.FrameAllocator, Counts, &CountOffset);
+        CountOffset += (uint64_t)CountIndex * sizeof(uint32_t);
+    }
+    Dx12CommandBufferFlushBarriers(Private);
+    Private->List->ExecuteIndirect(Private->GraphicsPipeline->DrawSignature, MaxDrawCount, ArgumentResource, ArgumentOffset, CountResource, CountOffset);
 }
 
 void GpuCommandBufferDispatch(gpu_command_buffer *Command, int X, int Y, int Z)
 {
     dx12_command_buffer *Private = (dx12_command_buffer*)Command->Private;
 
+    Dx12CommandBufferFlushBarriers(Private);
     Private->List->Dispatch(X, Y, Z);
 }
 
@@ -285,6 +402,7 @@ void GpuCommandBufferEndPipelineStatistics(gpu_command_buffer *Command, gpu_pipe
     ID3D12Resource *TargetResource = (ID3D12Resource*)(((dx12_buffer*)ProfilerPrivate->Buffer.Reserved)->Resource);
 
     Private->List->EndQuery(ProfilerPrivate->Heap, D3D12_QUERY_TYPE_PIPELINE_STATISTICS, 0);
+    Dx12CommandBufferFlushBarriers(Private);
     
     D3D12_RESOURCE_BARRIER Barrier = {};
     Barrier.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
@@ -318,14 +436,7 @@ void GpuCommandBufferBufferBarrier(gpu_command_buffer *Command, gpu_buffer *Buff
     dx12_command_buffer *Private = (dx12_command_buffer*)Command->Private;
     dx12_buffer *BufferPrivate = (dx12_buffer*)Buffer->Reserved;
 
-    D3D12_RESOURCE_BARRIER Barrier = {};
-    Barrier.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
-    Barrier.Transition.pResource = BufferPrivate->Resource;
-    Barrier.Transition.StateBefore = GetStateFromImageLayout(Old);
-    Barrier.Transition.StateAfter = GetStateFromImageLayout(New);
-    Barrier.Transition.Subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES;
-
-    Private->List->ResourceBarrier(1, &Barrier);
+    Dx12CommandBufferPushTransition(Private, BufferPrivate->Resource, Old, New, D3D12_RESOURCE_BARRIER_FLAG_NONE);
 }
 
 void GpuCommandBufferImageBarrier(gpu_command_buffer *Command, gpu_image *Image, gpu_image_layout New)
@@ -333,20 +444,65 @@ void GpuCommandBufferImageBarrier(gpu_command_buffer *Command, gpu_image *Image,
     dx12_command_buffer *Private = (dx12_command_buffer*)Command->Private;
     dx12_image *ImagePrivate = (dx12_image*)Image->Private;
 
-    D3D12_RESOURCE_BARRIER Barrier = {};
-    Barrier.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
-    Barrier.Transition.pResource = ImagePrivate->Resource;
-    Barrier.Transition.StateBefore = GetStateFromImageLayout(Image->Layout);
-    Barrier.Transition.StateAfter = GetStateFromImageLayout(New);
-    Barrier.Transition.Subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES;
+    if (Image->Layout == New)
+        return;
 
-    if (Barrier.Transition.StateBefore == Barrier.Transition.StateAfter)
+    Dx12CommandBufferPushTransition(Private, ImagePrivate->Resource, Image->Layout, New, D3D12_RESOURCE_BARRIER_FLAG_NONE);
+    Image->Layout = New;
+    ImagePrivate->State = GetStateFromImageLayout(Image->Layout);
+}
+
+void GpuCommandBufferImageBarrierBegin(gpu_command_buffer *Command, gpu_image *Image, gpu_image_layout New)
+{
+    dx12_command_buffer *Private = (dx12_command_buffer*)Command->Private;
+    dx12_image *ImagePrivate = (dx12_image*)Image->Private;
+
+    if (Image->Layout == New)
+        return;
+
+    Dx12CommandBufferPushTransition(Private, ImagePrivate->Resource, Image->Layout, New, D3D12_RESOURCE_BARRIER_FLAG_BEGIN_ONLY);
+}
+
+void GpuCommandBufferImageBarrierEnd(gpu_command_buffer *Command, gpu_image *Image, gpu_image_layout New)
+{
+    dx12_command_buffer *Private = (dx12_command_buffer*)Command->Private;
+    dx12_image *ImagePrivate = (dx12_image*)Image->Private;
+
+    if (Image->Layout == New)
         return;
 
+    Dx12CommandBufferPushTransition(Private, ImagePrivate->Resource, Image->Layout, New, D3D12_RESOURCE_BARRIER_FLAG_END_ONLY);
     Image->Layout = New;
     ImagePrivate->State = GetStateFromImageLayout(Image->Layout);
+}
 
-    Private->List->ResourceBarrier(1, &Barrier);
+void GpuCommandBufferImageTransition(gpu_command_buffer *Command, gpu_image *Image, gpu_image_layout Old, gpu_image_layout New)
+{
+    dx12_command_buffer *Private = (dx12_command_buffer*)Command->Private;
+    dx12_image *ImagePrivate = (dx12_image*)Image->Private;
+
+    Dx12CommandBufferPushTransition(Private, ImagePrivate->Resource, Old, New, D3D12_RESOURCE_BARRIER_FLAG_NONE);
+}
+
+void GpuCommandBufferAliasingBarrier(gpu_command_buffer *Command, gpu_image *Before, gpu_image *After)
+{
+    dx12_command_buffer *Private = (dx12_command_buffer*)Command->Private;
+
+    D3D12_RESOURCE_BARRIER Barrier = {};
+    Barrier.Type = D3D12_RESOURCE_BARRIER_TYPE_ALIASING;
+    Barrier.Aliasing.pResourceBefore = Before ? ((dx12_image*)Before->Private)->Resource : nullptr;
+    Barrier.Aliasing.pResourceAfter = ((dx12_image*)After->Private)->Resource;
+
+    Dx12CommandBufferPushBarrier(Private, &Barrier);
+}
+
+void GpuCommandBufferDiscardImage(gpu_command_buffer *Command, gpu_image *Image)
+{
+    dx12_command_buffer *Private = (dx12_command_buffer*)Command->Private;
+    dx12_image *ImagePrivate = (dx12_image*)Image->Private;
+
+    Dx12CommandBufferFlushBarriers(Private);
+    Private->List->DiscardResource(ImagePrivate->Resource, nullptr);
 }
 
 void GpuCommandBufferBlit(gpu_command_buffer *Command, gpu_image *Source, gpu_image *Dest)
@@ -365,6 +521,7 @@ void GpuCommandBufferBlit(gpu_command_buffer *Command, gpu_image *Source, gpu_im
     BlitDest.pResource = DestPrivate->Resource;
     BlitDest.SubresourceIndex = 0;
 
+    Dx12CommandBufferFlushBarriers(Private);
     Private->List->CopyTextureRegion(&BlitDest, 0, 0, 0, &BlitSource, nullptr);
 }
 
@@ -392,6 +549,7 @@ void GpuCommandBufferCopyBufferToTexture(gpu_command_buffer *Command, gpu_buffer
     CopyDest.pResource = DestPrivate->Resource;
     CopyDest.SubresourceIndex = 0;
 
+    Dx12CommandBufferFlushBarriers(Private);
     Private->List->CopyTextureRegion(&CopyDest, 0, 0, 0, &CopySource, nullptr);
 }
 
@@ -417,6 +575,7 @@ void GpuCommandBufferCopyTextureToBuffer(gpu_command_buffer *Command, gpu_image
     CopyDest.PlacedFootprint.Footprint.RowPitch = Source->Width * 4;
     CopyDest.SubresourceIndex = 0;
 
+    Dx12CommandBufferFlushBarriers(Private);
     Private->List->CopyTextureRegion(&CopyDest, 0, 0, 0, &CopySource, nullptr);
 }
 
@@ -426,6 +585,7 @@ void GpuCommandBufferCopyBufferToBuffer(gpu_command_buffer *Command, gpu_buffer
     dx12_buffer *DestPrivate = (dx12_buffer*)Dest->Reserved;
     dx12_buffer *SourcePrivate = (dx12_buffer*)Source->Reserved;
 
+    Dx12CommandBufferFlushBarriers(Private);
     Private->List->CopyResource(DestPrivate->Resource, SourcePrivate->Resource);
 }
 
@@ -435,6 +595,8 @@ void GpuCommandBufferBegin(gpu_command_buffer *Command)
 
     Private->Allocator->Reset();
     Private->List->Reset(Private->Allocator, nullptr);
+    Private->GraphicsPipeline = nullptr;
+    Private->PendingBarrierCount = 0;
 
     if (Command->Type != gpu_command_buffer_type::Upload)
     {
@@ -447,6 +609,7 @@ void GpuCommandBufferEnd(gpu_command_buffer *Command)
 {
     dx12_command_buffer *Private = (dx12_command_buffer*)Command->Private;
     
+    Dx12CommandBufferFlushBarriers(Private);
     Private->List->Close();
 }
 
@@ -460,7 +623,7 @@ void GpuCommandBufferFlush(gpu_command_buffer *Command)
     {
         case gpu_command_buffer_type::Graphics:
             Queue = DX12.GraphicsQueue;
-            Fence = &DX12.DeviceFence;
+            Fence = &DX12.GraphicsFence;
             break;
         case gpu_command_buffer_type::Compute:
             Queue = DX12.ComputeQueue;
@@ -472,11 +635,45 @@ void GpuCommandBufferFlush(gpu_command_buffer *Command)
             break;
     }
 
+    if (Command->Type != gpu_command_buffer_type::Upload)
+        Dx12UploaderSyncQueue(&DX12.Uploader, Queue);
+
     ID3D12CommandList* CommandLists[] = { Private->List };
     Queue->ExecuteCommandLists(1, CommandLists);
     Dx12FenceFlush(Fence, Queue);
 }
 
+void GpuCommandBufferSubmit(gpu_command_buffer **Buffers, uint32_t Count)
+{
+    if (Count == 0)
+        return;
+
+    ID3D12CommandQueue* Queue = nullptr;
+    switch (Buffers[0]->Type)
+    {
+        case gpu_command_buffer_type::Graphics:
+            Queue = DX12.GraphicsQueue;
+            break;
+        case gpu_command_buffer_type::Compute:
+            Queue = DX12.ComputeQueue;
+            break;
+        case gpu_command_buffer_type::Upload:
+            Queue = DX12.UploadQueue;
+            break;
+    }
+
+    std::vector<ID3D12CommandList*> CommandLists(Count);
+    for (uint32_t BufferIndex = 0; BufferIndex < Count; BufferIndex++)
+    {
+        if (Buffers[BufferIndex]->Type != Buffers[0]->Type)
+            LogError("D3D12: Submitting command buffers of different types in one batch!");
+        CommandLists[BufferIndex] = ((dx12_command_buffer*)Buffers[BufferIndex]->Private)->List;
+    }
+    if (Buffers[0]->Type != gpu_command_buffer_type::Upload)
+        Dx12UploaderSyncQueue(&DX12.Uploader, Queue);
+    Queue->ExecuteCommandLists(Count, CommandLists.data());
+}
+
 void GpuCommandBufferScreenshot(gpu_command_buffer *Command, gpu_image *Image, gpu_buffer *Temporary)
 {
     std::stringstream Stream;
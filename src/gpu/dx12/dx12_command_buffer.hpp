@@ -11,8 +11,22 @@
 
 #include <d3d12.h>
 
+#define DX12_MAX_PENDING_BARRIERS 16
+
+struct dx12_pipeline;
+
 struct dx12_command_buffer
 {
     ID3D12CommandAllocator *Allocator;
     ID3D12GraphicsCommandList *List;
+
+    // NOTE(amelie.h): Last bound graphics pipeline, indirect draws use its command signature.
+    dx12_pipeline *GraphicsPipeline;
+
+    // NOTE(amelie.h): Barriers wait here until a command needs them, then go out in a single ResourceBarrier call.
+    D3D12_RESOURCE_BARRIER PendingBarriers[DX12_MAX_PENDING_BARRIERS];
+    uint32_t PendingBarrierCount;
 };
+
+void Dx12CommandBufferPushBarrier(dx12_command_buffer *Private, D3D12_RESOURCE_BARRIER *Barrier);
+void Dx12CommandBufferFlushBarriers(dx12_command_buffer *Private);
@@ -9,8 +9,11 @@
 
 #include "game_data.hpp"
 #include "systems/log_system.hpp"
+#include "systems/time_system.hpp"
+#include "timer.hpp"
 #include "windows/windows_data.hpp"
 
+#include <algorithm>
 #include <string>
 
 extern "C" 
@@ -107,6 +110,12 @@ void GpuInit()
             D3D12_MESSAGE_ID_CLEARDEPTHSTENCILVIEW_MISMATCHINGCLEARVALUE,
             D3D12_MESSAGE_ID_MAP_INVALID_NULLRANGE,
             D3D12_MESSAGE_ID_UNMAP_INVALID_NULLRANGE,
+            // NOTE(amelie.h): A pipeline cache written by another driver or GPU, or damaged on disk, the pipeline gets
+            // recompiled. Breaking on these would stop every debug run after a driver update.
+            D3D12_MESSAGE_ID_CREATEPIPELINESTATE_CACHEDBLOBADAPTERMISMATCH,
+            D3D12_MESSAGE_ID_CREATEPIPELINESTATE_CACHEDBLOBDRIVERVERSIONMISMATCH,
+            D3D12_MESSAGE_ID_CREATEPIPELINESTATE_CACHEDBLOBDESCMISMATCH,
+            D3D12_MESSAGE_ID_CREATEPIPELINESTATE_CACHEDBLOBINVALID,
         };
 
         D3D12_INFO_QUEUE_FILTER filter = {0};
@@ -147,10 +156,24 @@ void GpuInit()
     DX12.CommandBuffers.resize(BufferCount);
     DX12.FrameSync.resize(BufferCount);
 
+    int FramesInFlight = EgcI32(EgcFile, "frames_in_flight");
+    if (FramesInFlight <= 0 || FramesInFlight > BufferCount)
+        FramesInFlight = BufferCount;
+    DX12.FramesInFlight = FramesInFlight;
+    DX12.FrameCount = 0;
+    DX12.PacingValues.assign(FramesInFlight, 0);
+    DX12.PacingSubmitTimes.assign(FramesInFlight, 0);
+    DX12.Metrics = {};
+    DX12.Metrics.FramesInFlight = FramesInFlight;
+
     for (int FrameIndex = 0; FrameIndex < BufferCount; FrameIndex++)
         GpuCommandBufferInit(&DX12.CommandBuffers[FrameIndex], gpu_command_buffer_type::Graphics);
 
-    Dx12FenceInit(&DX12.DeviceFence);
+    DX12.PassCommandBuffers.resize(BufferCount * GPU_MAX_PASS_COMMAND_BUFFERS);
+    for (auto& PassBuffer : DX12.PassCommandBuffers)
+        GpuCommandBufferInit(&PassBuffer, gpu_command_buffer_type::Graphics);
+
+    Dx12FenceInit(&DX12.GraphicsFence);
     Dx12FenceInit(&DX12.ComputeFence);
     Dx12FenceInit(&DX12.UploadFence);
 
@@ -167,14 +190,21 @@ void GpuInit()
     if (FAILED(Result))
         LogError("D3D12: Failed to create D3D12MA allocator!");
 
+    GpuPipelineCacheLoad(&DX12.PipelineCache, EgcStr(EgcFile, "pipeline_cache"));
+    Dx12UploaderInit(&DX12.Uploader, DX12_UPLOAD_RING_SIZE);
+    Dx12FrameAllocatorInit(&DX12.FrameAllocator, BufferCount);
     Dx12SwapchainInit(&DX12.SwapChain);
 }
 
 void GpuWait()
 {
-    Dx12FenceFlush(&DX12.DeviceFence, DX12.GraphicsQueue);
-    Dx12FenceFlush(&DX12.DeviceFence, DX12.ComputeQueue);
-    Dx12FenceFlush(&DX12.DeviceFence, DX12.UploadQueue);
+    Dx12UploaderWait(&DX12.Uploader);
+
+    // NOTE(amelie.h): Signal every queue on its own fence first so they drain in parallel, then wait on both.
+    uint64_t GraphicsValue = Dx12FenceSignal(&DX12.GraphicsFence, DX12.GraphicsQueue);
+    uint64_t ComputeValue = Dx12FenceSignal(&DX12.ComputeFence, DX12.ComputeQueue);
+    Dx12FenceSync(&DX12.GraphicsFence, GraphicsValue);
+    Dx12FenceSync(&DX12.ComputeFence, ComputeValue);
 }
 
 void GpuExit()
@@ -185,15 +215,24 @@ void GpuExit()
     int BufferCount = EgcI32(EgcFile, "buffer_count");
 
     Dx12SwapchainFree(&DX12.SwapChain);
+    Dx12FrameAllocatorFree(&DX12.FrameAllocator);
+    Dx12UploaderFree(&DX12.Uploader);
+    GpuPipelineCacheSave(&DX12.PipelineCache);
+    GpuPipelineCacheClear(&DX12.PipelineCache);
+    for (auto& Signature : DX12.RootSignatures)
+        SafeRelease(Signature.second);
+    DX12.RootSignatures.clear();
     Dx12DescriptorHeapFree(&DX12.SamplerHeap);
     Dx12DescriptorHeapFree(&DX12.CBVSRVUAVHeap);
     Dx12DescriptorHeapFree(&DX12.DSVHeap);
     Dx12DescriptorHeapFree(&DX12.RTVHeap);
+    for (auto& PassBuffer : DX12.PassCommandBuffers)
+        GpuCommandBufferFree(&PassBuffer);
     for (int FrameIndex = 0; FrameIndex < BufferCount; FrameIndex++)
         GpuCommandBufferFree(&DX12.CommandBuffers[FrameIndex]);
     Dx12FenceFree(&DX12.UploadFence);
     Dx12FenceFree(&DX12.ComputeFence);
-    Dx12FenceFree(&DX12.DeviceFence);
+    Dx12FenceFree(&DX12.GraphicsFence);
     SafeRelease(DX12.UploadQueue);
     SafeRelease(DX12.ComputeQueue);
     SafeRelease(DX12.GraphicsQueue);
@@ -211,12 +250,31 @@ void GpuExit()
 void GpuBeginFrame()
 {
     DX12.FrameIndex = Dx12SwapchainImageIndex(&DX12.SwapChain);
-    Dx12FenceSync(&DX12.DeviceFence, DX12.FrameSync[DX12.FrameIndex]);
+
+    // NOTE(amelie.h): Block until the frame submitted FramesInFlight frames ago is done, and until the GPU
+    // is done with this back buffer's command allocators and frame allocator region.
+    uint32_t Slot = DX12.FrameCount % DX12.FramesInFlight;
+    uint64_t Target = std::max(DX12.PacingValues[Slot], DX12.FrameSync[DX12.FrameIndex]);
+
+    uint64_t WaitStart = TimeGetNanoseconds();
+    Dx12FenceSync(&DX12.GraphicsFence, Target);
+    uint64_t WaitEnd = TimeGetNanoseconds();
+
+    DX12.Metrics.CpuWaitMs = NanosecondsToMilliseconds(WaitEnd - WaitStart);
+    if (DX12.PacingSubmitTimes[Slot])
+        DX12.Metrics.FrameLatencyMs = NanosecondsToMilliseconds(WaitEnd - DX12.PacingSubmitTimes[Slot]);
+
+    Dx12FrameAllocatorReset(&DX12.FrameAllocator);
 }
 
 void GpuEndFrame()
 {
-    DX12.FrameSync[DX12.FrameIndex] = Dx12FenceSignal(&DX12.DeviceFence, DX12.GraphicsQueue);
+    uint32_t Slot = DX12.FrameCount % DX12.FramesInFlight;
+
+    DX12.FrameSync[DX12.FrameIndex] = Dx12FenceSignal(&DX12.GraphicsFence, DX12.GraphicsQueue);
+    DX12.PacingValues[Slot] = DX12.FrameSync[DX12.FrameIndex];
+    DX12.PacingSubmitTimes[Slot] = TimeGetNanoseconds();
+    DX12.FrameCount++;
 }
 
 void GpuResize(uint32_t Width, uint32_t Height)
@@ -249,7 +307,27 @@ gpu_command_buffer* GpuGetImageCommandBuffer()
     return &DX12.CommandBuffers[DX12.FrameIndex];
 }
 
+gpu_command_buffer* GpuGetPassCommandBuffer(uint32_t Index)
+{
+    if (Index >= GPU_MAX_PASS_COMMAND_BUFFERS)
+    {
+        LogError("D3D12: Pass command buffer %u out of range!", Index);
+        Index = GPU_MAX_PASS_COMMAND_BUFFERS - 1;
+    }
+    return &DX12.PassCommandBuffers[DX12.FrameIndex * GPU_MAX_PASS_COMMAND_BUFFERS + Index];
+}
+
 gpu_image* GpuGetSwapChainImage()
 {
     return &DX12.SwapChain.Images[DX12.FrameIndex];
 }
+
+gpu_frame_metrics GpuGetFrameMetrics()
+{
+    return DX12.Metrics;
+}
+
+gpu_pipeline_cache* GpuGetPipelineCache()
+{
+    return &DX12.PipelineCache;
+}
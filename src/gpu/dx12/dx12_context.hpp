@@ -11,10 +11,13 @@
 #include <dxgi1_6.h>
 #include <vector>
 #include <cstdint>
+#include <unordered_map>
 
 #include "dx12_descriptor_heap.hpp"
 #include "dx12_swapchain.hpp"
 #include "dx12_fence.hpp"
+#include "dx12_frame_allocator.hpp"
+#include "dx12_uploader.hpp"
 #include "math_types.hpp"
 #include "gpu/gpu_command_buffer.hpp"
 #include "gpu/gpu_context.hpp"
@@ -34,15 +37,17 @@ struct dx12_context
     IDXGIAdapter1 *Adapter;
 
     ID3D12CommandQueue *GraphicsQueue;
-    dx12_fence DeviceFence;
+    dx12_fence GraphicsFence;
 
     ID3D12CommandQueue *ComputeQueue;
     dx12_fence ComputeFence;
 
     ID3D12CommandQueue *UploadQueue;
     dx12_fence UploadFence;
+    dx12_uploader Uploader;
 
     std::vector<gpu_command_buffer> CommandBuffers;
+    std::vector<gpu_command_buffer> PassCommandBuffers;
 
     D3D12MA::Allocator *Allocator;
 
@@ -52,9 +57,20 @@ struct dx12_context
     dx12_descriptor_heap SamplerHeap;
 
     dx12_swapchain SwapChain;
-    std::vector<dx12_fence> FrameFences;
+    dx12_frame_allocator FrameAllocator;
     std::vector<uint64_t> FrameSync;
     uint32_t FrameIndex;
+
+    // NOTE(amelie.h): Graphics fence values and submit times of the last FramesInFlight frames, indexed by FrameCount.
+    uint32_t FramesInFlight;
+    uint64_t FrameCount;
+    std::vector<uint64_t> PacingValues;
+    std::vector<uint64_t> PacingSubmitTimes;
+    gpu_frame_metrics Metrics;
+
+    // NOTE(amelie.h): Root signatures are shared between pipelines, keyed by a hash of their description.
+    gpu_pipeline_cache PipelineCache;
+    std::unordered_map<uint64_t, ID3D12RootSignature*> RootSignatures;
 };
 
 extern dx12_context DX12;
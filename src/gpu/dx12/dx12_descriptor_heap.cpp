@@ -30,7 +30,7 @@ void Dx12DescriptorHeapInit(dx12_descriptor_heap *Heap, D3D12_DESCRIPTOR_HEAP_TY
 {
     Heap->Type = Type;
     Heap->DescriptorCount = Count;
-    Heap->DescriptorLookupTable = std::vector<bool>(Count, false);
+    GpuDescriptorAllocatorInit(&Heap->Allocator, Count);
 
     D3D12_DESCRIPTOR_HEAP_DESC Desc = {};
     Desc.NumDescriptors = Count;
@@ -49,35 +49,46 @@ void Dx12DescriptorHeapInit(dx12_descriptor_heap *Heap, D3D12_DESCRIPTOR_HEAP_TY
 
 void Dx12DescriptorHeapFree(dx12_descriptor_heap *Heap)
 {
+    GpuDescriptorAllocatorFree(&Heap->Allocator);
     SafeRelease(Heap->Heap);
 }
 
-D3D12_CPU_DESCRIPTOR_HANDLE Dx12DescriptorHeapCPU(dx12_descriptor_heap *Heap, int Offset)
+D3D12_CPU_DESCRIPTOR_HANDLE Dx12DescriptorHeapCPU(dx12_descriptor_heap *Heap, gpu_descriptor_handle Descriptor)
 {
+    if (!GpuDescriptorValid(&Heap->Allocator, Descriptor))
+        LogError("D3D12: Using stale descriptor handle 0x%08x in heap %s!", Descriptor, HeapTypeToString(Heap->Type));
+
     D3D12_CPU_DESCRIPTOR_HANDLE Handle = Heap->Heap->GetCPUDescriptorHandleForHeapStart();
-    Handle.ptr += Offset * Heap->IncrementSize;
+    Handle.ptr += (uint64_t)GpuDescriptorIndex(Descriptor) * Heap->IncrementSize;
     return Handle;
 }
 
-D3D12_GPU_DESCRIPTOR_HANDLE Dx12DescriptorHeapGPU(dx12_descriptor_heap *Heap, int Offset)
+D3D12_GPU_DESCRIPTOR_HANDLE Dx12DescriptorHeapGPU(dx12_descriptor_heap *Heap, gpu_descriptor_handle Descriptor)
 {
+    if (!GpuDescriptorValid(&Heap->Allocator, Descriptor))
+        LogError("D3D12: Using stale descriptor handle 0x%08x in heap %s!", Descriptor, HeapTypeToString(Heap->Type));
+
     D3D12_GPU_DESCRIPTOR_HANDLE Handle = Heap->Heap->GetGPUDescriptorHandleForHeapStart();
-    Handle.ptr += Offset * Heap->IncrementSize;
+    Handle.ptr += (uint64_t)GpuDescriptorIndex(Descriptor) * Heap->IncrementSize;
     return Handle;
 }
 
-int Dx12DescriptorHeapAlloc(dx12_descriptor_heap *Heap)
+gpu_descriptor_handle Dx12DescriptorHeapAlloc(dx12_descriptor_heap *Heap)
 {
-    for (int Descriptor = 0; Descriptor < Heap->DescriptorCount; Descriptor++) {
-        if (Heap->DescriptorLookupTable[Descriptor] == false) {
-            Heap->DescriptorLookupTable[Descriptor] = true;
-            return Descriptor;
-        }
-    }
-    return -1;
+    return GpuDescriptorAlloc(&Heap->Allocator);
+}
+
+gpu_descriptor_handle Dx12DescriptorHeapAllocRange(dx12_descriptor_heap *Heap, uint32_t Count)
+{
+    return GpuDescriptorAllocRange(&Heap->Allocator, Count);
+}
+
+void Dx12DescriptorHeapFreeSpace(dx12_descriptor_heap *Heap, gpu_descriptor_handle Descriptor)
+{
+    GpuDescriptorRelease(&Heap->Allocator, Descriptor);
 }
 
-void Dx12DescriptorHeapFreeSpace(dx12_descriptor_heap *Heap, int Descriptor)
+void Dx12DescriptorHeapFreeRange(dx12_descriptor_heap *Heap, gpu_descriptor_handle Descriptor, uint32_t Count)
 {
-    Heap->DescriptorLookupTable[Descriptor] = false;
+    GpuDescriptorReleaseRange(&Heap->Allocator, Descriptor, Count);
 }
@@ -11,18 +11,22 @@
 #include <d3d12.h>
 #include <vector>
 
+#include "gpu/gpu_descriptor_allocator.hpp"
+
 struct dx12_descriptor_heap
 {
     ID3D12DescriptorHeap *Heap;
     uint32_t IncrementSize;
     uint32_t DescriptorCount;
     D3D12_DESCRIPTOR_HEAP_TYPE Type;
-    std::vector<bool> DescriptorLookupTable;
+    gpu_descriptor_allocator Allocator;
 };
 
 void Dx12DescriptorHeapInit(dx12_descriptor_heap *Heap, D3D12_DESCRIPTOR_HEAP_TYPE Type, uint32_t Count);
 void Dx12DescriptorHeapFree(dx12_descriptor_heap *Heap);
-D3D12_CPU_DESCRIPTOR_HANDLE Dx12DescriptorHeapCPU(dx12_descriptor_heap *Heap, int Offset);
-D3D12_GPU_DESCRIPTOR_HANDLE Dx12DescriptorHeapGPU(dx12_descriptor_heap *Heap, int Offset);
-int Dx12DescriptorHeapAlloc(dx12_descriptor_heap *Heap);
-void Dx12DescriptorHeapFreeSpace(dx12_descriptor_heap *Heap, int Descriptor);
+D3D12_CPU_DESCRIPTOR_HANDLE Dx12DescriptorHeapCPU(dx12_descriptor_heap *Heap, gpu_descriptor_handle Descriptor);
+D3D12_GPU_DESCRIPTOR_HANDLE Dx12DescriptorHeapGPU(dx12_descriptor_heap *Heap, gpu_descriptor_handle Descriptor);
+gpu_descriptor_handle Dx12DescriptorHeapAlloc(dx12_descriptor_heap *Heap);
+gpu_descriptor_handle Dx12DescriptorHeapAllocRange(dx12_descriptor_heap *Heap, uint32_t Count);
+void Dx12DescriptorHeapFreeSpace(dx12_descriptor_heap *Heap, gpu_descriptor_handle Descriptor);
+void Dx12DescriptorHeapFreeRange(dx12_descriptor_heap *Heap, gpu_descriptor_handle Descriptor, uint32_t Count);
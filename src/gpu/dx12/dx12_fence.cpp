@@ -11,8 +11,6 @@
 #include "systems/log_system.hpp"
 #include "windows/windows_data.hpp"
 
-#include <exception>
-
 void Dx12FenceInit(dx12_fence *Fence)
 {
     Fence->Value = 0;
@@ -40,8 +38,18 @@ bool Dx12FenceReached(dx12_fence *Fence, uint64_t Value)
 
 void Dx12FenceSync(dx12_fence *Fence, uint64_t Value)
 {
-    while (!Dx12FenceReached(Fence, Value)) {
-        Fence->Fence->SetEventOnCompletion(Value, nullptr);
+    // NOTE(amelie.h): Without an event SetEventOnCompletion blocks the calling thread until the fence gets there, so
+    // waiters never share anything. If it can't, yield until the fence catches up rather than return early.
+    bool Blocked = true;
+    while (!Dx12FenceReached(Fence, Value))
+    {
+        if (Blocked && FAILED(Fence->Fence->SetEventOnCompletion(Value, nullptr)))
+        {
+            LogError("D3D12: Failed to block on fence value %llu, polling instead!", Value);
+            Blocked = false;
+        }
+        if (!Blocked)
+            SwitchToThread();
     }
 }
 
@@ -50,17 +58,30 @@ void Dx12FenceFlush(dx12_fence *Fence, ID3D12CommandQueue *Queue)
     Dx12FenceSync(Fence, Dx12FenceSignal(Fence, Queue));
 }
 
-void Dx12FenceWait(dx12_fence *Fence, uint64_t TargetValue, uint32_t Timeout)
+bool Dx12FenceWait(dx12_fence *Fence, uint64_t TargetValue, uint32_t Timeout)
 {
-    if (Fence->Fence->GetCompletedValue() < TargetValue)
+    if (Dx12FenceReached(Fence, TargetValue))
+        return true;
+
+    // NOTE(amelie.h): The thread sleeps on an event of its own, a shared one would only wake one of the waiters.
+    HANDLE Event = CreateEvent(nullptr, false, false, nullptr);
+    if (!Event)
     {
-        HANDLE Event = CreateEvent(nullptr, false, false, nullptr);
-        Fence->Fence->SetEventOnCompletion(TargetValue, Event);
-        if (!Event)
-        {
-            LogError("D3D12: fence timeout!");
-            throw std::exception();
-        }
-        WaitForSingleObject(Event, Timeout);
+        LogError("D3D12: Failed to create fence event!");
+        return false;
+    }
+
+    HRESULT Result = Fence->Fence->SetEventOnCompletion(TargetValue, Event);
+    if (FAILED(Result))
+    {
+        LogError("D3D12: Failed to set fence completion event!");
+        CloseHandle(Event);
+        return false;
     }
+
+    bool Reached = WaitForSingleObject(Event, Timeout == DX12_FENCE_INFINITE ? INFINITE : Timeout) == WAIT_OBJECT_0;
+    CloseHandle(Event);
+    if (!Reached)
+        LogWarn("D3D12: Fence wait for value %llu timed out after %ums!", TargetValue, Timeout);
+    return Reached;
 }
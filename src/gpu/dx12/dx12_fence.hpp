@@ -10,6 +10,9 @@
 #include <cstdint>
 #include <d3d12.h>
 
+#define DX12_FENCE_INFINITE 0xFFFFFFFF
+
+// NOTE(amelie.h): Any number of threads can wait on a fence at once, every wait brings its own way to sleep.
 struct dx12_fence
 {
     ID3D12Fence *Fence;
@@ -20,6 +23,8 @@ void Dx12FenceInit(dx12_fence *Fence);
 void Dx12FenceFree(dx12_fence *Fence);
 uint64_t Dx12FenceSignal(dx12_fence *Fence, ID3D12CommandQueue *Queue);
 bool Dx12FenceReached(dx12_fence *Fence, uint64_t Value);
+// NOTE(amelie.h): Only returns once the fence reached Value.
 void Dx12FenceSync(dx12_fence *Fence, uint64_t Value);
 void Dx12FenceFlush(dx12_fence *Fence, ID3D12CommandQueue *Queue);
-void Dx12FenceWait(dx12_fence *Fence, uint64_t TargetValue, uint32_t Timeout);
+// NOTE(amelie.h): Returns false when the fence didn't reach TargetValue within Timeout milliseconds.
+bool Dx12FenceWait(dx12_fence *Fence, uint64_t TargetValue, uint32_t Timeout);
@@ -0,0 +1,263 @@
+/**
+ *  Author: Amélie Heinrich
+ *  Company: Amélie Games
+ *  License: MIT
+ *  Create Time: 17/10/2026 15:00
+ */
+
+#include "dx12_frame_allocator.hpp"
+
+#include "dx12_context.hpp"
+#include "gpu/gpu_context.hpp"
+#include "systems/log_system.hpp"
+#include "windows/windows_data.hpp"
+
+bool Dx12FrameAllocatorCreateResource(uint64_t Size, D3D12MA::Allocation **Allocation, ID3D12Resource **Resource, uint8_t **Mapped)
+{
+    D3D12MA::ALLOCATION_DESC AllocDesc = {};
+    AllocDesc.HeapType = D3D12_HEAP_TYPE_UPLOAD;
+
+    D3D12_RESOURCE_DESC ResourceDesc = {};
+    ResourceDesc.Dimension = D3D12_RESOURCE_DIMENSION_BUFFER;
+    ResourceDesc.Alignment = D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT;
+    ResourceDesc.Width = Size;
+    ResourceDesc.Height = 1;
+    ResourceDesc.DepthOrArraySize = 1;
+    ResourceDesc.MipLevels = 1;
+    ResourceDesc.Format = DXGI_FORMAT_UNKNOWN;
+    ResourceDesc.SampleDesc.Count = 1;
+    ResourceDesc.SampleDesc.Quality = 0;
+    ResourceDesc.Layout = D3D12_TEXTURE_LAYOUT_ROW_MAJOR;
+    ResourceDesc.Flags = D3D12_RESOURCE_FLAG_NONE;
+
+    HRESULT Result = DX12.Allocator->CreateResource(&AllocDesc, &ResourceDesc, D3D12_RESOURCE_STATE_GENERIC_READ, nullptr, Allocation, IID_NULL, nullptr);
+    if (FAILED(Result))
+    {
+        LogError("D3D12: Failed to allocate frame memory of size %llu!", Size);
+        return false;
+    }
+    *Resource = (*Allocation)->GetResource();
+
+    D3D12_RANGE ReadRange = { 0, 0 };
+    Result = (*Resource)->Map(0, &ReadRange, (void**)Mapped);
+    if (FAILED(Result))
+    {
+        LogError("D3D12: Failed to map frame memory!");
+        return false;
+    }
+    return true;
+}
+
+void Dx12FrameAllocatorInit(dx12_frame_allocator *Allocator, uint32_t FrameCount)
+{
+    Allocator->FrameCount = FrameCount;
+    Allocator->Head = 0;
+
+    uint64_t Size = (uint64_t)FrameCount * GPU_FRAME_ALLOCATOR_SLICES * GPU_FRAME_ALLOCATOR_ALIGNMENT;
+    Dx12FrameAllocatorCreateResource(Size, &Allocator->Allocation, &Allocator->Resource, &Allocator->Mapped);
+
+    Allocator->Descriptors = Dx12DescriptorHeapAllocRange(&DX12.CBVSRVUAVHeap, FrameCount * GPU_FRAME_ALLOCATOR_SLICES);
+}
+
+void Dx12FrameAllocatorFree(dx12_frame_allocator *Allocator)
+{
+    Dx12DescriptorHeapFreeRange(&DX12.CBVSRVUAVHeap, Allocator->Descriptors, Allocator->FrameCount * GPU_FRAME_ALLOCATOR_SLICES);
+
+    Allocator->Resource->Unmap(0, nullptr);
+    Allocator->Allocation->Release();
+}
+
+void Dx12FrameAllocatorReset(dx12_frame_allocator *Allocator)
+{
+    Allocator->Head = 0;
+}
+
+gpu_descriptor_handle Dx12FrameAllocatorDescriptor(dx12_frame_allocator *Allocator, gpu_frame_allocation *Allocation)
+{
+    if (Allocation->Owner)
+    {
+        dx12_frame_buffer *Private = (dx12_frame_buffer*)Allocation->Owner->Private;
+        return GpuDescriptorOffset(&DX12.CBVSRVUAVHeap.Allocator, Private->Descriptors, Allocation->Slice);
+    }
+    return GpuDescriptorOffset(&DX12.CBVSRVUAVHeap.Allocator, Allocator->Descriptors, Allocation->Slice);
+}
+
+ID3D12Resource *Dx12FrameAllocationResource(dx12_frame_allocator *Allocator, gpu_frame_allocation *Allocation, uint64_t *Offset)
+{
+    if (Allocation->Owner)
+    {
+        *Offset = Allocation->Offset;
+        return ((dx12_frame_buffer*)Allocation->Owner->Private)->Resource;
+    }
+    *Offset = (uint64_t)Allocation->Slice * GPU_FRAME_ALLOCATOR_ALIGNMENT;
+    return Allocator->Resource;
+}
+
+gpu_frame_allocation Dx12FrameAllocatorAllocate(dx12_frame_allocator *Allocator, uint64_t Size)
+{
+    gpu_frame_allocation Result = {};
+    uint64_t SliceCount = (Size + GPU_FRAME_ALLOCATOR_ALIGNMENT - 1) / GPU_FRAME_ALLOCATOR_ALIGNMENT;
+
+    // NOTE(amelie.h): Only moves the head when the request fits, so one oversized request doesn't fail everything after it.
+    uint32_t Local = Allocator->Head.load();
+    do
+    {
+        if (Local + SliceCount > GPU_FRAME_ALLOCATOR_SLICES)
+        {
+            LogError("D3D12: Frame allocator ran out of space (%llu slices requested, %u free)!", (unsigned long long)SliceCount, GPU_FRAME_ALLOCATOR_SLICES - Local);
+            return Result;
+        }
+    } while (!Allocator->Head.compare_exchange_weak(Local, Local + (uint32_t)SliceCount));
+
+    Result.Slice = DX12.FrameIndex * GPU_FRAME_ALLOCATOR_SLICES + Local;
+    Result.Size = SliceCount * GPU_FRAME_ALLOCATOR_ALIGNMENT;
+    Result.Offset = (uint64_t)Result.Slice * GPU_FRAME_ALLOCATOR_ALIGNMENT;
+    Result.Data = Allocator->Mapped + Result.Offset;
+    return Result;
+}
+
+gpu_frame_allocation GpuFrameAllocConstant(uint64_t Size)
+{
+    dx12_frame_allocator *Allocator = &DX12.FrameAllocator;
+    gpu_frame_allocation Result = Dx12FrameAllocatorAllocate(Allocator, Size);
+    if (!Result.Data)
+        return Result;
+
+    // NOTE(amelie.h): The view is rewritten on every allocation so it always covers the whole allocation. The frame fence
+    // already guarantees the GPU is done with the previous one.
+    D3D12_CONSTANT_BUFFER_VIEW_DESC Desc = {};
+    Desc.BufferLocation = Allocator->Resource->GetGPUVirtualAddress() + (uint64_t)Result.Slice * GPU_FRAME_ALLOCATOR_ALIGNMENT;
+    Desc.SizeInBytes = (UINT)Result.Size;
+    DX12.Device->CreateConstantBufferView(&Desc, Dx12DescriptorHeapCPU(&DX12.CBVSRVUAVHeap, Dx12FrameAllocatorDescriptor(Allocator, &Result)));
+
+    return Result;
+}
+
+gpu_frame_allocation GpuFrameAllocStructured(uint32_t Count, uint32_t Stride)
+{
+    dx12_frame_allocator *Allocator = &DX12.FrameAllocator;
+    if (!Stride || GPU_FRAME_ALLOCATOR_ALIGNMENT % Stride)
+    {
+        LogError("D3D12: Structured frame allocation stride %u doesn't divide the slice alignment!", Stride);
+        Stride = GPU_FRAME_ALLOCATOR_ALIGNMENT;
+    }
+    gpu_frame_allocation Result = Dx12FrameAllocatorAllocate(Allocator, (uint64_t)Count * Stride);
+    if (!Result.Data)
+        return Result;
+
+    D3D12_SHADER_RESOURCE_VIEW_DESC Desc = {};
+    Desc.Format = DXGI_FORMAT_UNKNOWN;
+    Desc.ViewDimension = D3D12_SRV_DIMENSION_BUFFER;
+    Desc.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
+    Desc.Buffer.FirstElement = (uint64_t)Result.Slice * GPU_FRAME_ALLOCATOR_ALIGNMENT / Stride;
+    Desc.Buffer.NumElements = Count;
+    Desc.Buffer.StructureByteStride = Stride;
+    DX12.Device->CreateShaderResourceView(Allocator->Resource, &Desc, Dx12DescriptorHeapCPU(&DX12.CBVSRVUAVHeap, Dx12FrameAllocatorDescriptor(Allocator, &Result)));
+
+    return Result;
+}
+
+gpu_frame_allocation GpuFrameAllocArguments(uint64_t Size)
+{
+    return Dx12FrameAllocatorAllocate(&DX12.FrameAllocator, Size);
+}
+
+void Dx12FrameBufferCreateView(dx12_frame_buffer *Private, gpu_frame_allocation *Allocation, uint32_t Count, uint32_t Stride)
+{
+    D3D12_SHADER_RESOURCE_VIEW_DESC Desc = {};
+    Desc.Format = DXGI_FORMAT_UNKNOWN;
+    Desc.ViewDimension = D3D12_SRV_DIMENSION_BUFFER;
+    Desc.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
+    Desc.Buffer.FirstElement = Allocation->Offset / Stride;
+    Desc.Buffer.NumElements = Count;
+    Desc.Buffer.StructureByteStride = Stride;
+    gpu_descriptor_handle Descriptor = GpuDescriptorOffset(&DX12.CBVSRVUAVHeap.Allocator, Private->Descriptors, Allocation->Slice);
+    DX12.Device->CreateShaderResourceView(Private->Resource, &Desc, Dx12DescriptorHeapCPU(&DX12.CBVSRVUAVHeap, Descriptor));
+}
+
+void GpuFrameBufferInit(gpu_frame_buffer *Buffer, uint64_t Capacity)
+{
+    dx12_frame_buffer *Private = new dx12_frame_buffer;
+    Private->FrameCount = (uint32_t)DX12.CommandBuffers.size();
+    Private->Descriptors = Dx12DescriptorHeapAllocRange(&DX12.CBVSRVUAVHeap, Private->FrameCount * GPU_FRAME_BUFFER_VIEWS);
+
+    Buffer->Capacity = GpuFrameAlign(Capacity);
+    Buffer->Head = 0;
+    Buffer->ViewCount = 0;
+    Buffer->Private = Private;
+    Dx12FrameAllocatorCreateResource(Buffer->Capacity * Private->FrameCount, &Private->Allocation, &Private->Resource, &Private->Mapped);
+}
+
+void GpuFrameBufferFree(gpu_frame_buffer *Buffer)
+{
+    dx12_frame_buffer *Private = (dx12_frame_buffer*)Buffer->Private;
+    Dx12DescriptorHeapFreeRange(&DX12.CBVSRVUAVHeap, Private->Descriptors, Private->FrameCount * GPU_FRAME_BUFFER_VIEWS);
+    Private->Resource->Unmap(0, nullptr);
+    Private->Allocation->Release();
+    delete Private;
+}
+
+void GpuFrameBufferReset(gpu_frame_buffer *Buffer, uint64_t Size)
+{
+    dx12_frame_buffer *Private = (dx12_frame_buffer*)Buffer->Private;
+    Buffer->Head = 0;
+    Buffer->ViewCount = 0;
+    if (Size <= Buffer->Capacity)
+        return;
+
+    // NOTE(amelie.h): The other regions may still be read by frames in flight, so the GPU has to finish before the old
+    // resource goes away.
+    GpuWait();
+    Private->Resource->Unmap(0, nullptr);
+    Private->Allocation->Release();
+
+    Buffer->Capacity = GpuFrameAlign(HMM_MAX(Size, Buffer->Capacity * 2));
+    Dx12FrameAllocatorCreateResource(Buffer->Capacity * Private->FrameCount, &Private->Allocation, &Private->Resource, &Private->Mapped);
+    LogInfo("D3D12: Frame buffer grown to %llu bytes per frame", Buffer->Capacity);
+}
+
+gpu_frame_allocation Dx12FrameBufferAllocate(gpu_frame_buffer *Buffer, uint64_t Size)
+{
+    dx12_frame_buffer *Private = (dx12_frame_buffer*)Buffer->Private;
+    gpu_frame_allocation Result = {};
+    uint64_t Aligned = GpuFrameAlign(Size);
+    if (Buffer->Head + Aligned > Buffer->Capacity)
+    {
+        LogError("D3D12: Frame buffer ran out of space (%llu bytes requested, %llu free)!", Size, Buffer->Capacity - Buffer->Head);
+        return Result;
+    }
+
+    Result.Owner = Buffer;
+    Result.Size = Aligned;
+    Result.Offset = (uint64_t)DX12.FrameIndex * Buffer->Capacity + Buffer->Head;
+    Result.Data = Private->Mapped + Result.Offset;
+    Buffer->Head += Aligned;
+    return Result;
+}
+
+gpu_frame_allocation GpuFrameBufferAllocStructured(gpu_frame_buffer *Buffer, uint32_t Count, uint32_t Stride)
+{
+    if (!Stride || GPU_FRAME_ALLOCATOR_ALIGNMENT % Stride)
+    {
+        LogError("D3D12: Structured frame buffer allocation stride %u doesn't divide the slice alignment!", Stride);
+        Stride = GPU_FRAME_ALLOCATOR_ALIGNMENT;
+    }
+    if (Buffer->ViewCount == GPU_FRAME_BUFFER_VIEWS)
+    {
+        LogError("D3D12: Frame buffer is out of views (%u per frame)!", GPU_FRAME_BUFFER_VIEWS);
+        return {};
+    }
+
+    gpu_frame_allocation Result = Dx12FrameBufferAllocate(Buffer, (uint64_t)Count * Stride);
+    if (!Result.Data)
+        return Result;
+
+    Result.Slice = DX12.FrameIndex * GPU_FRAME_BUFFER_VIEWS + Buffer->ViewCount++;
+    Dx12FrameBufferCreateView((dx12_frame_buffer*)Buffer->Private, &Result, Count, Stride);
+    return Result;
+}
+
+gpu_frame_allocation GpuFrameBufferAllocArguments(gpu_frame_buffer *Buffer, uint64_t Size)
+{
+    return Dx12FrameBufferAllocate(Buffer, Size);
+}
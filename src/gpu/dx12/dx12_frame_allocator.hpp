@@ -0,0 +1,47 @@
+/**
+ *  Author: Amélie Heinrich
+ *  Company: Amélie Games
+ *  License: MIT
+ *  Create Time: 17/10/2026 14:55
+ */
+
+#pragma once
+
+#include <d3d12.h>
+#include <D3D12MA/D3D12MemAlloc.h>
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+#include "gpu/gpu_descriptor_allocator.hpp"
+#include "gpu/gpu_frame_allocator.hpp"
+
+struct dx12_frame_allocator
+{
+    ID3D12Resource *Resource;
+    D3D12MA::Allocation *Allocation;
+    uint8_t *Mapped;
+    uint32_t FrameCount;
+
+    gpu_descriptor_handle Descriptors;
+    std::atomic<uint32_t> Head;
+};
+
+// NOTE(amelie.h): Private side of a gpu_frame_buffer, FrameCount regions back to back and GPU_FRAME_BUFFER_VIEWS
+// descriptors per frame.
+struct dx12_frame_buffer
+{
+    ID3D12Resource *Resource;
+    D3D12MA::Allocation *Allocation;
+    uint8_t *Mapped;
+    uint32_t FrameCount;
+
+    gpu_descriptor_handle Descriptors;
+};
+
+void Dx12FrameAllocatorInit(dx12_frame_allocator *Allocator, uint32_t FrameCount);
+void Dx12FrameAllocatorFree(dx12_frame_allocator *Allocator);
+void Dx12FrameAllocatorReset(dx12_frame_allocator *Allocator);
+// NOTE(amelie.h): Both work for allocations from the frame allocator and from a gpu_frame_buffer.
+gpu_descriptor_handle Dx12FrameAllocatorDescriptor(dx12_frame_allocator *Allocator, gpu_frame_allocation *Allocation);
+ID3D12Resource *Dx12FrameAllocationResource(dx12_frame_allocator *Allocator, gpu_frame_allocation *Allocation, uint64_t *Offset);
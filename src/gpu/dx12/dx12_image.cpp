@@ -43,7 +43,7 @@ D3D12_RESOURCE_FLAGS GetResourceFlag(gpu_image_usage Usage)
     }
 }
 
-void GpuImageInit(gpu_image *Image, uint32_t Width, uint32_t Height, gpu_image_format Format, gpu_image_usage Usage)
+void Dx12ImageSetup(gpu_image *Image, uint32_t Width, uint32_t Height, gpu_image_format Format, gpu_image_usage Usage)
 {
     Image->Width = Width;
     Image->Height = Height;
@@ -51,6 +51,7 @@ void GpuImageInit(gpu_image *Image, uint32_t Width, uint32_t Height, gpu_image_f
     Image->Usage = Usage;
     Image->Private = new dx12_image;
     dx12_image *Private = (dx12_image*)Image->Private;
+    Private->Allocation = nullptr;
 
     switch (Usage)
     {
@@ -71,10 +72,10 @@ void GpuImageInit(gpu_image *Image, uint32_t Width, uint32_t Height, gpu_image_f
             Private->State = D3D12_RESOURCE_STATE_UNORDERED_ACCESS;
             break;
     }
+}
 
-    D3D12MA::ALLOCATION_DESC HeapProperties = {};
-    HeapProperties.HeapType = D3D12_HEAP_TYPE_DEFAULT;
-
+D3D12_RESOURCE_DESC Dx12ImageDesc(uint32_t Width, uint32_t Height, gpu_image_format Format, gpu_image_usage Usage)
+{
     D3D12_RESOURCE_DESC ResourceDesc = {};
     ResourceDesc.Dimension = D3D12_RESOURCE_DIMENSION_TEXTURE2D;
     ResourceDesc.Alignment = D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT;
@@ -87,33 +88,35 @@ void GpuImageInit(gpu_image *Image, uint32_t Width, uint32_t Height, gpu_image_f
     ResourceDesc.SampleDesc.Quality = 0;
     ResourceDesc.Layout = D3D12_TEXTURE_LAYOUT_UNKNOWN;
     ResourceDesc.Flags = GetResourceFlag(Usage);
+    return ResourceDesc;
+}
 
-    HRESULT Result = DX12.Allocator->CreateResource(&HeapProperties, &ResourceDesc, Private->State, nullptr, &Private->Allocation, IID_PPV_ARGS(&Private->Resource));
-    if (FAILED(Result))
-        LogError("D3D12: Failed to allocate image!");
+void Dx12ImageCreateViews(gpu_image *Image, DXGI_FORMAT Format)
+{
+    dx12_image *Private = (dx12_image*)Image->Private;
 
-    switch (Usage)
+    switch (Image->Usage)
     {
         case gpu_image_usage::ImageUsageRenderTarget:
         {
             Private->RTV = Dx12DescriptorHeapAlloc(&DX12.RTVHeap);
             
             D3D12_RENDER_TARGET_VIEW_DESC RTVDesc = {};
-            RTVDesc.Format = ResourceDesc.Format;
+            RTVDesc.Format = Format;
             RTVDesc.ViewDimension = D3D12_RTV_DIMENSION_TEXTURE2D;
             DX12.Device->CreateRenderTargetView(Private->Resource, &RTVDesc, Dx12DescriptorHeapCPU(&DX12.RTVHeap, Private->RTV));
 
             Private->SRV_UAV = Dx12DescriptorHeapAlloc(&DX12.CBVSRVUAVHeap);
 
             D3D12_SHADER_RESOURCE_VIEW_DESC SRVDesc = {};
-            SRVDesc.Format = ResourceDesc.Format;
+            SRVDesc.Format = Format;
             SRVDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2D;
             SRVDesc.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
             SRVDesc.Texture2D.MipLevels = 1;
             DX12.Device->CreateShaderResourceView(Private->Resource, &SRVDesc, Dx12DescriptorHeapCPU(&DX12.CBVSRVUAVHeap, Private->SRV_UAV));
 
             D3D12_UNORDERED_ACCESS_VIEW_DESC Desc = {};
-            Desc.Format = ResourceDesc.Format;
+            Desc.Format = Format;
             Desc.ViewDimension = D3D12_UAV_DIMENSION_TEXTURE2D;
             DX12.Device->CreateUnorderedAccessView(Private->Resource, nullptr, &Desc, Dx12DescriptorHeapCPU(&DX12.CBVSRVUAVHeap, Private->SRV_UAV));
             break;
@@ -123,7 +126,7 @@ void GpuImageInit(gpu_image *Image, uint32_t Width, uint32_t Height, gpu_image_f
             Private->DSV = Dx12DescriptorHeapAlloc(&DX12.DSVHeap);
 
             D3D12_DEPTH_STENCIL_VIEW_DESC DSVDesc = {};
-            DSVDesc.Format = ResourceDesc.Format;
+            DSVDesc.Format = Format;
             DSVDesc.ViewDimension = D3D12_DSV_DIMENSION_TEXTURE2D;
             DX12.Device->CreateDepthStencilView(Private->Resource, &DSVDesc, Dx12DescriptorHeapCPU(&DX12.DSVHeap, Private->DSV));
             break;
@@ -133,7 +136,7 @@ void GpuImageInit(gpu_image *Image, uint32_t Width, uint32_t Height, gpu_image_f
             Private->SRV_UAV = Dx12DescriptorHeapAlloc(&DX12.CBVSRVUAVHeap);
 
             D3D12_SHADER_RESOURCE_VIEW_DESC Desc = {};
-            Desc.Format = ResourceDesc.Format;
+            Desc.Format = Format;
             Desc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2D;
             Desc.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
             Desc.Texture2D.MipLevels = 1;
@@ -145,7 +148,7 @@ void GpuImageInit(gpu_image *Image, uint32_t Width, uint32_t Height, gpu_image_f
             Private->SRV_UAV = Dx12DescriptorHeapAlloc(&DX12.CBVSRVUAVHeap);
 
             D3D12_UNORDERED_ACCESS_VIEW_DESC Desc = {};
-            Desc.Format = ResourceDesc.Format;
+            Desc.Format = Format;
             Desc.ViewDimension = D3D12_UAV_DIMENSION_TEXTURE2D;
             DX12.Device->CreateUnorderedAccessView(Private->Resource, nullptr, &Desc, Dx12DescriptorHeapCPU(&DX12.CBVSRVUAVHeap, Private->SRV_UAV));
             break;
@@ -153,6 +156,77 @@ void GpuImageInit(gpu_image *Image, uint32_t Width, uint32_t Height, gpu_image_f
     }
 }
 
+void GpuImageInit(gpu_image *Image, uint32_t Width, uint32_t Height, gpu_image_format Format, gpu_image_usage Usage)
+{
+    Dx12ImageSetup(Image, Width, Height, Format, Usage);
+    dx12_image *Private = (dx12_image*)Image->Private;
+
+    D3D12MA::ALLOCATION_DESC HeapProperties = {};
+    HeapProperties.HeapType = D3D12_HEAP_TYPE_DEFAULT;
+
+    D3D12_RESOURCE_DESC ResourceDesc = Dx12ImageDesc(Width, Height, Format, Usage);
+    HRESULT Result = DX12.Allocator->CreateResource(&HeapProperties, &ResourceDesc, Private->State, nullptr, &Private->Allocation, IID_PPV_ARGS(&Private->Resource));
+    if (FAILED(Result))
+        LogError("D3D12: Failed to allocate image!");
+
+    Dx12ImageCreateViews(Image, ResourceDesc.Format);
+}
+
+void GpuMemoryInit(gpu_memory *Memory, uint64_t Size)
+{
+    Memory->Size = Size;
+    Memory->Private = new dx12_memory;
+    dx12_memory *Private = (dx12_memory*)Memory->Private;
+
+    // NOTE(amelie.h): Tier 1 heaps can't mix resource kinds, placed images are render and depth targets only.
+    D3D12MA::ALLOCATION_DESC AllocationDesc = {};
+    AllocationDesc.HeapType = D3D12_HEAP_TYPE_DEFAULT;
+    AllocationDesc.ExtraHeapFlags = D3D12_HEAP_FLAG_ALLOW_ONLY_RT_DS_TEXTURES;
+
+    D3D12_RESOURCE_ALLOCATION_INFO AllocationInfo = {};
+    AllocationInfo.SizeInBytes = Size;
+    AllocationInfo.Alignment = D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT;
+
+    HRESULT Result = DX12.Allocator->AllocateMemory(&AllocationDesc, &AllocationInfo, &Private->Allocation);
+    if (FAILED(Result))
+        LogError("D3D12: Failed to allocate %llu bytes of image memory!", Size);
+}
+
+void GpuMemoryFree(gpu_memory *Memory)
+{
+    dx12_memory *Private = (dx12_memory*)Memory->Private;
+    SafeRelease(Private->Allocation);
+    delete Private;
+}
+
+gpu_image_memory_info GpuImageGetMemoryInfo(uint32_t Width, uint32_t Height, gpu_image_format Format, gpu_image_usage Usage)
+{
+    D3D12_RESOURCE_DESC ResourceDesc = Dx12ImageDesc(Width, Height, Format, Usage);
+    D3D12_RESOURCE_ALLOCATION_INFO AllocationInfo = DX12.Device->GetResourceAllocationInfo(0, 1, &ResourceDesc);
+
+    gpu_image_memory_info Info;
+    Info.Size = AllocationInfo.SizeInBytes;
+    Info.Alignment = AllocationInfo.Alignment;
+    return Info;
+}
+
+void GpuImageInitPlaced(gpu_image *Image, uint32_t Width, uint32_t Height, gpu_image_format Format, gpu_image_usage Usage, gpu_memory *Memory, uint64_t Offset)
+{
+    if (Usage != gpu_image_usage::ImageUsageRenderTarget && Usage != gpu_image_usage::ImageUsageDepthTarget)
+        LogError("D3D12: Only render and depth targets can be placed in image memory!");
+
+    Dx12ImageSetup(Image, Width, Height, Format, Usage);
+    dx12_image *Private = (dx12_image*)Image->Private;
+    dx12_memory *MemoryPrivate = (dx12_memory*)Memory->Private;
+
+    D3D12_RESOURCE_DESC ResourceDesc = Dx12ImageDesc(Width, Height, Format, Usage);
+    HRESULT Result = DX12.Allocator->CreateAliasingResource(MemoryPrivate->Allocation, Offset, &ResourceDesc, Private->State, nullptr, IID_PPV_ARGS(&Private->Resource));
+    if (FAILED(Result))
+        LogError("D3D12: Failed to place image at offset %llu!", Offset);
+
+    Dx12ImageCreateViews(Image, ResourceDesc.Format);
+}
+
 void GpuImageInitCopy(gpu_image *Image, uint32_t Width, uint32_t Height)
 {
     Image->Width = Width;
@@ -257,22 +331,10 @@ void GpuImageInitFromCPU(gpu_image *Image, cpu_image *CPU)
 {
     GpuImageInit(Image, CPU->Width, CPU->Height, CPU->Float ? gpu_image_format::RGBA32Float : gpu_image_format::RGBA8, gpu_image_usage::ImageUsageShaderResource);
     
-    float SizeType = CPU->Float ? 4 : 1;
-
-    gpu_buffer Temp;
-    GpuBufferInit(&Temp, CPU->Width * CPU->Height * SizeType * 4, 0, gpu_buffer_type::Vertex);
-    GpuBufferUpload(&Temp, CPU->Data, CPU->Width * CPU->Height * SizeType * 4);
-
-    gpu_command_buffer CommandBuffer;
-    GpuCommandBufferInit(&CommandBuffer, gpu_command_buffer_type::Upload);
-    GpuCommandBufferBegin(&CommandBuffer);
-    GpuCommandBufferBufferBarrier(&CommandBuffer, &Temp, gpu_buffer_layout::ImageLayoutCommon, gpu_buffer_layout::ImageLayoutCopySource);
-    GpuCommandBufferCopyBufferToTexture(&CommandBuffer, &Temp, Image);
-    GpuCommandBufferEnd(&CommandBuffer);
-    GpuCommandBufferFlush(&CommandBuffer);
-    GpuCommandBufferFree(&CommandBuffer);
-
-    GpuBufferFree(&Temp);
+    uint64_t SizeType = CPU->Float ? 4 : 1;
+
+    dx12_image *Private = (dx12_image*)Image->Private;
+    Dx12UploaderTexture(&DX12.Uploader, Private->Resource, CPU->Data, CPU->Width * SizeType * 4);
 }
 
 void GpuImageFree(gpu_image *Image)
@@ -285,6 +347,7 @@ void GpuImageFree(gpu_image *Image)
             break;
         case gpu_image_usage::ImageUsageRenderTarget:
             Dx12DescriptorHeapFreeSpace(&DX12.RTVHeap, Private->RTV);
+            Dx12DescriptorHeapFreeSpace(&DX12.CBVSRVUAVHeap, Private->SRV_UAV);
             break;
         case gpu_image_usage::ImageUsageDepthTarget:
             Dx12DescriptorHeapFreeSpace(&DX12.DSVHeap, Private->DSV);
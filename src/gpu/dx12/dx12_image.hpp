@@ -18,9 +18,14 @@ struct dx12_image
     D3D12MA::Allocation *Allocation;
     D3D12_RESOURCE_STATES State;
 
-    uint32_t RTV;
-    uint32_t DSV;
-    uint32_t SRV_UAV;
+    gpu_descriptor_handle RTV;
+    gpu_descriptor_handle DSV;
+    gpu_descriptor_handle SRV_UAV;
+};
+
+struct dx12_memory
+{
+    D3D12MA::Allocation *Allocation;
 };
 
 DXGI_FORMAT GetDXGIFormat(gpu_image_format Format);
@@ -10,6 +10,9 @@
 #include "dx12_context.hpp"
 #include "dx12_shader.hpp"
 #include "dx12_image.hpp"
+#include "gpu/gpu_command_buffer.hpp"
+#include "gpu/gpu_pipeline_cache.hpp"
+#include "systems/hash_system.hpp"
 #include "systems/log_system.hpp"
 #include "windows/windows_data.hpp"
 
@@ -56,11 +59,211 @@ D3D12_COMPARISON_FUNC GetDx12ComparisonFunc(depth_func Func)
     }
 }
 
+DXGI_FORMAT GetDx12VertexFormat(gpu_vertex_format Format)
+{
+    switch (Format)
+    {
+        case gpu_vertex_format::Float2:
+            return DXGI_FORMAT_R32G32_FLOAT;
+        case gpu_vertex_format::Float3:
+            return DXGI_FORMAT_R32G32B32_FLOAT;
+        case gpu_vertex_format::Float4:
+            return DXGI_FORMAT_R32G32B32A32_FLOAT;
+        case gpu_vertex_format::Half2:
+            return DXGI_FORMAT_R16G16_FLOAT;
+        case gpu_vertex_format::Half4:
+            return DXGI_FORMAT_R16G16B16A16_FLOAT;
+        case gpu_vertex_format::SNorm16x2:
+            return DXGI_FORMAT_R16G16_SNORM;
+        case gpu_vertex_format::SNorm16x4:
+            return DXGI_FORMAT_R16G16B16A16_SNORM;
+        case gpu_vertex_format::UNorm16x2:
+            return DXGI_FORMAT_R16G16_UNORM;
+        case gpu_vertex_format::UNorm16x4:
+            return DXGI_FORMAT_R16G16B16A16_UNORM;
+    }
+    return DXGI_FORMAT_UNKNOWN;
+}
+
+static_assert(sizeof(gpu_draw_indexed_arguments) == sizeof(uint32_t) + sizeof(D3D12_DRAW_INDEXED_ARGUMENTS), "Indirect draw arguments must match the command signature!");
+
 bool CompareShaderInput(const D3D12_SHADER_INPUT_BIND_DESC& A, const D3D12_SHADER_INPUT_BIND_DESC& B)
 {
     return A.BindPoint < B.BindPoint;
 }
 
+uint64_t Dx12PipelineHash(gpu_pipeline *Pipeline)
+{
+    dx12_shader *ShaderPrivate = (dx12_shader*)Pipeline->Info.Shader->Private;
+
+    uint64_t Hash = GpuPipelineCacheHashInfo(&Pipeline->Info);
+    if (Pipeline->Info.Type == gpu_pipeline_type::Graphics)
+    {
+        Hash = HashFNV1a(ShaderPrivate->VertexBlob.Data, ShaderPrivate->VertexBlob.Size, Hash);
+        Hash = HashFNV1a(ShaderPrivate->PixelBlob.Data, ShaderPrivate->PixelBlob.Size, Hash);
+    }
+    else
+    {
+        Hash = HashFNV1a(ShaderPrivate->ComputeBlob.Data, ShaderPrivate->ComputeBlob.Size, Hash);
+    }
+    return Hash;
+}
+
+uint64_t Dx12PipelineHashRootSignature(const D3D12_ROOT_SIGNATURE_DESC *Desc)
+{
+    uint64_t Hash = HashFNV1a(&Desc->Flags, sizeof(Desc->Flags));
+    Hash = HashFNV1a(&Desc->NumParameters, sizeof(Desc->NumParameters), Hash);
+    for (uint32_t ParameterIndex = 0; ParameterIndex < Desc->NumParameters; ParameterIndex++)
+    {
+        const D3D12_ROOT_PARAMETER& Parameter = Desc->pParameters[ParameterIndex];
+        Hash = HashFNV1a(&Parameter.ParameterType, sizeof(Parameter.ParameterType), Hash);
+        Hash = HashFNV1a(&Parameter.ShaderVisibility, sizeof(Parameter.ShaderVisibility), Hash);
+        switch (Parameter.ParameterType)
+        {
+            case D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE:
+                Hash = HashFNV1a(&Parameter.DescriptorTable.NumDescriptorRanges, sizeof(Parameter.DescriptorTable.NumDescriptorRanges), Hash);
+                Hash = HashFNV1a(Parameter.DescriptorTable.pDescriptorRanges, Parameter.DescriptorTable.NumDescriptorRanges * sizeof(D3D12_DESCRIPTOR_RANGE), Hash);
+                break;
+            case D3D12_ROOT_PARAMETER_TYPE_32BIT_CONSTANTS:
+                Hash = HashFNV1a(&Parameter.Constants, sizeof(Parameter.Constants), Hash);
+                break;
+            default:
+                Hash = HashFNV1a(&Parameter.Descriptor, sizeof(Parameter.Descriptor), Hash);
+                break;
+        }
+    }
+    Hash = HashFNV1a(&Desc->NumStaticSamplers, sizeof(Desc->NumStaticSamplers), Hash);
+    return HashFNV1a(Desc->pStaticSamplers, Desc->NumStaticSamplers * sizeof(D3D12_STATIC_SAMPLER_DESC), Hash);
+}
+
+// NOTE(amelie.h): The serialized blob is cached under a hash of the description, not of the pipeline, so changing how
+// root signatures are built can't pick up an old blob. The object is shared by every pipeline with the same description.
+// Returns a new reference.
+ID3D12RootSignature *Dx12PipelineGetRootSignature(const D3D12_ROOT_SIGNATURE_DESC *Desc)
+{
+    gpu_pipeline_cache *Cache = &DX12.PipelineCache;
+    uint64_t Key = HashString("RootSignature", Dx12PipelineHashRootSignature(Desc));
+
+    ID3D12RootSignature *&Signature = DX12.RootSignatures[Key];
+    if (Signature)
+    {
+        Signature->AddRef();
+        return Signature;
+    }
+
+    const std::vector<uint8_t> *Cached = GpuPipelineCacheFind(Cache, Key);
+    if (Cached && FAILED(DX12.Device->CreateRootSignature(0, Cached->data(), Cached->size(), IID_PPV_ARGS(&Signature))))
+    {
+        Cache->Stats.Stale++;
+        Signature = nullptr;
+        Cached = nullptr;
+    }
+
+    if (!Cached)
+    {
+        ID3DBlob *RootSignatureBlob = nullptr;
+        ID3DBlob *ErrorBlob = nullptr;
+        D3D12SerializeRootSignature(Desc, D3D_ROOT_SIGNATURE_VERSION_1_0, &RootSignatureBlob, &ErrorBlob);
+        if (ErrorBlob)
+        {
+            LogError("D3D12: Failed to serialize root signature! %s", ErrorBlob->GetBufferPointer());
+            ErrorBlob->Release();
+        }
+        if (!RootSignatureBlob)
+        {
+            DX12.RootSignatures.erase(Key);
+            return nullptr;
+        }
+
+        GpuPipelineCacheStore(Cache, Key, RootSignatureBlob->GetBufferPointer(), RootSignatureBlob->GetBufferSize());
+        HRESULT Result = DX12.Device->CreateRootSignature(0, RootSignatureBlob->GetBufferPointer(), RootSignatureBlob->GetBufferSize(), IID_PPV_ARGS(&Signature));
+        RootSignatureBlob->Release();
+        if (FAILED(Result))
+        {
+            LogError("D3D12: Failed to create root signature!");
+            DX12.RootSignatures.erase(Key);
+            return nullptr;
+        }
+    }
+
+    Signature->AddRef();
+    return Signature;
+}
+
+void Dx12PipelineStoreState(ID3D12PipelineState *State, uint64_t Key)
+{
+    ID3DBlob *CachedBlob = nullptr;
+    if (FAILED(State->GetCachedBlob(&CachedBlob)))
+    {
+        LogWarn("D3D12: Failed to get cached pipeline blob!");
+        return;
+    }
+    GpuPipelineCacheStore(&DX12.PipelineCache, Key, CachedBlob->GetBufferPointer(), CachedBlob->GetBufferSize());
+    CachedBlob->Release();
+}
+
+// NOTE(amelie.h): A cached blob lets the driver skip compiling the pipeline. It is refused when the driver or GPU
+// changed since it was written, then the pipeline is compiled again and the blob replaced.
+ID3D12PipelineState *Dx12PipelineCreateGraphicsState(D3D12_GRAPHICS_PIPELINE_STATE_DESC *Desc, uint64_t Key)
+{
+    gpu_pipeline_cache *Cache = &DX12.PipelineCache;
+    ID3D12PipelineState *State = nullptr;
+
+    const std::vector<uint8_t> *Cached = GpuPipelineCacheFind(Cache, Key);
+    if (Cached)
+    {
+        Desc->CachedPSO.pCachedBlob = Cached->data();
+        Desc->CachedPSO.CachedBlobSizeInBytes = Cached->size();
+        if (SUCCEEDED(DX12.Device->CreateGraphicsPipelineState(Desc, IID_PPV_ARGS(&State))))
+        {
+            Cache->Stats.Hits++;
+            return State;
+        }
+        Cache->Stats.Stale++;
+        Desc->CachedPSO = {};
+    }
+
+    Cache->Stats.Misses++;
+    HRESULT Result = DX12.Device->CreateGraphicsPipelineState(Desc, IID_PPV_ARGS(&State));
+    if (FAILED(Result))
+    {
+        LogError("D3D12: Failed to create graphics pipeline state!");
+        return nullptr;
+    }
+    Dx12PipelineStoreState(State, Key);
+    return State;
+}
+
+ID3D12PipelineState *Dx12PipelineCreateComputeState(D3D12_COMPUTE_PIPELINE_STATE_DESC *Desc, uint64_t Key)
+{
+    gpu_pipeline_cache *Cache = &DX12.PipelineCache;
+    ID3D12PipelineState *State = nullptr;
+
+    const std::vector<uint8_t> *Cached = GpuPipelineCacheFind(Cache, Key);
+    if (Cached)
+    {
+        Desc->CachedPSO.pCachedBlob = Cached->data();
+        Desc->CachedPSO.CachedBlobSizeInBytes = Cached->size();
+        if (SUCCEEDED(DX12.Device->CreateComputePipelineState(Desc, IID_PPV_ARGS(&State))))
+        {
+            Cache->Stats.Hits++;
+            return State;
+        }
+        Cache->Stats.Stale++;
+        Desc->CachedPSO = {};
+    }
+
+    Cache->Stats.Misses++;
+    HRESULT Result = DX12.Device->CreateComputePipelineState(Desc, IID_PPV_ARGS(&State));
+    if (FAILED(Result))
+    {
+        LogError("D3D12: Failed to create compute pipeline state!");
+        return nullptr;
+    }
+    Dx12PipelineStoreState(State, Key);
+    return State;
+}
+
 void GpuPipelineCreateGraphics(gpu_pipeline *Pipeline)
 {
     Pipeline->Private = new dx12_pipeline;
@@ -68,6 +271,7 @@ void GpuPipelineCreateGraphics(gpu_pipeline *Pipeline)
 
     dx12_pipeline *PipelinePrivate = (dx12_pipeline*)Pipeline->Private;
     dx12_shader *ShaderPrivate = (dx12_shader*)Pipeline->Info.Shader->Private;
+    uint64_t Key = Dx12PipelineHash(Pipeline);
 
     ID3D12ShaderReflection* VertexReflection = nullptr;
     D3D12_SHADER_DESC VertexDesc;
@@ -118,6 +322,8 @@ void GpuPipelineCreateGraphics(gpu_pipeline *Pipeline)
     for (int ShaderBindIndex = 0; ShaderBindIndex < BindCount; ShaderBindIndex++)
     {
         auto ShaderInputBindDesc = ShaderBinds[ShaderBindIndex];
+        if (ShaderInputBindDesc.Type == D3D_SIT_CBUFFER && ShaderInputBindDesc.Space == 1)
+            continue;
 
         D3D12_ROOT_PARAMETER RootParameter = {};
         RootParameter.ParameterType = D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE;
@@ -132,6 +338,7 @@ void GpuPipelineCreateGraphics(gpu_pipeline *Pipeline)
                 Range.RangeType = D3D12_DESCRIPTOR_RANGE_TYPE_SAMPLER;
                 break;
             case D3D_SIT_TEXTURE:
+            case D3D_SIT_STRUCTURED:
                 Range.RangeType = D3D12_DESCRIPTOR_RANGE_TYPE_SRV;
                 break;
             case D3D_SIT_UAV_RWTYPED:
@@ -151,25 +358,42 @@ void GpuPipelineCreateGraphics(gpu_pipeline *Pipeline)
         RootParameter.DescriptorTable.pDescriptorRanges = &Ranges[RangeCount];
         RootParameter.ShaderVisibility = D3D12_SHADER_VISIBILITY_ALL;
         Parameters[ParameterCount] = RootParameter;
+        PipelinePrivate->Bindings[ShaderInputBindDesc.Name] = ParameterCount;
 
         ParameterCount++;
         RangeCount++;
     }
 
+    // NOTE(amelie.h): The draw constant goes after the reflected tables so it doesn't shift their indices.
+    D3D12_ROOT_PARAMETER DrawConstant = {};
+    DrawConstant.ParameterType = D3D12_ROOT_PARAMETER_TYPE_32BIT_CONSTANTS;
+    DrawConstant.Constants.ShaderRegister = 0;
+    DrawConstant.Constants.RegisterSpace = 1;
+    DrawConstant.Constants.Num32BitValues = 1;
+    DrawConstant.ShaderVisibility = D3D12_SHADER_VISIBILITY_ALL;
+    PipelinePrivate->DrawConstantIndex = ParameterCount;
+    Parameters[ParameterCount++] = DrawConstant;
+
     D3D12_ROOT_SIGNATURE_DESC RootSignatureDesc = {};
     RootSignatureDesc.NumParameters = ParameterCount;
     RootSignatureDesc.pParameters = Parameters.data();
     RootSignatureDesc.Flags = D3D12_ROOT_SIGNATURE_FLAG_ALLOW_INPUT_ASSEMBLER_INPUT_LAYOUT;
-
-    ID3DBlob *RootSignatureBlob;
-    ID3DBlob *ErrorBlob;
-    D3D12SerializeRootSignature(&RootSignatureDesc, D3D_ROOT_SIGNATURE_VERSION_1_0, &RootSignatureBlob, &ErrorBlob);
-    if (ErrorBlob)
-        LogError("D3D12: Failed to serialize root signature! %s", ErrorBlob->GetBufferPointer());
-    Result = DX12.Device->CreateRootSignature(0, RootSignatureBlob->GetBufferPointer(), RootSignatureBlob->GetBufferSize(), IID_PPV_ARGS(&PipelinePrivate->Signature));
+    PipelinePrivate->Signature = Dx12PipelineGetRootSignature(&RootSignatureDesc);
+
+    D3D12_INDIRECT_ARGUMENT_DESC IndirectArguments[2] = {};
+    IndirectArguments[0].Type = D3D12_INDIRECT_ARGUMENT_TYPE_CONSTANT;
+    IndirectArguments[0].Constant.RootParameterIndex = PipelinePrivate->DrawConstantIndex;
+    IndirectArguments[0].Constant.DestOffsetIn32BitValues = 0;
+    IndirectArguments[0].Constant.Num32BitValuesToSet = 1;
+    IndirectArguments[1].Type = D3D12_INDIRECT_ARGUMENT_TYPE_DRAW_INDEXED;
+
+    D3D12_COMMAND_SIGNATURE_DESC CommandSignatureDesc = {};
+    CommandSignatureDesc.ByteStride = sizeof(gpu_draw_indexed_arguments);
+    CommandSignatureDesc.NumArgumentDescs = 2;
+    CommandSignatureDesc.pArgumentDescs = IndirectArguments;
+    Result = DX12.Device->CreateCommandSignature(&CommandSignatureDesc, PipelinePrivate->Signature, IID_PPV_ARGS(&PipelinePrivate->DrawSignature));
     if (FAILED(Result))
-        LogError("D3D12: Failed to create root signature!");
-    RootSignatureBlob->Release();
+        LogError("D3D12: Failed to create indirect draw command signature!");
 
     D3D12_GRAPHICS_PIPELINE_STATE_DESC Desc = {};
     Desc.VS.pShaderBytecode = ShaderPrivate->VertexBlob.Data;
@@ -249,15 +473,30 @@ void GpuPipelineCreateGraphics(gpu_pipeline *Pipeline)
             else if (ParameterDesc.ComponentType == D3D_REGISTER_COMPONENT_FLOAT32) InputElement.Format = DXGI_FORMAT_R32G32B32A32_FLOAT;
         }
 
+        // NOTE(amelie.h): Compressed layouts override the reflected float format, the input assembler expands them for the shader.
+        if (!Pipeline->Info.VertexAttributes.empty())
+        {
+            auto Attribute = std::find_if(Pipeline->Info.VertexAttributes.begin(), Pipeline->Info.VertexAttributes.end(), [&](const gpu_vertex_attribute& Attribute) {
+                return InputElementSemanticNames.back() == Attribute.Semantic;
+            });
+            if (Attribute == Pipeline->Info.VertexAttributes.end())
+            {
+                LogError("D3D12: Vertex shader input %s has no matching vertex attribute!", ParameterDesc.SemanticName);
+            }
+            else
+            {
+                InputElement.Format = GetDx12VertexFormat(Attribute->Format);
+                InputElement.AlignedByteOffset = Attribute->Offset;
+            }
+        }
+
         InputElementDescs.push_back(InputElement);
     }
     Desc.InputLayout.pInputElementDescs = InputElementDescs.data();
     Desc.InputLayout.NumElements = static_cast<uint32_t>(InputElementDescs.size());
     Desc.pRootSignature = PipelinePrivate->Signature;
 
-    Result = DX12.Device->CreateGraphicsPipelineState(&Desc, IID_PPV_ARGS(&PipelinePrivate->Pipeline));
-    if (FAILED(Result)) 
-        LogError("D3D12: Failed to create graphics pipeline state!");
+    PipelinePrivate->Pipeline = Dx12PipelineCreateGraphicsState(&Desc, Key);
 
     SafeRelease(PixelReflection);
     SafeRelease(VertexReflection);
@@ -270,6 +509,9 @@ void GpuPipelineCreateCompute(gpu_pipeline *Pipeline)
 
     dx12_pipeline *PipelinePrivate = (dx12_pipeline*)Pipeline->Private;
     dx12_shader *ShaderPrivate = (dx12_shader*)Pipeline->Info.Shader->Private;
+    uint64_t Key = Dx12PipelineHash(Pipeline);
+    PipelinePrivate->DrawSignature = nullptr;
+    PipelinePrivate->DrawConstantIndex = -1;
 
     ID3D12ShaderReflection* ComputeReflection = nullptr;
     D3D12_SHADER_DESC ComputeDesc;
@@ -315,6 +557,7 @@ void GpuPipelineCreateCompute(gpu_pipeline *Pipeline)
                 Range.RangeType = D3D12_DESCRIPTOR_RANGE_TYPE_SAMPLER;
                 break;
             case D3D_SIT_TEXTURE:
+            case D3D_SIT_STRUCTURED:
                 Range.RangeType = D3D12_DESCRIPTOR_RANGE_TYPE_SRV;
                 break;
             case D3D_SIT_UAV_RWTYPED:
@@ -334,6 +577,7 @@ void GpuPipelineCreateCompute(gpu_pipeline *Pipeline)
         RootParameter.DescriptorTable.pDescriptorRanges = &Ranges[RangeCount];
         RootParameter.ShaderVisibility = D3D12_SHADER_VISIBILITY_ALL;
         Parameters[ParameterCount] = RootParameter;
+        PipelinePrivate->Bindings[ShaderInputBindDesc.Name] = ParameterCount;
 
         ParameterCount++;
         RangeCount++;
@@ -343,30 +587,20 @@ void GpuPipelineCreateCompute(gpu_pipeline *Pipeline)
     RootSignatureDesc.NumParameters = ParameterCount;
     RootSignatureDesc.pParameters = Parameters.data();
     RootSignatureDesc.Flags = D3D12_ROOT_SIGNATURE_FLAG_ALLOW_INPUT_ASSEMBLER_INPUT_LAYOUT;
-
-    ID3DBlob *RootSignatureBlob;
-    ID3DBlob *ErrorBlob;
-    D3D12SerializeRootSignature(&RootSignatureDesc, D3D_ROOT_SIGNATURE_VERSION_1_0, &RootSignatureBlob, &ErrorBlob);
-    if (ErrorBlob)
-        LogError("D3D12: Failed to serialize root signature! %s", ErrorBlob->GetBufferPointer());
-    Result = DX12.Device->CreateRootSignature(0, RootSignatureBlob->GetBufferPointer(), RootSignatureBlob->GetBufferSize(), IID_PPV_ARGS(&PipelinePrivate->Signature));
-    if (FAILED(Result))
-        LogError("D3D12: Failed to create root signature!");
-    RootSignatureBlob->Release();
+    PipelinePrivate->Signature = Dx12PipelineGetRootSignature(&RootSignatureDesc);
 
     D3D12_COMPUTE_PIPELINE_STATE_DESC Desc = {};
     Desc.CS.pShaderBytecode = ShaderPrivate->ComputeBlob.Data;
     Desc.CS.BytecodeLength = ShaderPrivate->ComputeBlob.Size;
     Desc.pRootSignature = PipelinePrivate->Signature;
 
-    Result = DX12.Device->CreateComputePipelineState(&Desc, IID_PPV_ARGS(&PipelinePrivate->Pipeline));
-    if (FAILED(Result)) 
-        LogError("D3D12: Failed to create compute pipeline state!");
+    PipelinePrivate->Pipeline = Dx12PipelineCreateComputeState(&Desc, Key);
 }
 
 void GpuPipelineFree(gpu_pipeline *Pipeline)
 {
     dx12_pipeline *PipelinePrivate = (dx12_pipeline*)Pipeline->Private;
+    SafeRelease(PipelinePrivate->DrawSignature);
     SafeRelease(PipelinePrivate->Signature);
     SafeRelease(PipelinePrivate->Pipeline);
     delete Pipeline->Private;
@@ -375,5 +609,11 @@ void GpuPipelineFree(gpu_pipeline *Pipeline)
 int GpuPipelineGetDescriptor(gpu_pipeline *Pipeline, const std::string& Name)
 {
     dx12_pipeline *PipelinePrivate = (dx12_pipeline*)Pipeline->Private;
-    return PipelinePrivate->Bindings[Name];
+    auto Binding = PipelinePrivate->Bindings.find(Name);
+    if (Binding == PipelinePrivate->Bindings.end())
+    {
+        LogError("D3D12: Pipeline has no binding named %s!", Name.c_str());
+        return -1;
+    }
+    return Binding->second;
 }
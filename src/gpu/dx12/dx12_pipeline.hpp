@@ -17,6 +17,11 @@ struct dx12_pipeline
 {
     ID3D12RootSignature *Signature;
     ID3D12PipelineState *Pipeline;
+
+    // NOTE(amelie.h): Graphics only. Indirect draws write the draw constant at DrawConstantIndex before every draw.
+    ID3D12CommandSignature *DrawSignature;
+    int DrawConstantIndex;
     
+    // NOTE(amelie.h): Root parameter index of every reflected resource by its name in the shader.
     std::unordered_map<std::string, int> Bindings;
 };
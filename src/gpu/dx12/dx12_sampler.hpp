@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include "gpu/gpu_descriptor_allocator.hpp"
 #include "gpu/gpu_sampler.hpp"
 
 #include <d3d12.h>
@@ -15,5 +16,5 @@
 struct dx12_sampler
 {
     D3D12_SAMPLER_DESC Desc;
-    uint32_t Descriptor;
+    gpu_descriptor_handle Descriptor;
 };
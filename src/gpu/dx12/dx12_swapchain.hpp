@@ -18,7 +18,7 @@ struct dx12_swapchain
 {
     IDXGISwapChain3 *SwapChain;
     std::vector<ID3D12Resource*> Buffers;
-    std::vector<int> RenderTargets;
+    std::vector<gpu_descriptor_handle> RenderTargets;
     std::vector<gpu_image> Images;
 };
 
@@ -0,0 +1,260 @@
+/**
+ *  Author: Amélie Heinrich
+ *  Company: Amélie Games
+ *  License: MIT
+ *  Create Time: 17/10/2026 14:25
+ */
+
+#include "dx12_uploader.hpp"
+
+#include "dx12_command_buffer.hpp"
+#include "dx12_context.hpp"
+#include "systems/log_system.hpp"
+#include "windows/windows_data.hpp"
+
+#include <cstring>
+
+uint64_t Dx12UploaderAlign(uint64_t Value, uint64_t Alignment)
+{
+    return (Value + Alignment - 1) & ~(Alignment - 1);
+}
+
+D3D12MA::Allocation *Dx12UploaderCreateStaging(uint64_t Size)
+{
+    D3D12MA::ALLOCATION_DESC AllocDesc = {};
+    AllocDesc.HeapType = D3D12_HEAP_TYPE_UPLOAD;
+
+    D3D12_RESOURCE_DESC ResourceDesc = {};
+    ResourceDesc.Dimension = D3D12_RESOURCE_DIMENSION_BUFFER;
+    ResourceDesc.Alignment = D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT;
+    ResourceDesc.Width = Size;
+    ResourceDesc.Height = 1;
+    ResourceDesc.DepthOrArraySize = 1;
+    ResourceDesc.MipLevels = 1;
+    ResourceDesc.Format = DXGI_FORMAT_UNKNOWN;
+    ResourceDesc.SampleDesc.Count = 1;
+    ResourceDesc.SampleDesc.Quality = 0;
+    ResourceDesc.Layout = D3D12_TEXTURE_LAYOUT_ROW_MAJOR;
+    ResourceDesc.Flags = D3D12_RESOURCE_FLAG_NONE;
+
+    D3D12MA::Allocation *Allocation = nullptr;
+    HRESULT Result = DX12.Allocator->CreateResource(&AllocDesc, &ResourceDesc, D3D12_RESOURCE_STATE_GENERIC_READ, nullptr, &Allocation, IID_NULL, nullptr);
+    if (FAILED(Result))
+        LogError("D3D12: Failed to allocate staging buffer of size %llu!", Size);
+    return Allocation;
+}
+
+void Dx12UploaderInit(dx12_uploader *Uploader, uint64_t Size)
+{
+    Uploader->Size = Size;
+    Uploader->Head = 0;
+    Uploader->Tail = 0;
+    Uploader->Current = nullptr;
+    Uploader->PendingCopies = 0;
+    Uploader->LastSubmitted = 0;
+
+    Uploader->Allocation = Dx12UploaderCreateStaging(Size);
+    Uploader->Ring = Uploader->Allocation->GetResource();
+
+    // NOTE(amelie.h): Upload heaps can stay mapped for their whole lifetime, so we map once and keep the pointer.
+    D3D12_RANGE ReadRange = { 0, 0 };
+    HRESULT Result = Uploader->Ring->Map(0, &ReadRange, (void**)&Uploader->Mapped);
+    if (FAILED(Result))
+        LogError("D3D12: Failed to map upload ring!");
+}
+
+void Dx12UploaderRetire(dx12_uploader *Uploader)
+{
+    while (!Uploader->InFlight.empty() && Dx12FenceReached(&DX12.UploadFence, Uploader->InFlight.front()->FenceValue))
+    {
+        dx12_upload_batch *Batch = Uploader->InFlight.front();
+        Uploader->InFlight.pop_front();
+
+        Uploader->Tail = Batch->RingEnd;
+        for (auto Allocation : Batch->Overflow)
+            Allocation->Release();
+        Batch->Overflow.clear();
+        Uploader->FreeBatches.push_back(Batch);
+    }
+}
+
+uint64_t Dx12UploaderSubmit(dx12_uploader *Uploader)
+{
+    dx12_upload_batch *Batch = Uploader->Current;
+    if (!Batch)
+        return Uploader->LastSubmitted;
+
+    GpuCommandBufferEnd(&Batch->Command);
+
+    ID3D12CommandList* CommandLists[] = { ((dx12_command_buffer*)Batch->Command.Private)->List };
+    DX12.UploadQueue->ExecuteCommandLists(1, CommandLists);
+
+    Batch->RingEnd = Uploader->Head;
+    Batch->FenceValue = Dx12FenceSignal(&DX12.UploadFence, DX12.UploadQueue);
+    Uploader->InFlight.push_back(Batch);
+    Uploader->LastSubmitted = Batch->FenceValue;
+    Uploader->Current = nullptr;
+    Uploader->PendingCopies = 0;
+    return Uploader->LastSubmitted;
+}
+
+dx12_upload_batch *Dx12UploaderBatch(dx12_uploader *Uploader)
+{
+    if (Uploader->Current)
+        return Uploader->Current;
+
+    dx12_upload_batch *Batch = nullptr;
+    if (!Uploader->FreeBatches.empty())
+    {
+        Batch = Uploader->FreeBatches.back();
+        Uploader->FreeBatches.pop_back();
+    }
+    else
+    {
+        Batch = new dx12_upload_batch;
+        GpuCommandBufferInit(&Batch->Command, gpu_command_buffer_type::Upload);
+    }
+
+    GpuCommandBufferBegin(&Batch->Command);
+    Uploader->Current = Batch;
+    return Batch;
+}
+
+uint64_t Dx12UploaderAllocate(dx12_uploader *Uploader, uint64_t Size, uint64_t Alignment, ID3D12Resource **Resource, uint8_t **Pointer)
+{
+    if (Size > Uploader->Size)
+    {
+        // NOTE(amelie.h): Anything bigger than the whole ring gets its own staging buffer, freed with the batch.
+        D3D12MA::Allocation *Allocation = Dx12UploaderCreateStaging(Size);
+        *Resource = Allocation->GetResource();
+
+        D3D12_RANGE ReadRange = { 0, 0 };
+        HRESULT Result = (*Resource)->Map(0, &ReadRange, (void**)Pointer);
+        if (FAILED(Result))
+            LogError("D3D12: Failed to map staging buffer of size %llu!", Size);
+
+        Dx12UploaderBatch(Uploader)->Overflow.push_back(Allocation);
+        return 0;
+    }
+
+    for (;;)
+    {
+        uint64_t Offset = Dx12UploaderAlign(Uploader->Head, Alignment);
+        if ((Offset % Uploader->Size) + Size > Uploader->Size)
+            Offset = Dx12UploaderAlign(Offset, Uploader->Size);
+
+        if (Offset + Size - Uploader->Tail <= Uploader->Size)
+        {
+            Uploader->Head = Offset + Size;
+            *Resource = Uploader->Ring;
+            *Pointer = Uploader->Mapped + (Offset % Uploader->Size);
+            return Offset % Uploader->Size;
+        }
+
+        Dx12UploaderRetire(Uploader);
+        if (Offset + Size - Uploader->Tail <= Uploader->Size)
+            continue;
+
+        // NOTE(amelie.h): The ring is full: push what we recorded so far and wait for the oldest batch to free its space.
+        if (Uploader->PendingCopies)
+            Dx12UploaderSubmit(Uploader);
+        if (Uploader->InFlight.empty())
+            Uploader->Tail = Uploader->Head;
+        else
+            Dx12FenceSync(&DX12.UploadFence, Uploader->InFlight.front()->FenceValue);
+    }
+}
+
+void Dx12UploaderFree(dx12_uploader *Uploader)
+{
+    Dx12UploaderWait(Uploader);
+
+    if (Uploader->Current)
+    {
+        GpuCommandBufferEnd(&Uploader->Current->Command);
+        Uploader->FreeBatches.push_back(Uploader->Current);
+        Uploader->Current = nullptr;
+    }
+    for (auto Batch : Uploader->FreeBatches)
+    {
+        GpuCommandBufferFree(&Batch->Command);
+        delete Batch;
+    }
+    Uploader->FreeBatches.clear();
+
+    Uploader->Ring->Unmap(0, nullptr);
+    Uploader->Allocation->Release();
+}
+
+void Dx12UploaderBuffer(dx12_uploader *Uploader, ID3D12Resource *Dest, uint64_t DestOffset, const void *Data, uint64_t Size)
+{
+    std::lock_guard<std::mutex> Guard(Uploader->Lock);
+
+    ID3D12Resource *Source;
+    uint8_t *Pointer;
+    uint64_t SourceOffset = Dx12UploaderAllocate(Uploader, Size, 16, &Source, &Pointer);
+    memcpy(Pointer, Data, Size);
+
+    dx12_command_buffer *Private = (dx12_command_buffer*)Dx12UploaderBatch(Uploader)->Command.Private;
+    Private->List->CopyBufferRegion(Dest, DestOffset, Source, SourceOffset, Size);
+    Uploader->PendingCopies++;
+}
+
+void Dx12UploaderTexture(dx12_uploader *Uploader, ID3D12Resource *Dest, const void *Data, uint64_t RowPitch)
+{
+    std::lock_guard<std::mutex> Guard(Uploader->Lock);
+
+    D3D12_RESOURCE_DESC Desc = Dest->GetDesc();
+    D3D12_PLACED_SUBRESOURCE_FOOTPRINT Footprint;
+    uint32_t RowCount;
+    uint64_t RowSize;
+    uint64_t TotalSize;
+    DX12.Device->GetCopyableFootprints(&Desc, 0, 1, 0, &Footprint, &RowCount, &RowSize, &TotalSize);
+
+    ID3D12Resource *Source;
+    uint8_t *Pointer;
+    Footprint.Offset = Dx12UploaderAllocate(Uploader, TotalSize, D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT, &Source, &Pointer);
+
+    // NOTE(amelie.h): Rows in the staging memory are padded to D3D12_TEXTURE_DATA_PITCH_ALIGNMENT, so copy them one by one.
+    const uint8_t *Bytes = (const uint8_t*)Data;
+    for (uint32_t Row = 0; Row < RowCount; Row++)
+        memcpy(Pointer + Row * Footprint.Footprint.RowPitch, Bytes + Row * RowPitch, RowSize);
+
+    D3D12_TEXTURE_COPY_LOCATION CopySource = {};
+    CopySource.Type = D3D12_TEXTURE_COPY_TYPE_PLACED_FOOTPRINT;
+    CopySource.pResource = Source;
+    CopySource.PlacedFootprint = Footprint;
+
+    D3D12_TEXTURE_COPY_LOCATION CopyDest = {};
+    CopyDest.Type = D3D12_TEXTURE_COPY_TYPE_SUBRESOURCE_INDEX;
+    CopyDest.pResource = Dest;
+    CopyDest.SubresourceIndex = 0;
+
+    dx12_command_buffer *Private = (dx12_command_buffer*)Dx12UploaderBatch(Uploader)->Command.Private;
+    Private->List->CopyTextureRegion(&CopyDest, 0, 0, 0, &CopySource, nullptr);
+    Uploader->PendingCopies++;
+}
+
+uint64_t Dx12UploaderFlush(dx12_uploader *Uploader)
+{
+    std::lock_guard<std::mutex> Guard(Uploader->Lock);
+
+    Dx12UploaderRetire(Uploader);
+    return Dx12UploaderSubmit(Uploader);
+}
+
+void Dx12UploaderSyncQueue(dx12_uploader *Uploader, ID3D12CommandQueue *Queue)
+{
+    uint64_t Value = Dx12UploaderFlush(Uploader);
+    if (Value && !Dx12FenceReached(&DX12.UploadFence, Value))
+        Queue->Wait(DX12.UploadFence.Fence, Value);
+}
+
+void Dx12UploaderWait(dx12_uploader *Uploader)
+{
+    uint64_t Value = Dx12UploaderFlush(Uploader);
+
+    std::lock_guard<std::mutex> Guard(Uploader->Lock);
+    Dx12FenceSync(&DX12.UploadFence, Value);
+    Dx12UploaderRetire(Uploader);
+}
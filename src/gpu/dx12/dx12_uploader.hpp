@@ -0,0 +1,56 @@
+/**
+ *  Author: Amélie Heinrich
+ *  Company: Amélie Games
+ *  License: MIT
+ *  Create Time: 17/10/2026 14:20
+ */
+
+#pragma once
+
+#include <d3d12.h>
+#include <D3D12MA/D3D12MemAlloc.h>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <vector>
+
+#include "gpu/gpu_command_buffer.hpp"
+
+#define DX12_UPLOAD_RING_SIZE (64 * 1024 * 1024)
+
+struct dx12_upload_batch
+{
+    gpu_command_buffer Command;
+    uint64_t RingEnd;
+    uint64_t FenceValue;
+    std::vector<D3D12MA::Allocation*> Overflow;
+};
+
+struct dx12_uploader
+{
+    ID3D12Resource *Ring;
+    D3D12MA::Allocation *Allocation;
+    uint8_t *Mapped;
+    uint64_t Size;
+
+    // NOTE(amelie.h): Head and Tail only ever grow, the actual ring offset is the value modulo Size.
+    uint64_t Head;
+    uint64_t Tail;
+
+    dx12_upload_batch *Current;
+    uint32_t PendingCopies;
+    std::deque<dx12_upload_batch*> InFlight;
+    std::vector<dx12_upload_batch*> FreeBatches;
+
+    uint64_t LastSubmitted;
+    uint64_t LastGraphicsWait;
+    std::mutex Lock;
+};
+
+void Dx12UploaderInit(dx12_uploader *Uploader, uint64_t Size);
+void Dx12UploaderFree(dx12_uploader *Uploader);
+void Dx12UploaderBuffer(dx12_uploader *Uploader, ID3D12Resource *Dest, uint64_t DestOffset, const void *Data, uint64_t Size);
+void Dx12UploaderTexture(dx12_uploader *Uploader, ID3D12Resource *Dest, const void *Data, uint64_t RowPitch);
+uint64_t Dx12UploaderFlush(dx12_uploader *Uploader);
+void Dx12UploaderSyncQueue(dx12_uploader *Uploader, ID3D12CommandQueue *Queue);
+void Dx12UploaderWait(dx12_uploader *Uploader);
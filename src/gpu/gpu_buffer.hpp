@@ -21,7 +21,7 @@ struct gpu_buffer
 {
     gpu_buffer_type Type;
     uint64_t Size;
-    uint64_t Stride;
+    uint64_t Stride; // NOTE(amelie.h): For index buffers this is the element size, 2 for uint16_t and 4 for uint32_t.
     void *Reserved;
 };
 
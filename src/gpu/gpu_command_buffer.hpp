@@ -8,6 +8,7 @@
 #pragma once
 
 #include "gpu_buffer.hpp"
+#include "gpu_frame_allocator.hpp"
 #include "gpu_image.hpp"
 #include "gpu_pipeline.hpp"
 #include "gpu_pipeline_profiler.hpp"
@@ -20,6 +21,18 @@ enum class gpu_command_buffer_type
     Upload
 };
 
+// NOTE(amelie.h): One indirect draw as the GPU reads it. DrawConstant is written to the register(b0, space1) root
+// constant every graphics pipeline ends with, the rest matches D3D12_DRAW_INDEXED_ARGUMENTS.
+struct gpu_draw_indexed_arguments
+{
+    uint32_t DrawConstant;
+    uint32_t IndexCount;
+    uint32_t InstanceCount;
+    uint32_t FirstIndex;
+    int32_t VertexOffset;
+    uint32_t FirstInstance;
+};
+
 struct gpu_command_buffer
 {
     void *Private;
@@ -33,6 +46,7 @@ void GpuCommandBufferFree(gpu_command_buffer *Buffer);
 void GpuCommandBufferBindBuffer(gpu_command_buffer *Command, gpu_buffer *Buffer);
 void GpuCommandBufferBindPipeline(gpu_command_buffer *Command, gpu_pipeline *Pipeline);
 void GpuCommandBufferBindConstantBuffer(gpu_command_buffer *Command, gpu_pipeline_type Type, gpu_buffer *Buffer, int Offset);
+void GpuCommandBufferBindFrameAllocation(gpu_command_buffer *Command, gpu_pipeline_type Type, gpu_frame_allocation *Allocation, int Offset);
 void GpuCommandBufferBindShaderResource(gpu_command_buffer *Command, gpu_pipeline_type Type, gpu_image *Image, int Offset);
 void GpuCommandBufferBindStorageImage(gpu_command_buffer *Command, gpu_pipeline_type Type, gpu_image *Image, int Offset);
 void GpuCommandBufferBindStorageBuffer(gpu_command_buffer *Command, gpu_pipeline_type Type, gpu_buffer *Buffer, int Offset);
@@ -42,12 +56,29 @@ void GpuCommandBufferClearColor(gpu_command_buffer *Command, gpu_image *Image, f
 void GpuCommandBufferClearDepth(gpu_command_buffer *Command, gpu_image *Image, float Depth, float Stencil);
 void GpuCommandBufferSetViewport(gpu_command_buffer *Command, float Width, float Height, float X, float Y);
 void GpuCommandBufferDraw(gpu_command_buffer *Command, int VertexCount);
-void GpuCommandBufferDrawIndexed(gpu_command_buffer *Command, int IndexCount);
+void GpuCommandBufferDrawIndexed(gpu_command_buffer *Command, int IndexCount, int FirstIndex = 0);
+// NOTE(amelie.h): SV_InstanceID always starts at 0, shaders that index per instance data need their base in a constant.
+void GpuCommandBufferDrawIndexedInstanced(gpu_command_buffer *Command, int IndexCount, int InstanceCount, int FirstIndex = 0);
+// NOTE(amelie.h): Draws min(MaxDrawCount, Counts[CountIndex]) records of Arguments starting at FirstDraw, without Counts
+// it draws MaxDrawCount. Both are plain gpu_draw_indexed_arguments and uint32_t arrays from GpuFrameAllocArguments.
+void GpuCommandBufferDrawIndexedIndirect(gpu_command_buffer *Command, gpu_frame_allocation *Arguments, uint32_t FirstDraw, uint32_t MaxDrawCount, gpu_frame_allocation *Counts = nullptr, uint32_t CountIndex = 0);
 void GpuCommandBufferDispatch(gpu_command_buffer *Command, int X, int Y, int Z);
 void GpuCommandBufferBeginPipelineStatistics(gpu_command_buffer *Command, gpu_pipeline_profiler *Profiler);
 void GpuCommandBufferEndPipelineStatistics(gpu_command_buffer *Command, gpu_pipeline_profiler *Profiler);
 void GpuCommandBufferBufferBarrier(gpu_command_buffer *Command, gpu_buffer *Buffer, gpu_buffer_layout Old, gpu_buffer_layout New);
+// NOTE(amelie.h): Barriers are batched, they go out together right before the next draw, dispatch, clear or copy.
+// Transitions to the layout Image->Layout already tracks are dropped.
 void GpuCommandBufferImageBarrier(gpu_command_buffer *Command, gpu_image *Image, gpu_image_layout New);
+// NOTE(amelie.h): Split barrier. Begin starts the transition early so the GPU can overlap it with the work recorded before
+// End, Image can't be used in between. Both take the same New, Image->Layout only changes on End.
+void GpuCommandBufferImageBarrierBegin(gpu_command_buffer *Command, gpu_image *Image, gpu_image_layout New);
+void GpuCommandBufferImageBarrierEnd(gpu_command_buffer *Command, gpu_image *Image, gpu_image_layout New);
+// NOTE(amelie.h): Untracked barrier, leaves Image->Layout alone. Safe to record from several threads.
+void GpuCommandBufferImageTransition(gpu_command_buffer *Command, gpu_image *Image, gpu_image_layout Old, gpu_image_layout New);
+// NOTE(amelie.h): Makes After the owner of memory it shares with other placed images, Before can be null for any of them.
+// After's contents are undefined until it is discarded, cleared or fully written.
+void GpuCommandBufferAliasingBarrier(gpu_command_buffer *Command, gpu_image *Before, gpu_image *After);
+void GpuCommandBufferDiscardImage(gpu_command_buffer *Command, gpu_image *Image);
 void GpuCommandBufferBlit(gpu_command_buffer *Command, gpu_image *Source, gpu_image *Dest);
 void GpuCommandBufferCopyBufferToTexture(gpu_command_buffer *Command, gpu_buffer *Source, gpu_image *Dest);
 void GpuCommandBufferCopyTextureToBuffer(gpu_command_buffer *Command, gpu_image *Source, gpu_buffer *Dest);
@@ -55,4 +86,6 @@ void GpuCommandBufferCopyBufferToBuffer(gpu_command_buffer *Command, gpu_buffer
 void GpuCommandBufferBegin(gpu_command_buffer *Command);
 void GpuCommandBufferEnd(gpu_command_buffer *Command);
 void GpuCommandBufferFlush(gpu_command_buffer *Command);
+// NOTE(amelie.h): Executes the buffers in order in a single submission, without waiting for the GPU.
+void GpuCommandBufferSubmit(gpu_command_buffer **Buffers, uint32_t Count);
 void GpuCommandBufferScreenshot(gpu_command_buffer *Command, gpu_image *Image, gpu_buffer *Temporary);
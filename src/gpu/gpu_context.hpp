@@ -12,12 +12,27 @@
 
 #include "gpu_command_buffer.hpp"
 #include "gpu_image.hpp"
+#include "gpu_pipeline_cache.hpp"
 #include "math_types.hpp"
 
+// NOTE(amelie.h): Per frame command buffers handed to passes so they can be recorded in parallel, passes that split
+// their own recording across threads take several.
+#define GPU_MAX_PASS_COMMAND_BUFFERS 16
+
 enum class gpu_backend
 {
     DirectX12,
-    Vulkan
+    Vulkan,
+    Null
+};
+
+// NOTE(amelie.h): CpuWaitMs is how long GpuBeginFrame blocked on the GPU. FrameLatencyMs is the time between
+// a frame's submission and the CPU seeing it complete.
+struct gpu_frame_metrics
+{
+    uint32_t FramesInFlight;
+    float CpuWaitMs;
+    float FrameLatencyMs;
 };
 
 gpu_backend GpuGetBackend();
@@ -31,4 +46,8 @@ void GpuPresent();
 void GpuWait();
 hmm_v2 GpuGetDimensions();
 gpu_command_buffer* GpuGetImageCommandBuffer();
+gpu_command_buffer* GpuGetPassCommandBuffer(uint32_t Index);
 gpu_image* GpuGetSwapChainImage();
+gpu_frame_metrics GpuGetFrameMetrics();
+// NOTE(amelie.h): Null when the backend doesn't cache pipelines.
+gpu_pipeline_cache* GpuGetPipelineCache();
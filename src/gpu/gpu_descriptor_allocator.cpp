@@ -0,0 +1,324 @@
+/**
+ *  Author: Amélie Heinrich
+ *  Company: Amélie Games
+ *  License: MIT
+ *  Create Time: 17/10/2026 15:45
+ */
+
+#include "gpu_descriptor_allocator.hpp"
+
+#include "systems/log_system.hpp"
+#include "timer.hpp"
+
+#include <algorithm>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+
+uint32_t GpuDescriptorCountTrailingZeros(uint64_t Value)
+{
+    unsigned long Index;
+    _BitScanForward64(&Index, Value);
+    return (uint32_t)Index;
+}
+#else
+uint32_t GpuDescriptorCountTrailingZeros(uint64_t Value)
+{
+    return (uint32_t)__builtin_ctzll(Value);
+}
+#endif
+
+gpu_descriptor_handle GpuDescriptorMakeHandle(gpu_descriptor_allocator *Allocator, uint32_t Index)
+{
+    return ((uint32_t)Allocator->Generations[Index].load(std::memory_order_relaxed) << GPU_DESCRIPTOR_INDEX_BITS) | Index;
+}
+
+bool GpuDescriptorTest(gpu_descriptor_allocator *Allocator, uint32_t Index)
+{
+    return (Allocator->Bits[Index >> 6] >> (Index & 63)) & 1;
+}
+
+void GpuDescriptorAllocatorInit(gpu_descriptor_allocator *Allocator, uint32_t Capacity)
+{
+    if (Capacity > GPU_DESCRIPTOR_MAX_COUNT)
+    {
+        LogError("Descriptor allocator: Capacity %u is above the maximum of %u!", Capacity, GPU_DESCRIPTOR_MAX_COUNT);
+        Capacity = GPU_DESCRIPTOR_MAX_COUNT;
+    }
+
+    Allocator->Capacity = Capacity;
+    Allocator->Used = 0;
+    Allocator->Hint = 0;
+    Allocator->Bits.assign((Capacity + 63) / 64, 0);
+    Allocator->Generations = std::vector<std::atomic<uint8_t>>(Capacity);
+
+    // NOTE(amelie.h): Mark the padding bits of the last word as used so the search never hands them out.
+    if (Capacity & 63)
+        Allocator->Bits.back() = ~0ull << (Capacity & 63);
+}
+
+void GpuDescriptorAllocatorFree(gpu_descriptor_allocator *Allocator)
+{
+    if (Allocator->Used)
+        LogWarn("Descriptor allocator: %u descriptors still allocated on shutdown!", Allocator->Used);
+    Allocator->Bits.clear();
+    Allocator->Generations.clear();
+}
+
+gpu_descriptor_handle GpuDescriptorAlloc(gpu_descriptor_allocator *Allocator)
+{
+    std::lock_guard<std::mutex> Guard(Allocator->Lock);
+
+    // NOTE(amelie.h): Every word below Hint is full, so the search starts there and usually ends on the first word.
+    uint32_t WordCount = (uint32_t)Allocator->Bits.size();
+    for (uint32_t Word = Allocator->Hint; Word < WordCount; Word++)
+    {
+        uint64_t Free = ~Allocator->Bits[Word];
+        if (!Free)
+            continue;
+
+        uint32_t Bit = GpuDescriptorCountTrailingZeros(Free);
+        Allocator->Bits[Word] |= 1ull << Bit;
+        Allocator->Hint = Word;
+        Allocator->Used++;
+        return GpuDescriptorMakeHandle(Allocator, Word * 64 + Bit);
+    }
+
+    Allocator->Hint = WordCount;
+    LogError("Descriptor allocator: Out of descriptors (%u in use)!", Allocator->Used);
+    return GPU_DESCRIPTOR_INVALID;
+}
+
+gpu_descriptor_handle GpuDescriptorAllocRange(gpu_descriptor_allocator *Allocator, uint32_t Count)
+{
+    if (Count == 0)
+        return GPU_DESCRIPTOR_INVALID;
+    if (Count == 1)
+        return GpuDescriptorAlloc(Allocator);
+
+    std::lock_guard<std::mutex> Guard(Allocator->Lock);
+
+    uint32_t RunStart = Allocator->Hint * 64;
+    uint32_t RunLength = 0;
+    for (uint32_t Index = RunStart; Index < Allocator->Capacity; )
+    {
+        uint64_t Word = Allocator->Bits[Index >> 6];
+        if ((Index & 63) == 0 && Word == ~0ull)
+        {
+            Index += 64;
+            RunStart = Index;
+            RunLength = 0;
+            continue;
+        }
+        if ((Index & 63) == 0 && Word == 0 && RunLength + 64 < Count)
+        {
+            Index += 64;
+            RunLength += 64;
+            continue;
+        }
+
+        if ((Word >> (Index & 63)) & 1)
+        {
+            RunStart = Index + 1;
+            RunLength = 0;
+        }
+        else if (++RunLength == Count)
+        {
+            for (uint32_t Slot = RunStart; Slot < RunStart + Count; Slot++)
+                Allocator->Bits[Slot >> 6] |= 1ull << (Slot & 63);
+            Allocator->Used += Count;
+            return GpuDescriptorMakeHandle(Allocator, RunStart);
+        }
+        Index++;
+    }
+
+    LogError("Descriptor allocator: No contiguous range of %u descriptors left!", Count);
+    return GPU_DESCRIPTOR_INVALID;
+}
+
+gpu_descriptor_handle GpuDescriptorOffset(gpu_descriptor_allocator *Allocator, gpu_descriptor_handle Base, uint32_t Offset)
+{
+    return GpuDescriptorMakeHandle(Allocator, GpuDescriptorIndex(Base) + Offset);
+}
+
+bool GpuDescriptorValid(gpu_descriptor_allocator *Allocator, gpu_descriptor_handle Handle)
+{
+    if (Handle == GPU_DESCRIPTOR_INVALID)
+        return false;
+
+    uint32_t Index = GpuDescriptorIndex(Handle);
+    if (Index >= Allocator->Capacity)
+        return false;
+    return Allocator->Generations[Index].load(std::memory_order_relaxed) == (Handle >> GPU_DESCRIPTOR_INDEX_BITS);
+}
+
+void GpuDescriptorReleaseRange(gpu_descriptor_allocator *Allocator, gpu_descriptor_handle Base, uint32_t Count)
+{
+    std::lock_guard<std::mutex> Guard(Allocator->Lock);
+
+    if (!GpuDescriptorValid(Allocator, Base))
+    {
+        LogError("Descriptor allocator: Freeing stale or invalid descriptor handle 0x%08x!", Base);
+        return;
+    }
+
+    uint32_t Start = GpuDescriptorIndex(Base);
+    uint32_t End = std::min(Start + Count, Allocator->Capacity);
+    uint32_t Freed = 0;
+    for (uint32_t Index = Start; Index < End; Index++)
+    {
+        if (!GpuDescriptorTest(Allocator, Index))
+            continue;
+        Allocator->Bits[Index >> 6] &= ~(1ull << (Index & 63));
+        Allocator->Generations[Index].fetch_add(1, std::memory_order_relaxed);
+        Freed++;
+    }
+    if (Freed != Count)
+        LogError("Descriptor allocator: Range 0x%08x of %u descriptors only had %u allocated!", Base, Count, Freed);
+
+    Allocator->Used -= Freed;
+    Allocator->Hint = std::min(Allocator->Hint, Start >> 6);
+}
+
+void GpuDescriptorRelease(gpu_descriptor_allocator *Allocator, gpu_descriptor_handle Handle)
+{
+    GpuDescriptorReleaseRange(Allocator, Handle, 1);
+}
+
+uint32_t GpuDescriptorAllocatorBenchmark()
+{
+    const uint32_t DescriptorCount = 1'000'000;
+    const uint32_t LinearCount = 32'768;
+
+    gpu_descriptor_allocator *Allocator = new gpu_descriptor_allocator;
+    GpuDescriptorAllocatorInit(Allocator, DescriptorCount);
+    std::vector<gpu_descriptor_handle> Handles(DescriptorCount);
+
+    LogInfo("Descriptor Allocator Benchmark: %u descriptors", DescriptorCount);
+    uint32_t Failures = 0;
+
+    timer Timer;
+    TimerInit(&Timer);
+    for (uint32_t Index = 0; Index < DescriptorCount; Index++)
+        Handles[Index] = GpuDescriptorAlloc(Allocator);
+    double AllocMs = NanosecondsToMilliseconds(TimerGetElapsedNanoseconds(&Timer));
+
+    uint32_t Distinct = 0;
+    for (uint32_t Index = 0; Index < DescriptorCount; Index++)
+        Distinct += GpuDescriptorIndex(Handles[Index]) == Index && GpuDescriptorValid(Allocator, Handles[Index]);
+    if (Distinct != DescriptorCount || Allocator->Used != DescriptorCount)
+    {
+        LogError("Descriptor Allocator Benchmark: Filling the heap gave %u of %u valid handles in slot order!", Distinct, DescriptorCount);
+        Failures++;
+    }
+
+    std::vector<gpu_descriptor_handle> Freed(Handles.begin(), Handles.end());
+    TimerRestart(&Timer);
+    for (uint32_t Index = 0; Index < DescriptorCount; Index += 2)
+        GpuDescriptorRelease(Allocator, Handles[Index]);
+    for (uint32_t Index = 0; Index < DescriptorCount; Index += 2)
+        Handles[Index] = GpuDescriptorAlloc(Allocator);
+    double ChurnMs = NanosecondsToMilliseconds(TimerGetElapsedNanoseconds(&Timer));
+
+    // NOTE(amelie.h): The heap was full, so every freed slot has to be handed out again with the next generation.
+    uint32_t Reused = 0;
+    uint32_t Bumped = 0;
+    uint32_t StaleRejected = 0;
+    for (uint32_t Index = 0; Index < DescriptorCount; Index += 2)
+    {
+        Reused += GpuDescriptorIndex(Handles[Index]) == Index;
+        Bumped += (Handles[Index] >> GPU_DESCRIPTOR_INDEX_BITS) == (((Freed[Index] >> GPU_DESCRIPTOR_INDEX_BITS) + 1) & 0xFF);
+        StaleRejected += !GpuDescriptorValid(Allocator, Freed[Index]);
+    }
+    uint32_t ChurnCount = DescriptorCount / 2;
+    if (Reused != ChurnCount || Bumped != ChurnCount || StaleRejected != ChurnCount)
+    {
+        LogError("Descriptor Allocator Benchmark: Of %u freed slots %u were reused, %u bumped their generation and %u rejected the old handle!",
+                 ChurnCount, Reused, Bumped, StaleRejected);
+        Failures++;
+    }
+
+    // NOTE(amelie.h): Freeing a stale handle must not free the slot that now lives there.
+    LogInfo("  releasing a stale handle on purpose, the error below is expected");
+    GpuDescriptorRelease(Allocator, Freed[0]);
+    if (!GpuDescriptorValid(Allocator, Handles[0]) || Allocator->Used != DescriptorCount)
+    {
+        LogError("Descriptor Allocator Benchmark: Releasing a stale handle freed the live descriptor in its slot!");
+        Failures++;
+    }
+
+    TimerRestart(&Timer);
+    for (uint32_t Index = 0; Index < DescriptorCount; Index++)
+        GpuDescriptorRelease(Allocator, Handles[Index]);
+    double FreeMs = NanosecondsToMilliseconds(TimerGetElapsedNanoseconds(&Timer));
+
+    TimerRestart(&Timer);
+    std::vector<gpu_descriptor_handle> Ranges;
+    for (uint32_t Index = 0; Index < DescriptorCount / 64; Index++)
+        Ranges.push_back(GpuDescriptorAllocRange(Allocator, 1 + (Index % 32)));
+    double RangeAllocMs = NanosecondsToMilliseconds(TimerGetElapsedNanoseconds(&Timer));
+
+    // NOTE(amelie.h): Every slot of a range has to be valid through Offset, and no two ranges may overlap.
+    std::vector<bool> Owned(DescriptorCount, false);
+    uint32_t BrokenRanges = 0;
+    for (uint32_t Index = 0; Index < Ranges.size(); Index++)
+    {
+        bool Contiguous = Ranges[Index] != GPU_DESCRIPTOR_INVALID;
+        for (uint32_t Offset = 0; Contiguous && Offset < 1 + (Index % 32); Offset++)
+        {
+            gpu_descriptor_handle Slot = GpuDescriptorOffset(Allocator, Ranges[Index], Offset);
+            uint32_t SlotIndex = GpuDescriptorIndex(Slot);
+            Contiguous = SlotIndex == GpuDescriptorIndex(Ranges[Index]) + Offset && GpuDescriptorValid(Allocator, Slot) && !Owned[SlotIndex];
+            if (Contiguous)
+                Owned[SlotIndex] = true;
+        }
+        BrokenRanges += !Contiguous;
+    }
+    if (BrokenRanges)
+    {
+        LogError("Descriptor Allocator Benchmark: %u of %zu ranges are not contiguous runs of their own slots!", BrokenRanges, Ranges.size());
+        Failures++;
+    }
+
+    TimerRestart(&Timer);
+    for (uint32_t Index = 0; Index < Ranges.size(); Index++)
+        GpuDescriptorReleaseRange(Allocator, Ranges[Index], 1 + (Index % 32));
+    double RangeMs = RangeAllocMs + NanosecondsToMilliseconds(TimerGetElapsedNanoseconds(&Timer));
+
+    bool StaleCaught = !GpuDescriptorValid(Allocator, Handles[0]);
+    if (!StaleCaught || Allocator->Used != 0)
+    {
+        LogError("Descriptor Allocator Benchmark: Freed handle still validates or %u descriptors leaked!", Allocator->Used);
+        Failures++;
+    }
+
+    LogInfo("  alloc %.1f ns/op | free+realloc half %.1f ns/op | free %.1f ns/op | %zu ranges of 1-32 %.3fms",
+            (AllocMs * 1'000'000.0) / DescriptorCount,
+            (ChurnMs * 1'000'000.0) / DescriptorCount,
+            (FreeMs * 1'000'000.0) / DescriptorCount,
+            Ranges.size(), RangeMs);
+    LogInfo("  stale handle detected: %s, %u descriptors left in use", StaleCaught ? "yes" : "no", Allocator->Used);
+
+    GpuDescriptorAllocatorFree(Allocator);
+    delete Allocator;
+
+    // NOTE(amelie.h): The old allocator scanned a std::vector<bool> from slot 0 every time. It's quadratic, so it only runs on a slice.
+    std::vector<bool> LookupTable(DescriptorCount, false);
+    TimerRestart(&Timer);
+    for (uint32_t Allocation = 0; Allocation < LinearCount; Allocation++)
+    {
+        for (uint32_t Descriptor = 0; Descriptor < DescriptorCount; Descriptor++)
+        {
+            if (!LookupTable[Descriptor])
+            {
+                LookupTable[Descriptor] = true;
+                break;
+            }
+        }
+    }
+    double LinearMs = NanosecondsToMilliseconds(TimerGetElapsedNanoseconds(&Timer));
+    LogInfo("  linear scan reference: %u allocs at %.1f ns/op (grows with heap occupancy)", LinearCount, (LinearMs * 1'000'000.0) / LinearCount);
+
+    LogInfo("Descriptor Allocator Benchmark: %s", Failures ? "FAIL" : "PASS");
+    return Failures;
+}
@@ -0,0 +1,58 @@
+/**
+ *  Author: Amélie Heinrich
+ *  Company: Amélie Games
+ *  License: MIT
+ *  Create Time: 17/10/2026 15:40
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+// NOTE(amelie.h): A handle packs the slot index in the low 24 bits and the slot generation in the high 8 bits.
+// The generation is bumped on every free, so a handle that outlived its descriptor no longer validates. It wraps after
+// 256 frees of the same slot, a handle whose slot was freed a multiple of 256 times since validates again.
+// Generations are atomics so handles can be checked and offset from the bind path without taking the lock.
+typedef uint32_t gpu_descriptor_handle;
+
+#define GPU_DESCRIPTOR_INVALID 0xFFFFFFFF
+#define GPU_DESCRIPTOR_INDEX_BITS 24
+#define GPU_DESCRIPTOR_INDEX_MASK ((1u << GPU_DESCRIPTOR_INDEX_BITS) - 1)
+#define GPU_DESCRIPTOR_MAX_COUNT GPU_DESCRIPTOR_INDEX_MASK
+
+struct gpu_descriptor_allocator
+{
+    uint32_t Capacity;
+    uint32_t Used;
+    uint32_t Hint;
+
+    std::vector<uint64_t> Bits;
+    std::vector<std::atomic<uint8_t>> Generations;
+    std::mutex Lock;
+};
+
+inline uint32_t GpuDescriptorIndex(gpu_descriptor_handle Handle)
+{
+    return Handle & GPU_DESCRIPTOR_INDEX_MASK;
+}
+
+void GpuDescriptorAllocatorInit(gpu_descriptor_allocator *Allocator, uint32_t Capacity);
+void GpuDescriptorAllocatorFree(gpu_descriptor_allocator *Allocator);
+// NOTE(amelie.h): Alloc and release take Allocator->Lock.
+gpu_descriptor_handle GpuDescriptorAlloc(gpu_descriptor_allocator *Allocator);
+gpu_descriptor_handle GpuDescriptorAllocRange(gpu_descriptor_allocator *Allocator, uint32_t Count);
+void GpuDescriptorRelease(gpu_descriptor_allocator *Allocator, gpu_descriptor_handle Handle);
+// NOTE(amelie.h): Frees every allocated slot of the range and logs the ones that weren't.
+void GpuDescriptorReleaseRange(gpu_descriptor_allocator *Allocator, gpu_descriptor_handle Base, uint32_t Count);
+
+// NOTE(amelie.h): Lock free. Offset reads the generation of a slot inside a range the caller owns, so it can't change
+// under it. Valid only compares generations: a freed slot always has a newer one than the handles that pointed at it.
+gpu_descriptor_handle GpuDescriptorOffset(gpu_descriptor_allocator *Allocator, gpu_descriptor_handle Base, uint32_t Offset);
+bool GpuDescriptorValid(gpu_descriptor_allocator *Allocator, gpu_descriptor_handle Handle);
+
+// NOTE(amelie.h): Checks slot reuse, generations, stale handles and range contiguity along the way. Returns the number
+// of checks that failed.
+uint32_t GpuDescriptorAllocatorBenchmark();
@@ -0,0 +1,65 @@
+/**
+ *  Author: Amélie Heinrich
+ *  Company: Amélie Games
+ *  License: MIT
+ *  Create Time: 17/10/2026 14:50
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#define GPU_FRAME_ALLOCATOR_ALIGNMENT 256
+// NOTE(amelie.h): 4 MB per frame in flight, every slice also owns a descriptor.
+#define GPU_FRAME_ALLOCATOR_SLICES 16384
+
+// NOTE(amelie.h): Most structured allocations a gpu_frame_buffer can view in one frame.
+#define GPU_FRAME_BUFFER_VIEWS 8
+
+struct gpu_frame_buffer;
+
+// NOTE(amelie.h): Memory handed out by the frame allocator is only valid until the same frame index comes around again,
+// so write it the frame you allocate it and don't keep it around. When the frame is out of space the allocation comes
+// back with a null Data, callers have to check it and skip whatever would have used it.
+// Owner is null for the frame allocator. For a gpu_frame_buffer, Offset is where the memory starts in its buffer and
+// Slice picks one of its views.
+struct gpu_frame_allocation
+{
+    void *Data;
+    uint64_t Size;
+    uint32_t Slice;
+    gpu_frame_buffer *Owner;
+    uint64_t Offset;
+};
+
+// NOTE(amelie.h): Upload memory owned by one pass for data that grows with the scene, like instance transforms and
+// indirect arguments, so it doesn't compete for the frame allocator. Every frame in flight has a region of Capacity
+// bytes. GpuFrameBufferReset grows them before the frame writes anything, which waits for the GPU, so they at least
+// double. Not thread safe, one pass allocates from it at a time.
+struct gpu_frame_buffer
+{
+    uint64_t Capacity;
+    uint64_t Head;
+    uint32_t ViewCount;
+    void *Private;
+};
+
+inline uint64_t GpuFrameAlign(uint64_t Size)
+{
+    return (Size + GPU_FRAME_ALLOCATOR_ALIGNMENT - 1) & ~(uint64_t)(GPU_FRAME_ALLOCATOR_ALIGNMENT - 1);
+}
+
+gpu_frame_allocation GpuFrameAllocConstant(uint64_t Size);
+// NOTE(amelie.h): Viewed as a StructuredBuffer of Count elements, bound like a constant allocation. Slices are 256 byte
+// aligned and the view starts on an element boundary, so Stride has to divide GPU_FRAME_ALLOCATOR_ALIGNMENT.
+gpu_frame_allocation GpuFrameAllocStructured(uint32_t Count, uint32_t Stride);
+// NOTE(amelie.h): No view is created, for memory only the command processor reads like indirect arguments and counts.
+gpu_frame_allocation GpuFrameAllocArguments(uint64_t Size);
+
+void GpuFrameBufferInit(gpu_frame_buffer *Buffer, uint64_t Capacity);
+void GpuFrameBufferFree(gpu_frame_buffer *Buffer);
+// NOTE(amelie.h): Starts this frame's region with room for at least Size bytes, every allocation takes GpuFrameAlign of
+// its size. Call it once a frame before allocating.
+void GpuFrameBufferReset(gpu_frame_buffer *Buffer, uint64_t Size);
+gpu_frame_allocation GpuFrameBufferAllocStructured(gpu_frame_buffer *Buffer, uint32_t Count, uint32_t Stride);
+gpu_frame_allocation GpuFrameBufferAllocArguments(gpu_frame_buffer *Buffer, uint64_t Size);
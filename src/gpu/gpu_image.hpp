@@ -53,8 +53,28 @@ struct gpu_image
     void *Private;
 };
 
+// NOTE(amelie.h): A block of device memory images can be placed in. Images placed over the same bytes alias, only one
+// of them holds meaningful contents at a time and the next one has to be activated with an aliasing barrier.
+struct gpu_memory
+{
+    uint64_t Size;
+    void *Private;
+};
+
+struct gpu_image_memory_info
+{
+    uint64_t Size;
+    uint64_t Alignment;
+};
+
+void GpuMemoryInit(gpu_memory *Memory, uint64_t Size);
+void GpuMemoryFree(gpu_memory *Memory);
+
 void GpuImageInit(gpu_image *Image, uint32_t Width, uint32_t Height, gpu_image_format Format, gpu_image_usage Usage);
 void GpuImageInitCopy(gpu_image *Image, uint32_t Width, uint32_t Height);
 void GpuImageInitCubeMap(gpu_image *Image, uint32_t Width, uint32_t Height, gpu_image_format Format);
 void GpuImageInitFromCPU(gpu_image *Image, cpu_image *CPU);
+// NOTE(amelie.h): Only render and depth targets can be placed, the memory is shared with images of the same kind.
+gpu_image_memory_info GpuImageGetMemoryInfo(uint32_t Width, uint32_t Height, gpu_image_format Format, gpu_image_usage Usage);
+void GpuImageInitPlaced(gpu_image *Image, uint32_t Width, uint32_t Height, gpu_image_format Format, gpu_image_usage Usage, gpu_memory *Memory, uint64_t Offset);
 void GpuImageFree(gpu_image *Image);
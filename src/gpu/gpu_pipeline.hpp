@@ -41,6 +41,28 @@ enum class depth_func
     None
 };
 
+enum class gpu_vertex_format
+{
+    Float2,
+    Float3,
+    Float4,
+    Half2,
+    Half4,
+    SNorm16x2,
+    SNorm16x4,
+    UNorm16x2,
+    UNorm16x4
+};
+
+// NOTE(amelie.h): Explicit vertex layout for compressed vertices. Attributes are matched to the vertex shader inputs
+// by semantic name, Offset is in bytes from the start of the vertex.
+struct gpu_vertex_attribute
+{
+    const char *Semantic;
+    gpu_vertex_format Format;
+    uint32_t Offset;
+};
+
 struct gpu_pipeline_create_info
 {
     gpu_pipeline_type Type;
@@ -51,6 +73,7 @@ struct gpu_pipeline_create_info
     gpu_image_format DepthFormat;
     bool HasDepth;
     depth_func DepthFunc;
+    std::vector<gpu_vertex_attribute> VertexAttributes; // NOTE(amelie.h): Empty means full float inputs reflected from the shader.
 };
 
 struct gpu_pipeline
@@ -62,4 +85,6 @@ struct gpu_pipeline
 void GpuPipelineCreateGraphics(gpu_pipeline *Pipeline);
 void GpuPipelineCreateCompute(gpu_pipeline *Pipeline);
 void GpuPipelineFree(gpu_pipeline *Pipeline);
+// NOTE(amelie.h): Root slot of a shader resource by its name in the shader, reflected when the pipeline is created. It's a
+// string lookup, passes look their slots up once next to the pipeline and keep them.
 int GpuPipelineGetDescriptor(gpu_pipeline *Pipeline, const std::string& Name);
@@ -0,0 +1,207 @@
+/**
+ *  Author: Amélie Heinrich
+ *  Company: Amélie Games
+ *  License: MIT
+ *  Create Time: 17/10/2026 18:45
+ */
+
+#include "gpu_pipeline_cache.hpp"
+
+#include "systems/file_system.hpp"
+#include "systems/hash_system.hpp"
+#include "systems/log_system.hpp"
+
+#include <cstring>
+#include <fstream>
+
+struct gpu_pipeline_cache_header
+{
+    uint32_t Magic;
+    uint32_t Version;
+    uint64_t Count;
+};
+
+struct gpu_pipeline_cache_entry_header
+{
+    uint64_t Key;
+    uint64_t Size;
+};
+
+void GpuPipelineCacheLoad(gpu_pipeline_cache *Cache, const std::string& Path)
+{
+    Cache->Path = Path;
+    Cache->Entries.clear();
+    Cache->Stats = {};
+    Cache->Dirty = false;
+
+    if (Path.empty() || !FileBufferExists(Path))
+        return;
+
+    file_mapping Mapping;
+    if (!FileMappingOpen(&Mapping, Path))
+        return;
+
+    gpu_pipeline_cache_header Header = {};
+    if (Mapping.Size < sizeof(Header))
+    {
+        LogWarn("Pipeline Cache: %s is too small, starting cold", Path.c_str());
+        FileMappingClose(&Mapping);
+        return;
+    }
+    memcpy(&Header, Mapping.Data, sizeof(Header));
+    if (Header.Magic != GPU_PIPELINE_CACHE_MAGIC || Header.Version != GPU_PIPELINE_CACHE_VERSION)
+    {
+        LogWarn("Pipeline Cache: %s is from another version, starting cold", Path.c_str());
+        FileMappingClose(&Mapping);
+        return;
+    }
+
+    uint64_t Offset = sizeof(Header);
+    for (uint64_t Index = 0; Index < Header.Count; Index++)
+    {
+        gpu_pipeline_cache_entry_header EntryHeader;
+        if (Offset + sizeof(EntryHeader) > Mapping.Size)
+            break;
+        memcpy(&EntryHeader, Mapping.Data + Offset, sizeof(EntryHeader));
+        Offset += sizeof(EntryHeader);
+        if (EntryHeader.Size > Mapping.Size - Offset)
+            break;
+
+        gpu_pipeline_cache_entry& Entry = Cache->Entries[EntryHeader.Key];
+        Entry.Data.assign(Mapping.Data + Offset, Mapping.Data + Offset + EntryHeader.Size);
+        Entry.Used = false;
+        Offset += EntryHeader.Size;
+    }
+    FileMappingClose(&Mapping);
+
+    Cache->Stats.Loaded = (uint32_t)Cache->Entries.size();
+    if (Cache->Entries.size() != Header.Count)
+        LogWarn("Pipeline Cache: %s is truncated, kept %u of %llu entries", Path.c_str(), Cache->Stats.Loaded, (unsigned long long)Header.Count);
+    LogInfo("Pipeline Cache: Loaded %u entries from %s", Cache->Stats.Loaded, Path.c_str());
+}
+
+void GpuPipelineCacheSave(gpu_pipeline_cache *Cache)
+{
+    if (Cache->Path.empty() || !Cache->Dirty)
+        return;
+
+    for (auto Entry = Cache->Entries.begin(); Entry != Cache->Entries.end();)
+    {
+        if (!Entry->second.Used)
+            Entry = Cache->Entries.erase(Entry);
+        else
+            ++Entry;
+    }
+
+    std::ofstream FileStream(Cache->Path, std::ios_base::binary | std::ios_base::trunc);
+    if (!FileStream)
+    {
+        LogError("Pipeline Cache: Failed to open %s for writing!", Cache->Path.c_str());
+        return;
+    }
+
+    gpu_pipeline_cache_header Header = { GPU_PIPELINE_CACHE_MAGIC, GPU_PIPELINE_CACHE_VERSION, Cache->Entries.size() };
+    FileStream.write((const char*)&Header, sizeof(Header));
+    for (auto& Entry : Cache->Entries)
+    {
+        gpu_pipeline_cache_entry_header EntryHeader = { Entry.first, Entry.second.Data.size() };
+        FileStream.write((const char*)&EntryHeader, sizeof(EntryHeader));
+        FileStream.write((const char*)Entry.second.Data.data(), Entry.second.Data.size());
+    }
+    FileStream.close();
+
+    Cache->Dirty = false;
+    LogInfo("Pipeline Cache: Wrote %llu entries to %s", (unsigned long long)Cache->Entries.size(), Cache->Path.c_str());
+}
+
+void GpuPipelineCacheClear(gpu_pipeline_cache *Cache)
+{
+    Cache->Entries.clear();
+    Cache->Dirty = false;
+}
+
+uint64_t GpuPipelineCacheHashInfo(const gpu_pipeline_create_info *Info)
+{
+    // NOTE(amelie.h): Field by field, padding bytes in the struct aren't guaranteed to be anything.
+    uint64_t Hash = HashFNV1a(&Info->Type, sizeof(Info->Type));
+    Hash = HashFNV1a(&Info->FillMode, sizeof(Info->FillMode), Hash);
+    Hash = HashFNV1a(&Info->CullMode, sizeof(Info->CullMode), Hash);
+    Hash = HashFNV1a(Info->Formats.data(), Info->Formats.size() * sizeof(gpu_image_format), Hash);
+    Hash = HashFNV1a(&Info->HasDepth, sizeof(Info->HasDepth), Hash);
+    if (Info->HasDepth)
+    {
+        Hash = HashFNV1a(&Info->DepthFormat, sizeof(Info->DepthFormat), Hash);
+        Hash = HashFNV1a(&Info->DepthFunc, sizeof(Info->DepthFunc), Hash);
+    }
+    for (const gpu_vertex_attribute& Attribute : Info->VertexAttributes)
+    {
+        Hash = HashFNV1a(Attribute.Semantic, strlen(Attribute.Semantic) + 1, Hash);
+        Hash = HashFNV1a(&Attribute.Format, sizeof(Attribute.Format), Hash);
+        Hash = HashFNV1a(&Attribute.Offset, sizeof(Attribute.Offset), Hash);
+    }
+    return Hash;
+}
+
+const std::vector<uint8_t> *GpuPipelineCacheFind(gpu_pipeline_cache *Cache, uint64_t Key)
+{
+    auto Entry = Cache->Entries.find(Key);
+    if (Entry == Cache->Entries.end())
+        return nullptr;
+    Entry->second.Used = true;
+    return &Entry->second.Data;
+}
+
+void GpuPipelineCacheStore(gpu_pipeline_cache *Cache, uint64_t Key, const void *Data, uint64_t Size)
+{
+    gpu_pipeline_cache_entry& Entry = Cache->Entries[Key];
+    Entry.Data.assign((const uint8_t*)Data, (const uint8_t*)Data + Size);
+    Entry.Used = true;
+    Cache->Dirty = true;
+}
+
+void GpuPipelineCacheLogStats(const gpu_pipeline_cache *Cache)
+{
+    uint64_t Bytes = 0;
+    for (auto& Entry : Cache->Entries)
+        Bytes += Entry.second.Data.size();
+
+    LogInfo("Pipeline Cache: %u hits, %u misses, %u stale | %llu entries (%llu bytes), %u loaded from %s",
+            Cache->Stats.Hits, Cache->Stats.Misses, Cache->Stats.Stale,
+            (unsigned long long)Cache->Entries.size(), (unsigned long long)Bytes,
+            Cache->Stats.Loaded, Cache->Path.empty() ? "nowhere" : Cache->Path.c_str());
+}
+
+uint32_t GpuPipelineCacheValidate(const gpu_pipeline_cache *Cache, gpu_pipeline_cache_run Run)
+{
+    const gpu_pipeline_cache_stats& Stats = Cache->Stats;
+    uint32_t Failures = 0;
+    auto Expect = [&](bool Condition, const char *Message) {
+        if (!Condition)
+        {
+            LogError("Pipeline Cache: %s (%u hits, %u misses, %u stale, %u loaded)!", Message, Stats.Hits, Stats.Misses, Stats.Stale, Stats.Loaded);
+            Failures++;
+        }
+    };
+
+    Expect(Stats.Hits + Stats.Misses > 0, "No pipeline went through the cache");
+    switch (Run)
+    {
+        case gpu_pipeline_cache_run::Cold:
+            Expect(Stats.Loaded == 0, "A cold run loaded entries, delete the cache file first");
+            Expect(Stats.Hits == 0 && Stats.Stale == 0, "A cold run found cached blobs");
+            break;
+        case gpu_pipeline_cache_run::Warm:
+            Expect(Stats.Misses == 0, "A warm run compiled pipelines");
+            Expect(Stats.Stale == 0, "A warm run had blobs refused");
+            break;
+        case gpu_pipeline_cache_run::Stale:
+            // NOTE(amelie.h): Every refused blob falls back to a compile, which also counts as a miss.
+            Expect(Stats.Stale > 0, "A stale run had no blob refused");
+            Expect(Stats.Misses >= Stats.Stale, "A refused blob wasn't compiled again");
+            Expect(Cache->Dirty, "Refused blobs weren't replaced");
+            break;
+    }
+
+    LogInfo("Pipeline Cache: Validation %s", Failures ? "FAIL" : "PASS");
+    return Failures;
+}
@@ -0,0 +1,68 @@
+/**
+ *  Author: Amélie Heinrich
+ *  Company: Amélie Games
+ *  License: MIT
+ *  Create Time: 17/10/2026 18:45
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "gpu_pipeline.hpp"
+
+#define GPU_PIPELINE_CACHE_MAGIC 0x48435047 // NOTE(amelie.h): "GPCH"
+#define GPU_PIPELINE_CACHE_VERSION 1
+
+struct gpu_pipeline_cache_entry
+{
+    std::vector<uint8_t> Data;
+    bool Used;
+};
+
+// NOTE(amelie.h): Hits and misses count pipeline creations, Stale counts cached blobs the driver refused.
+struct gpu_pipeline_cache_stats
+{
+    uint32_t Hits;
+    uint32_t Misses;
+    uint32_t Stale;
+    uint32_t Loaded;
+};
+
+// NOTE(amelie.h): What a run should have seen. Cold starts without a cache file, Warm right after a run that saved one,
+// Stale with blobs the driver refuses (another GPU or driver version, or a damaged file).
+enum class gpu_pipeline_cache_run
+{
+    Cold,
+    Warm,
+    Stale
+};
+
+// NOTE(amelie.h): Backend blobs keyed by a hash of the pipeline create info and the shader code, kept on disk between
+// runs. Pipelines are created on the main thread, so there is no lock.
+struct gpu_pipeline_cache
+{
+    std::string Path;
+    std::unordered_map<uint64_t, gpu_pipeline_cache_entry> Entries;
+    gpu_pipeline_cache_stats Stats;
+    bool Dirty;
+};
+
+// NOTE(amelie.h): An empty path keeps the cache in memory only.
+void GpuPipelineCacheLoad(gpu_pipeline_cache *Cache, const std::string& Path);
+// NOTE(amelie.h): Only writes when something was stored, and drops entries nothing asked for this run so blobs of
+// shaders that were edited since don't pile up.
+void GpuPipelineCacheSave(gpu_pipeline_cache *Cache);
+void GpuPipelineCacheClear(gpu_pipeline_cache *Cache);
+
+// NOTE(amelie.h): Hashes everything in the create info except the shader, backends chain their shader code on top.
+uint64_t GpuPipelineCacheHashInfo(const gpu_pipeline_create_info *Info);
+
+const std::vector<uint8_t> *GpuPipelineCacheFind(gpu_pipeline_cache *Cache, uint64_t Key);
+void GpuPipelineCacheStore(gpu_pipeline_cache *Cache, uint64_t Key, const void *Data, uint64_t Size);
+void GpuPipelineCacheLogStats(const gpu_pipeline_cache *Cache);
+// NOTE(amelie.h): Checks the stats against the kind of run, returns how many expectations failed.
+uint32_t GpuPipelineCacheValidate(const gpu_pipeline_cache *Cache, gpu_pipeline_cache_run Run);
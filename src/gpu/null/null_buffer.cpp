@@ -0,0 +1,65 @@
+/**
+ *  Author: Amélie Heinrich
+ *  Company: Amélie Games
+ *  License: MIT
+ *  Create Time: 17/10/2026 09:31
+ */
+
+#include "null_buffer.hpp"
+
+#include "null_context.hpp"
+#include "systems/log_system.hpp"
+
+#include <cstdlib>
+#include <cstring>
+
+void NullBufferAllocate(gpu_buffer *Buffer, uint64_t Size)
+{
+    Buffer->Size = Size;
+    Buffer->Reserved = (void*)(new null_buffer);
+
+    null_buffer *Private = (null_buffer*)Buffer->Reserved;
+    Private->Memory = calloc(1, Size);
+    if (!Private->Memory)
+        LogError("Null: Failed to allocate buffer of size %llu!", (unsigned long long)Size);
+}
+
+void GpuBufferInit(gpu_buffer *Buffer, uint64_t Size, uint64_t Stride, gpu_buffer_type Type)
+{
+    NullBufferAllocate(Buffer, Size);
+    Buffer->Stride = Stride;
+    Buffer->Type = Type;
+    if (Type == gpu_buffer_type::Index && Stride != sizeof(uint16_t) && Stride != sizeof(uint32_t))
+        LogError("Null: Index buffer stride must be 2 or 4 bytes, got %llu!", (unsigned long long)Stride);
+}
+
+void GpuBufferInitForUpload(gpu_buffer *Buffer, uint64_t Size)
+{
+    NullBufferAllocate(Buffer, Size);
+}
+
+void GpuBufferInitForCopy(gpu_buffer *Buffer, uint64_t Size)
+{
+    NullBufferAllocate(Buffer, Size);
+}
+
+void GpuBufferFree(gpu_buffer *Buffer)
+{
+    null_buffer *Private = (null_buffer*)Buffer->Reserved;
+    free(Private->Memory);
+    delete Private;
+}
+
+void GpuBufferUpload(gpu_buffer *Buffer, const void *Data, uint64_t Size)
+{
+    null_buffer *Private = (null_buffer*)Buffer->Reserved;
+
+    if (Size > Buffer->Size)
+    {
+        LogError("Null: Upload of %llu bytes overflows buffer of size %llu!", (unsigned long long)Size, (unsigned long long)Buffer->Size);
+        Size = Buffer->Size;
+    }
+
+    memcpy(Private->Memory, Data, Size);
+    NullContextRecordUpload(Size);
+}
@@ -0,0 +1,17 @@
+/**
+ *  Author: Amélie Heinrich
+ *  Company: Amélie Games
+ *  License: MIT
+ *  Create Time: 17/10/2026 09:15
+ */
+
+#pragma once
+
+#include "gpu/gpu_buffer.hpp"
+
+#include <cstdint>
+
+struct null_buffer
+{
+    void *Memory;
+};
@@ -0,0 +1,363 @@
+/**
+ *  Author: Amélie Heinrich
+ *  Company: Amélie Games
+ *  License: MIT
+ *  Create Time: 17/10/2026 09:40
+ */
+
+#include "null_command_buffer.hpp"
+
+#include "null_context.hpp"
+#include "null_pipeline.hpp"
+#include "systems/log_system.hpp"
+
+null_command *NullCommandBufferPush(gpu_command_buffer *Command, null_command_type Type, void *First = nullptr, void *Second = nullptr)
+{
+    null_command_buffer *Private = (null_command_buffer*)Command->Private;
+    if (!Private->Recording)
+        LogWarn("Null: Recording %s into a command buffer that was not begun!", NullCommandTypeString(Type));
+
+    null_command Recorded = {};
+    Recorded.Type = Type;
+    Recorded.Resources[0] = First;
+    Recorded.Resources[1] = Second;
+    Private->Commands.push_back(Recorded);
+    return &Private->Commands.back();
+}
+
+void NullCommandBufferFlushBarriers(gpu_command_buffer *Command)
+{
+    null_command_buffer *Private = (null_command_buffer*)Command->Private;
+    if (!Private->PendingBarriers)
+        return;
+
+    null_command *Recorded = NullCommandBufferPush(Command, null_command_type::FlushBarriers);
+    Recorded->Arguments[0] = Private->PendingBarriers;
+    Private->PendingBarriers = 0;
+    Private->BatchStart = Private->Commands.size();
+}
+
+// NOTE(amelie.h): Arguments are old layout, new layout and the split half (0 whole, 1 begin, 2 end). Plain transitions
+// fold into a pending one that ends where they start, without reaching past an aliasing barrier, same as the D3D12
+// backend, so barrier counts line up.
+void NullCommandBufferPushTransition(gpu_command_buffer *Command, null_command_type Type, void *Resource, gpu_image_layout Old, gpu_image_layout New, int32_t Split)
+{
+    null_command_buffer *Private = (null_command_buffer*)Command->Private;
+    if (Old == New)
+    {
+        Private->RedundantBarriers++;
+        return;
+    }
+
+    if (!Split)
+    {
+        for (size_t CommandIndex = Private->Commands.size(); CommandIndex > Private->BatchStart; CommandIndex--)
+        {
+            null_command& Pending = Private->Commands[CommandIndex - 1];
+            if (Pending.Type == null_command_type::AliasingBarrier)
+                break;
+            if (Pending.Type != Type || Pending.Resources[0] != Resource || Pending.Arguments[2] || Pending.Arguments[1] != (int32_t)Old)
+                continue;
+
+            Pending.Arguments[1] = (int32_t)New;
+            if (Pending.Arguments[0] == Pending.Arguments[1])
+            {
+                Private->Commands.erase(Private->Commands.begin() + CommandIndex - 1);
+                Private->PendingBarriers--;
+            }
+            Private->RedundantBarriers++;
+            return;
+        }
+    }
+
+    null_command *Recorded = NullCommandBufferPush(Command, Type, Resource);
+    Recorded->Arguments[0] = (int32_t)Old;
+    Recorded->Arguments[1] = (int32_t)New;
+    Recorded->Arguments[2] = Split;
+    Private->PendingBarriers++;
+}
+
+const char *NullCommandTypeString(null_command_type Type)
+{
+    switch (Type)
+    {
+        case null_command_type::BindBuffer: return "BindBuffer";
+        case null_command_type::BindPipeline: return "BindPipeline";
+        case null_command_type::BindConstantBuffer: return "BindConstantBuffer";
+        case null_command_type::BindShaderResource: return "BindShaderResource";
+        case null_command_type::BindStorageImage: return "BindStorageImage";
+        case null_command_type::BindStorageBuffer: return "BindStorageBuffer";
+        case null_command_type::BindSampler: return "BindSampler";
+        case null_command_type::BindRenderTarget: return "BindRenderTarget";
+        case null_command_type::ClearColor: return "ClearColor";
+        case null_command_type::ClearDepth: return "ClearDepth";
+        case null_command_type::SetViewport: return "SetViewport";
+        case null_command_type::Draw: return "Draw";
+        case null_command_type::DrawIndexed: return "DrawIndexed";
+        case null_command_type::DrawIndexedIndirect: return "DrawIndexedIndirect";
+        case null_command_type::Dispatch: return "Dispatch";
+        case null_command_type::BeginPipelineStatistics: return "BeginPipelineStatistics";
+        case null_command_type::EndPipelineStatistics: return "EndPipelineStatistics";
+        case null_command_type::BufferBarrier: return "BufferBarrier";
+        case null_command_type::ImageBarrier: return "ImageBarrier";
+        case null_command_type::AliasingBarrier: return "AliasingBarrier";
+        case null_command_type::FlushBarriers: return "FlushBarriers";
+        case null_command_type::DiscardImage: return "DiscardImage";
+        case null_command_type::Blit: return "Blit";
+        case null_command_type::CopyBufferToTexture: return "CopyBufferToTexture";
+        case null_command_type::CopyTextureToBuffer: return "CopyTextureToBuffer";
+        case null_command_type::CopyBufferToBuffer: return "CopyBufferToBuffer";
+    }
+    return "Unknown";
+}
+
+void GpuCommandBufferInit(gpu_command_buffer *Buffer, gpu_command_buffer_type Type)
+{
+    Buffer->Type = Type;
+    Buffer->Private = (void*)(new null_command_buffer);
+
+    null_command_buffer *Private = (null_command_buffer*)Buffer->Private;
+    Private->Recording = false;
+    Private->BatchStart = 0;
+    Private->PendingBarriers = 0;
+    Private->RedundantBarriers = 0;
+}
+
+void GpuCommandBufferFree(gpu_command_buffer *Buffer)
+{
+    null_command_buffer *Private = (null_command_buffer*)Buffer->Private;
+    delete Private;
+}
+
+void GpuCommandBufferBindBuffer(gpu_command_buffer *Command, gpu_buffer *Buffer)
+{
+    NullCommandBufferPush(Command, null_command_type::BindBuffer, Buffer);
+}
+
+void GpuCommandBufferBindPipeline(gpu_command_buffer *Command, gpu_pipeline *Pipeline)
+{
+    NullCommandBufferPush(Command, null_command_type::BindPipeline, Pipeline);
+}
+
+void GpuCommandBufferBindConstantBuffer(gpu_command_buffer *Command, gpu_pipeline_type Type, gpu_buffer *Buffer, int Offset)
+{
+    null_command *Recorded = NullCommandBufferPush(Command, null_command_type::BindConstantBuffer, Buffer);
+    Recorded->Arguments[0] = (int32_t)Type;
+    Recorded->Arguments[1] = Offset;
+}
+
+void GpuCommandBufferBindFrameAllocation(gpu_command_buffer *Command, gpu_pipeline_type Type, gpu_frame_allocation *Allocation, int Offset)
+{
+    null_command *Recorded = NullCommandBufferPush(Command, null_command_type::BindConstantBuffer, Allocation->Data);
+    Recorded->Arguments[0] = (int32_t)Type;
+    Recorded->Arguments[1] = Offset;
+}
+
+void GpuCommandBufferBindShaderResource(gpu_command_buffer *Command, gpu_pipeline_type Type, gpu_image *Image, int Offset)
+{
+    null_command *Recorded = NullCommandBufferPush(Command, null_command_type::BindShaderResource, Image);
+    Recorded->Arguments[0] = (int32_t)Type;
+    Recorded->Arguments[1] = Offset;
+}
+
+void GpuCommandBufferBindStorageImage(gpu_command_buffer *Command, gpu_pipeline_type Type, gpu_image *Image, int Offset)
+{
+    null_command *Recorded = NullCommandBufferPush(Command, null_command_type::BindStorageImage, Image);
+    Recorded->Arguments[0] = (int32_t)Type;
+    Recorded->Arguments[1] = Offset;
+}
+
+void GpuCommandBufferBindStorageBuffer(gpu_command_buffer *Command, gpu_pipeline_type Type, gpu_buffer *Buffer, int Offset)
+{
+    null_command *Recorded = NullCommandBufferPush(Command, null_command_type::BindStorageBuffer, Buffer);
+    Recorded->Arguments[0] = (int32_t)Type;
+    Recorded->Arguments[1] = Offset;
+}
+
+void GpuCommandBufferBindSampler(gpu_command_buffer *Command, gpu_pipeline_type Type, gpu_sampler *Sampler, int Offset)
+{
+    null_command *Recorded = NullCommandBufferPush(Command, null_command_type::BindSampler, Sampler);
+    Recorded->Arguments[0] = (int32_t)Type;
+    Recorded->Arguments[1] = Offset;
+}
+
+void GpuCommandBufferBindRenderTarget(gpu_command_buffer *Command, gpu_image *Image, gpu_image *Depth)
+{
+    NullCommandBufferFlushBarriers(Command);
+    NullCommandBufferPush(Command, null_command_type::BindRenderTarget, Image, Depth);
+}
+
+void GpuCommandBufferClearColor(gpu_command_buffer *Command, gpu_image *Image, float Red, float Green, float Blue, float Alpha)
+{
+    NullCommandBufferFlushBarriers(Command);
+    null_command *Recorded = NullCommandBufferPush(Command, null_command_type::ClearColor, Image);
+    Recorded->Values[0] = Red;
+    Recorded->Values[1] = Green;
+    Recorded->Values[2] = Blue;
+    Recorded->Values[3] = Alpha;
+}
+
+void GpuCommandBufferClearDepth(gpu_command_buffer *Command, gpu_image *Image, float Depth, float Stencil)
+{
+    NullCommandBufferFlushBarriers(Command);
+    null_command *Recorded = NullCommandBufferPush(Command, null_command_type::ClearDepth, Image);
+    Recorded->Values[0] = Depth;
+    Recorded->Values[1] = Stencil;
+}
+
+void GpuCommandBufferSetViewport(gpu_command_buffer *Command, float Width, float Height, float X, float Y)
+{
+    null_command *Recorded = NullCommandBufferPush(Command, null_command_type::SetViewport);
+    Recorded->Values[0] = Width;
+    Recorded->Values[1] = Height;
+    Recorded->Values[2] = X;
+    Recorded->Values[3] = Y;
+}
+
+void GpuCommandBufferDraw(gpu_command_buffer *Command, int VertexCount)
+{
+    NullCommandBufferFlushBarriers(Command);
+    null_command *Recorded = NullCommandBufferPush(Command, null_command_type::Draw);
+    Recorded->Arguments[0] = VertexCount;
+}
+
+void GpuCommandBufferDrawIndexed(gpu_command_buffer *Command, int IndexCount, int FirstIndex)
+{
+    GpuCommandBufferDrawIndexedInstanced(Command, IndexCount, 1, FirstIndex);
+}
+
+void GpuCommandBufferDrawIndexedInstanced(gpu_command_buffer *Command, int IndexCount, int InstanceCount, int FirstIndex)
+{
+    NullCommandBufferFlushBarriers(Command);
+    null_command *Recorded = NullCommandBufferPush(Command, null_command_type::DrawIndexed);
+    Recorded->Arguments[0] = IndexCount;
+    Recorded->Arguments[1] = FirstIndex;
+    Recorded->Arguments[2] = InstanceCount;
+}
+
+void GpuCommandBufferDrawIndexedIndirect(gpu_command_buffer *Command, gpu_frame_allocation *Arguments, uint32_t FirstDraw, uint32_t MaxDrawCount, gpu_frame_allocation *Counts, uint32_t CountIndex)
+{
+    // NOTE(amelie.h): Frame allocations stay valid until the frame is submitted, the arguments are read back there.
+    NullCommandBufferFlushBarriers(Command);
+    null_command *Recorded = NullCommandBufferPush(Command, null_command_type::DrawIndexedIndirect, (gpu_draw_indexed_arguments*)Arguments->Data + FirstDraw, Counts ? (uint32_t*)Counts->Data + CountIndex : nullptr);
+    Recorded->Arguments[0] = MaxDrawCount;
+}
+
+void GpuCommandBufferDispatch(gpu_command_buffer *Command, int X, int Y, int Z)
+{
+    NullCommandBufferFlushBarriers(Command);
+    null_command *Recorded = NullCommandBufferPush(Command, null_command_type::Dispatch);
+    Recorded->Arguments[0] = X;
+    Recorded->Arguments[1] = Y;
+    Recorded->Arguments[2] = Z;
+}
+
+void GpuCommandBufferBeginPipelineStatistics(gpu_command_buffer *Command, gpu_pipeline_profiler *Profiler)
+{
+    NullCommandBufferPush(Command, null_command_type::BeginPipelineStatistics, Profiler);
+}
+
+void GpuCommandBufferEndPipelineStatistics(gpu_command_buffer *Command, gpu_pipeline_profiler *Profiler)
+{
+    NullCommandBufferFlushBarriers(Command);
+    NullCommandBufferPush(Command, null_command_type::EndPipelineStatistics, Profiler);
+}
+
+void GpuCommandBufferBufferBarrier(gpu_command_buffer *Command, gpu_buffer *Buffer, gpu_buffer_layout Old, gpu_buffer_layout New)
+{
+    NullCommandBufferPushTransition(Command, null_command_type::BufferBarrier, Buffer, Old, New, 0);
+}
+
+void GpuCommandBufferImageBarrier(gpu_command_buffer *Command, gpu_image *Image, gpu_image_layout New)
+{
+    NullCommandBufferPushTransition(Command, null_command_type::ImageBarrier, Image, Image->Layout, New, 0);
+    Image->Layout = New;
+}
+
+void GpuCommandBufferImageBarrierBegin(gpu_command_buffer *Command, gpu_image *Image, gpu_image_layout New)
+{
+    NullCommandBufferPushTransition(Command, null_command_type::ImageBarrier, Image, Image->Layout, New, 1);
+}
+
+void GpuCommandBufferImageBarrierEnd(gpu_command_buffer *Command, gpu_image *Image, gpu_image_layout New)
+{
+    NullCommandBufferPushTransition(Command, null_command_type::ImageBarrier, Image, Image->Layout, New, 2);
+    Image->Layout = New;
+}
+
+void GpuCommandBufferImageTransition(gpu_command_buffer *Command, gpu_image *Image, gpu_image_layout Old, gpu_image_layout New)
+{
+    NullCommandBufferPushTransition(Command, null_command_type::ImageBarrier, Image, Old, New, 0);
+}
+
+void GpuCommandBufferAliasingBarrier(gpu_command_buffer *Command, gpu_image *Before, gpu_image *After)
+{
+    null_command_buffer *Private = (null_command_buffer*)Command->Private;
+
+    NullCommandBufferPush(Command, null_command_type::AliasingBarrier, Before, After);
+    Private->PendingBarriers++;
+}
+
+void GpuCommandBufferDiscardImage(gpu_command_buffer *Command, gpu_image *Image)
+{
+    NullCommandBufferFlushBarriers(Command);
+    NullCommandBufferPush(Command, null_command_type::DiscardImage, Image);
+}
+
+void GpuCommandBufferBlit(gpu_command_buffer *Command, gpu_image *Source, gpu_image *Dest)
+{
+    NullCommandBufferFlushBarriers(Command);
+    NullCommandBufferPush(Command, null_command_type::Blit, Source, Dest);
+}
+
+void GpuCommandBufferCopyBufferToTexture(gpu_command_buffer *Command, gpu_buffer *Source, gpu_image *Dest)
+{
+    NullCommandBufferFlushBarriers(Command);
+    NullCommandBufferPush(Command, null_command_type::CopyBufferToTexture, Source, Dest);
+}
+
+void GpuCommandBufferCopyTextureToBuffer(gpu_command_buffer *Command, gpu_image *Source, gpu_buffer *Dest)
+{
+    NullCommandBufferFlushBarriers(Command);
+    NullCommandBufferPush(Command, null_command_type::CopyTextureToBuffer, Source, Dest);
+}
+
+void GpuCommandBufferCopyBufferToBuffer(gpu_command_buffer *Command, gpu_buffer *Source, gpu_buffer *Dest)
+{
+    NullCommandBufferFlushBarriers(Command);
+    NullCommandBufferPush(Command, null_command_type::CopyBufferToBuffer, Source, Dest);
+}
+
+void GpuCommandBufferBegin(gpu_command_buffer *Command)
+{
+    null_command_buffer *Private = (null_command_buffer*)Command->Private;
+
+    Private->Commands.clear();
+    Private->Recording = true;
+    Private->BatchStart = 0;
+    Private->PendingBarriers = 0;
+    Private->RedundantBarriers = 0;
+}
+
+void GpuCommandBufferEnd(gpu_command_buffer *Command)
+{
+    null_command_buffer *Private = (null_command_buffer*)Command->Private;
+
+    NullCommandBufferFlushBarriers(Command);
+    Private->Recording = false;
+}
+
+void GpuCommandBufferFlush(gpu_command_buffer *Command)
+{
+    NullContextSubmit(&Command, 1);
+}
+
+void GpuCommandBufferSubmit(gpu_command_buffer **Buffers, uint32_t Count)
+{
+    NullContextSubmit(Buffers, Count);
+}
+
+void GpuCommandBufferScreenshot(gpu_command_buffer *, gpu_image *, gpu_buffer *)
+{
+    LogWarn("Null: Screenshots are not available on the null backend!");
+}
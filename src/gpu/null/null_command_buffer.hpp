@@ -0,0 +1,65 @@
+/**
+ *  Author: Amélie Heinrich
+ *  Company: Amélie Games
+ *  License: MIT
+ *  Create Time: 17/10/2026 09:14
+ */
+
+#pragma once
+
+#include "gpu/gpu_command_buffer.hpp"
+
+#include <cstdint>
+#include <vector>
+
+enum class null_command_type
+{
+    BindBuffer,
+    BindPipeline,
+    BindConstantBuffer,
+    BindShaderResource,
+    BindStorageImage,
+    BindStorageBuffer,
+    BindSampler,
+    BindRenderTarget,
+    ClearColor,
+    ClearDepth,
+    SetViewport,
+    Draw,
+    DrawIndexed,
+    DrawIndexedIndirect,
+    Dispatch,
+    BeginPipelineStatistics,
+    EndPipelineStatistics,
+    BufferBarrier,
+    ImageBarrier,
+    AliasingBarrier,
+    FlushBarriers,
+    DiscardImage,
+    Blit,
+    CopyBufferToTexture,
+    CopyTextureToBuffer,
+    CopyBufferToBuffer
+};
+
+struct null_command
+{
+    null_command_type Type;
+    void *Resources[2];
+    int32_t Arguments[4];
+    float Values[4];
+};
+
+// NOTE(amelie.h): Barriers are batched like on D3D12. The ones recorded since BatchStart go out in one FlushBarriers
+// command before the next command that needs them.
+struct null_command_buffer
+{
+    std::vector<null_command> Commands;
+    bool Recording;
+
+    size_t BatchStart;
+    uint32_t PendingBarriers;
+    uint32_t RedundantBarriers;
+};
+
+const char *NullCommandTypeString(null_command_type Type);
@@ -0,0 +1,271 @@
+/**
+ *  Author: Amélie Heinrich
+ *  Company: Amélie Games
+ *  License: MIT
+ *  Create Time: 17/10/2026 09:20
+ */
+
+#include "null_context.hpp"
+#include "null_image.hpp"
+
+#include "game_data.hpp"
+#include "gui/dev_terminal.hpp"
+#include "systems/log_system.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+null_context NullGpu;
+
+gpu_backend GpuGetBackend()
+{
+    return gpu_backend::Null;
+}
+
+void NullContextSubmit(gpu_command_buffer **Buffers, uint32_t Count)
+{
+    NullGpu.Frame.Submits++;
+    for (uint32_t BufferIndex = 0; BufferIndex < Count; BufferIndex++)
+    {
+        null_command_buffer *Private = (null_command_buffer*)Buffers[BufferIndex]->Private;
+
+        NullGpu.Frame.Commands += Private->Commands.size();
+        NullGpu.Frame.RedundantBarriers += Private->RedundantBarriers;
+        for (auto& Recorded : Private->Commands)
+        {
+            switch (Recorded.Type)
+            {
+                case null_command_type::Draw:
+                    NullGpu.Frame.Draws++;
+                    break;
+                case null_command_type::DrawIndexed:
+                    NullGpu.Frame.Draws++;
+                    NullGpu.Frame.Instances += Recorded.Arguments[2];
+                    NullGpu.Frame.Indices += (uint64_t)Recorded.Arguments[0] * Recorded.Arguments[2];
+                    break;
+                case null_command_type::DrawIndexedIndirect: {
+                    uint32_t DrawCount = (uint32_t)Recorded.Arguments[0];
+                    if (Recorded.Resources[1])
+                        DrawCount = std::min(DrawCount, *(uint32_t*)Recorded.Resources[1]);
+
+                    gpu_draw_indexed_arguments *Draws = (gpu_draw_indexed_arguments*)Recorded.Resources[0];
+                    NullGpu.Frame.IndirectCalls++;
+                    NullGpu.Frame.Draws += DrawCount;
+                    for (uint32_t DrawIndex = 0; DrawIndex < DrawCount; DrawIndex++)
+                    {
+                        NullGpu.Frame.Instances += Draws[DrawIndex].InstanceCount;
+                        NullGpu.Frame.Indices += (uint64_t)Draws[DrawIndex].IndexCount * Draws[DrawIndex].InstanceCount;
+                    }
+                } break;
+                case null_command_type::Dispatch:
+                    NullGpu.Frame.Dispatches++;
+                    break;
+                case null_command_type::BufferBarrier:
+                case null_command_type::ImageBarrier:
+                    // NOTE(amelie.h): A split barrier is one transition, counted on its end.
+                    if (Recorded.Arguments[2] != 1)
+                        NullGpu.Frame.Barriers++;
+                    if (Recorded.Arguments[2] == 2)
+                        NullGpu.Frame.SplitBarriers++;
+                    break;
+                case null_command_type::AliasingBarrier:
+                    NullGpu.Frame.Barriers++;
+                    break;
+                case null_command_type::FlushBarriers:
+                    NullGpu.Frame.BarrierBatches++;
+                    break;
+                case null_command_type::Blit:
+                case null_command_type::CopyBufferToTexture:
+                case null_command_type::CopyTextureToBuffer:
+                case null_command_type::CopyBufferToBuffer:
+                    NullGpu.Frame.Copies++;
+                    break;
+                case null_command_type::BindPipeline:
+                    NullGpu.Frame.PipelineBinds++;
+                    break;
+                case null_command_type::BindBuffer:
+                case null_command_type::BindConstantBuffer:
+                case null_command_type::BindShaderResource:
+                case null_command_type::BindStorageImage:
+                case null_command_type::BindStorageBuffer:
+                case null_command_type::BindSampler:
+                    NullGpu.Frame.ResourceBinds++;
+                    break;
+                default:
+                    break;
+            }
+        }
+
+        NullGpu.FrameStream.insert(NullGpu.FrameStream.end(), Private->Commands.begin(), Private->Commands.end());
+    }
+}
+
+void NullContextRecordUpload(uint64_t Size)
+{
+    // NOTE(amelie.h): Uploads can come from pass recording jobs.
+    std::lock_guard<std::mutex> Guard(NullGpu.UploadLock);
+    NullGpu.Frame.Uploads++;
+    NullGpu.Frame.UploadBytes += Size;
+}
+
+void NullContextLogStats(null_frame_stats *Stats)
+{
+    LogInfo("Null: Frame %llu | %llu submits, %llu commands, %llu draws (%llu indirect calls, %llu instances, %llu indices), %llu dispatches, %llu copies",
+            (unsigned long long)NullGpu.FrameCount,
+            (unsigned long long)Stats->Submits,
+            (unsigned long long)Stats->Commands,
+            (unsigned long long)Stats->Draws,
+            (unsigned long long)Stats->IndirectCalls,
+            (unsigned long long)Stats->Instances,
+            (unsigned long long)Stats->Indices,
+            (unsigned long long)Stats->Dispatches,
+            (unsigned long long)Stats->Copies);
+    LogInfo("Null: %llu barriers in %llu batches (%llu split, %llu redundant dropped)",
+            (unsigned long long)Stats->Barriers,
+            (unsigned long long)Stats->BarrierBatches,
+            (unsigned long long)Stats->SplitBarriers,
+            (unsigned long long)Stats->RedundantBarriers);
+    LogInfo("Null: %llu pipeline binds, %llu resource binds, %llu uploads (%llu bytes), %llu frame allocated bytes",
+            (unsigned long long)Stats->PipelineBinds,
+            (unsigned long long)Stats->ResourceBinds,
+            (unsigned long long)Stats->Uploads,
+            (unsigned long long)Stats->UploadBytes,
+            (unsigned long long)Stats->FrameAllocatedBytes);
+}
+
+void GpuInit()
+{
+    NullGpu.Width = EgcI32(EgcFile, "width");
+    NullGpu.Height = EgcI32(EgcFile, "height");
+    NullGpu.FrameIndex = 0;
+    NullGpu.FrameCount = 0;
+    memset(&NullGpu.Frame, 0, sizeof(null_frame_stats));
+    memset(&NullGpu.LastFrame, 0, sizeof(null_frame_stats));
+
+    int BufferCount = EgcI32(EgcFile, "buffer_count");
+
+    NullGpu.CommandBuffers.resize(BufferCount);
+    NullGpu.SwapChainImages.resize(BufferCount);
+    for (int FrameIndex = 0; FrameIndex < BufferCount; FrameIndex++)
+    {
+        GpuCommandBufferInit(&NullGpu.CommandBuffers[FrameIndex], gpu_command_buffer_type::Graphics);
+        GpuImageInit(&NullGpu.SwapChainImages[FrameIndex], NullGpu.Width, NullGpu.Height, gpu_image_format::RGBA8, gpu_image_usage::ImageUsageRenderTarget);
+        NullGpu.SwapChainImages[FrameIndex].Layout = gpu_image_layout::ImageLayoutPresent;
+    }
+
+    NullGpu.PassCommandBuffers.resize(BufferCount * GPU_MAX_PASS_COMMAND_BUFFERS);
+    for (auto& PassBuffer : NullGpu.PassCommandBuffers)
+        GpuCommandBufferInit(&PassBuffer, gpu_command_buffer_type::Graphics);
+
+    // NOTE(amelie.h): The null device finishes work as soon as it's submitted, so only the configured pacing is reported.
+    int FramesInFlight = EgcI32(EgcFile, "frames_in_flight");
+    NullGpu.Metrics = {};
+    NullGpu.Metrics.FramesInFlight = (FramesInFlight <= 0 || FramesInFlight > BufferCount) ? BufferCount : FramesInFlight;
+
+    NullGpu.FrameMemory.resize((uint64_t)BufferCount * GPU_FRAME_ALLOCATOR_SLICES * GPU_FRAME_ALLOCATOR_ALIGNMENT);
+    NullGpu.FrameAllocatorHead = 0;
+
+    GpuPipelineCacheLoad(&NullGpu.PipelineCache, EgcStr(EgcFile, "pipeline_cache"));
+
+    DevTerminalAddCommand("gpu_null_stats", [](const std::vector<std::string>&) {
+        NullContextLogStats(&NullGpu.LastFrame);
+    });
+
+    LogInfo("Null: Using headless device (%dx%d, %d buffers)", NullGpu.Width, NullGpu.Height, BufferCount);
+}
+
+void GpuExit()
+{
+    for (auto& PassBuffer : NullGpu.PassCommandBuffers)
+        GpuCommandBufferFree(&PassBuffer);
+    NullGpu.PassCommandBuffers.clear();
+
+    for (uint32_t FrameIndex = 0; FrameIndex < NullGpu.CommandBuffers.size(); FrameIndex++)
+    {
+        GpuImageFree(&NullGpu.SwapChainImages[FrameIndex]);
+        GpuCommandBufferFree(&NullGpu.CommandBuffers[FrameIndex]);
+    }
+    NullGpu.SwapChainImages.clear();
+    NullGpu.CommandBuffers.clear();
+    NullGpu.FrameStream.clear();
+    NullGpu.FrameMemory.clear();
+
+    GpuPipelineCacheSave(&NullGpu.PipelineCache);
+    GpuPipelineCacheClear(&NullGpu.PipelineCache);
+}
+
+void GpuBeginFrame()
+{
+    NullGpu.FrameIndex = NullGpu.FrameCount % NullGpu.CommandBuffers.size();
+    NullGpu.FrameStream.clear();
+    NullGpu.FrameAllocatorHead = 0;
+    memset(&NullGpu.Frame, 0, sizeof(null_frame_stats));
+}
+
+void GpuEndFrame()
+{
+    NullGpu.Frame.FrameAllocatedBytes += (uint64_t)NullGpu.FrameAllocatorHead * GPU_FRAME_ALLOCATOR_ALIGNMENT;
+    NullGpu.LastFrame = NullGpu.Frame;
+    NullGpu.FrameCount++;
+}
+
+void GpuResize(uint32_t Width, uint32_t Height)
+{
+    NullGpu.Width = Width;
+    NullGpu.Height = Height;
+
+    for (auto& Image : NullGpu.SwapChainImages)
+    {
+        GpuImageFree(&Image);
+        GpuImageInit(&Image, Width, Height, gpu_image_format::RGBA8, gpu_image_usage::ImageUsageRenderTarget);
+        Image.Layout = gpu_image_layout::ImageLayoutPresent;
+    }
+}
+
+void GpuPresent()
+{
+
+}
+
+void GpuWait()
+{
+
+}
+
+hmm_v2 GpuGetDimensions()
+{
+    hmm_v2 Result;
+    Result.X = NullGpu.Width;
+    Result.Y = NullGpu.Height;
+    return (Result);
+}
+
+gpu_command_buffer* GpuGetImageCommandBuffer()
+{
+    return &NullGpu.CommandBuffers[NullGpu.FrameIndex];
+}
+
+gpu_command_buffer* GpuGetPassCommandBuffer(uint32_t Index)
+{
+    if (Index >= GPU_MAX_PASS_COMMAND_BUFFERS)
+    {
+        LogError("Null: Pass command buffer %u out of range!", Index);
+        Index = GPU_MAX_PASS_COMMAND_BUFFERS - 1;
+    }
+    return &NullGpu.PassCommandBuffers[NullGpu.FrameIndex * GPU_MAX_PASS_COMMAND_BUFFERS + Index];
+}
+
+gpu_image* GpuGetSwapChainImage()
+{
+    return &NullGpu.SwapChainImages[NullGpu.FrameIndex];
+}
+
+gpu_frame_metrics GpuGetFrameMetrics()
+{
+    return NullGpu.Metrics;
+}
+
+gpu_pipeline_cache* GpuGetPipelineCache()
+{
+    return &NullGpu.PipelineCache;
+}
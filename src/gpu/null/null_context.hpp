@@ -0,0 +1,69 @@
+/**
+ *  Author: Amélie Heinrich
+ *  Company: Amélie Games
+ *  License: MIT
+ *  Create Time: 17/10/2026 09:12
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include "null_command_buffer.hpp"
+#include "math_types.hpp"
+#include "gpu/gpu_command_buffer.hpp"
+#include "gpu/gpu_context.hpp"
+
+struct null_frame_stats
+{
+    uint64_t Submits;
+    uint64_t Commands;
+    uint64_t Draws;
+    uint64_t IndirectCalls;
+    uint64_t Indices;
+    uint64_t Instances;
+    uint64_t Dispatches;
+    uint64_t Barriers;
+    uint64_t BarrierBatches;
+    uint64_t SplitBarriers;
+    uint64_t RedundantBarriers;
+    uint64_t Copies;
+    uint64_t PipelineBinds;
+    uint64_t ResourceBinds;
+    uint64_t Uploads;
+    uint64_t UploadBytes;
+    uint64_t FrameAllocatedBytes;
+};
+
+struct null_context
+{
+    uint32_t Width;
+    uint32_t Height;
+
+    std::vector<gpu_command_buffer> CommandBuffers;
+    std::vector<gpu_command_buffer> PassCommandBuffers;
+    std::vector<gpu_image> SwapChainImages;
+    uint32_t FrameIndex;
+    uint64_t FrameCount;
+
+    // NOTE(amelie.h): Everything submitted since the last GpuBeginFrame, in submission order.
+    std::vector<null_command> FrameStream;
+    null_frame_stats Frame;
+    null_frame_stats LastFrame;
+    std::mutex UploadLock;
+
+    gpu_frame_metrics Metrics;
+    gpu_pipeline_cache PipelineCache;
+
+    std::vector<uint8_t> FrameMemory;
+    std::atomic<uint32_t> FrameAllocatorHead;
+};
+
+extern null_context NullGpu;
+
+void NullContextSubmit(gpu_command_buffer **Buffers, uint32_t Count);
+void NullContextRecordUpload(uint64_t Size);
+void NullContextLogStats(null_frame_stats *Stats);
@@ -0,0 +1,127 @@
+/**
+ *  Author: Amélie Heinrich
+ *  Company: Amélie Games
+ *  License: MIT
+ *  Create Time: 17/10/2026 15:10
+ */
+
+#include "gpu/gpu_frame_allocator.hpp"
+
+#include "null_context.hpp"
+#include "gpu/gpu_context.hpp"
+#include "systems/log_system.hpp"
+
+gpu_frame_allocation GpuFrameAllocConstant(uint64_t Size)
+{
+    gpu_frame_allocation Result = {};
+    uint64_t SliceCount = (Size + GPU_FRAME_ALLOCATOR_ALIGNMENT - 1) / GPU_FRAME_ALLOCATOR_ALIGNMENT;
+
+    uint32_t Local = NullGpu.FrameAllocatorHead.load();
+    do
+    {
+        if (Local + SliceCount > GPU_FRAME_ALLOCATOR_SLICES)
+        {
+            LogError("Null: Frame allocator ran out of space (%llu slices requested, %u free)!", (unsigned long long)SliceCount, GPU_FRAME_ALLOCATOR_SLICES - Local);
+            return Result;
+        }
+    } while (!NullGpu.FrameAllocatorHead.compare_exchange_weak(Local, Local + (uint32_t)SliceCount));
+
+    Result.Slice = NullGpu.FrameIndex * GPU_FRAME_ALLOCATOR_SLICES + Local;
+    Result.Size = SliceCount * GPU_FRAME_ALLOCATOR_ALIGNMENT;
+    Result.Offset = (uint64_t)Result.Slice * GPU_FRAME_ALLOCATOR_ALIGNMENT;
+    Result.Data = NullGpu.FrameMemory.data() + Result.Offset;
+    return Result;
+}
+
+gpu_frame_allocation GpuFrameAllocStructured(uint32_t Count, uint32_t Stride)
+{
+    if (!Stride || GPU_FRAME_ALLOCATOR_ALIGNMENT % Stride)
+    {
+        LogError("Null: Structured frame allocation stride %u doesn't divide the slice alignment!", Stride);
+        Stride = GPU_FRAME_ALLOCATOR_ALIGNMENT;
+    }
+    return GpuFrameAllocConstant((uint64_t)Count * Stride);
+}
+
+gpu_frame_allocation GpuFrameAllocArguments(uint64_t Size)
+{
+    return GpuFrameAllocConstant(Size);
+}
+
+// NOTE(amelie.h): Plain memory, one region per swap chain buffer like the frame allocator.
+struct null_frame_buffer
+{
+    std::vector<uint8_t> Memory;
+    uint32_t FrameCount;
+};
+
+void GpuFrameBufferInit(gpu_frame_buffer *Buffer, uint64_t Capacity)
+{
+    null_frame_buffer *Private = new null_frame_buffer;
+    Private->FrameCount = (uint32_t)NullGpu.CommandBuffers.size();
+
+    Buffer->Capacity = GpuFrameAlign(Capacity);
+    Buffer->Head = 0;
+    Buffer->ViewCount = 0;
+    Buffer->Private = Private;
+    Private->Memory.resize(Buffer->Capacity * Private->FrameCount);
+}
+
+void GpuFrameBufferFree(gpu_frame_buffer *Buffer)
+{
+    delete (null_frame_buffer*)Buffer->Private;
+    Buffer->Private = nullptr;
+}
+
+void GpuFrameBufferReset(gpu_frame_buffer *Buffer, uint64_t Size)
+{
+    null_frame_buffer *Private = (null_frame_buffer*)Buffer->Private;
+    Buffer->Head = 0;
+    Buffer->ViewCount = 0;
+    if (Size <= Buffer->Capacity)
+        return;
+
+    GpuWait();
+    Buffer->Capacity = GpuFrameAlign(HMM_MAX(Size, Buffer->Capacity * 2));
+    Private->Memory.assign(Buffer->Capacity * Private->FrameCount, 0);
+    LogInfo("Null: Frame buffer grown to %llu bytes per frame", (unsigned long long)Buffer->Capacity);
+}
+
+gpu_frame_allocation GpuFrameBufferAllocArguments(gpu_frame_buffer *Buffer, uint64_t Size)
+{
+    null_frame_buffer *Private = (null_frame_buffer*)Buffer->Private;
+    gpu_frame_allocation Result = {};
+    uint64_t Aligned = GpuFrameAlign(Size);
+    if (Buffer->Head + Aligned > Buffer->Capacity)
+    {
+        LogError("Null: Frame buffer ran out of space (%llu bytes requested, %llu free)!", (unsigned long long)Size, (unsigned long long)(Buffer->Capacity - Buffer->Head));
+        return Result;
+    }
+
+    Result.Owner = Buffer;
+    Result.Size = Aligned;
+    Result.Offset = (uint64_t)NullGpu.FrameIndex * Buffer->Capacity + Buffer->Head;
+    Result.Data = Private->Memory.data() + Result.Offset;
+    Buffer->Head += Aligned;
+    NullGpu.Frame.FrameAllocatedBytes += Aligned;
+    return Result;
+}
+
+gpu_frame_allocation GpuFrameBufferAllocStructured(gpu_frame_buffer *Buffer, uint32_t Count, uint32_t Stride)
+{
+    if (!Stride || GPU_FRAME_ALLOCATOR_ALIGNMENT % Stride)
+    {
+        LogError("Null: Structured frame buffer allocation stride %u doesn't divide the slice alignment!", Stride);
+        Stride = GPU_FRAME_ALLOCATOR_ALIGNMENT;
+    }
+    if (Buffer->ViewCount == GPU_FRAME_BUFFER_VIEWS)
+    {
+        LogError("Null: Frame buffer is out of views (%u per frame)!", GPU_FRAME_BUFFER_VIEWS);
+        return {};
+    }
+
+    gpu_frame_allocation Result = GpuFrameBufferAllocArguments(Buffer, (uint64_t)Count * Stride);
+    if (Result.Data)
+        Result.Slice = NullGpu.FrameIndex * GPU_FRAME_BUFFER_VIEWS + Buffer->ViewCount++;
+    return Result;
+}
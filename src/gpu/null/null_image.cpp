@@ -0,0 +1,129 @@
+/**
+ *  Author: Amélie Heinrich
+ *  Company: Amélie Games
+ *  License: MIT
+ *  Create Time: 17/10/2026 09:35
+ */
+
+#include "null_image.hpp"
+
+#include "null_context.hpp"
+#include "systems/log_system.hpp"
+
+uint32_t NullImageFormatSize(gpu_image_format Format)
+{
+    switch (Format)
+    {
+        case gpu_image_format::RGBA8:
+            return 4;
+        case gpu_image_format::RGBA32Float:
+            return 16;
+        case gpu_image_format::RGBA16Float:
+            return 8;
+        case gpu_image_format::R32Depth:
+            return 4;
+    }
+    return 4;
+}
+
+void GpuImageInit(gpu_image *Image, uint32_t Width, uint32_t Height, gpu_image_format Format, gpu_image_usage Usage)
+{
+    Image->Width = Width;
+    Image->Height = Height;
+    Image->Format = Format;
+    Image->Usage = Usage;
+    Image->Private = (void*)(new null_image);
+
+    switch (Usage)
+    {
+        case gpu_image_usage::ImageUsageRenderTarget:
+            Image->Layout = gpu_image_layout::ImageLayoutRenderTarget;
+            break;
+        case gpu_image_usage::ImageUsageDepthTarget:
+            Image->Layout = gpu_image_layout::ImageLayoutDepth;
+            break;
+        case gpu_image_usage::ImageUsageStorage:
+            Image->Layout = gpu_image_layout::ImageLayoutStorage;
+            break;
+        case gpu_image_usage::ImageUsageShaderResource:
+            Image->Layout = gpu_image_layout::ImageLayoutShaderResource;
+            break;
+        default:
+            Image->Layout = gpu_image_layout::ImageLayoutCommon;
+            break;
+    }
+
+    null_image *Private = (null_image*)Image->Private;
+    Private->Size = (uint64_t)Width * Height * NullImageFormatSize(Format);
+}
+
+void GpuImageInitCopy(gpu_image *Image, uint32_t Width, uint32_t Height)
+{
+    GpuImageInit(Image, Width, Height, gpu_image_format::RGBA8, gpu_image_usage::ImageUsageCopy);
+    Image->Layout = gpu_image_layout::ImageLayoutCommon;
+}
+
+void GpuImageInitCubeMap(gpu_image *Image, uint32_t Width, uint32_t Height, gpu_image_format Format)
+{
+    GpuImageInit(Image, Width, Height, Format, gpu_image_usage::ImageUsageShaderResource);
+
+    null_image *Private = (null_image*)Image->Private;
+    Private->Size *= 6;
+}
+
+void GpuImageInitFromCPU(gpu_image *Image, cpu_image *CPU)
+{
+    GpuImageInit(Image, CPU->Width, CPU->Height, CPU->Float ? gpu_image_format::RGBA32Float : gpu_image_format::RGBA8, gpu_image_usage::ImageUsageShaderResource);
+
+    null_image *Private = (null_image*)Image->Private;
+
+    // NOTE(amelie.h): Go through the same staging path as the real backends so upload counts match.
+    gpu_buffer Temp;
+    GpuBufferInitForUpload(&Temp, Private->Size);
+    GpuBufferUpload(&Temp, CPU->Data, Private->Size);
+
+    gpu_command_buffer CommandBuffer;
+    GpuCommandBufferInit(&CommandBuffer, gpu_command_buffer_type::Upload);
+    GpuCommandBufferBegin(&CommandBuffer);
+    GpuCommandBufferCopyBufferToTexture(&CommandBuffer, &Temp, Image);
+    GpuCommandBufferEnd(&CommandBuffer);
+    GpuCommandBufferFlush(&CommandBuffer);
+    GpuCommandBufferFree(&CommandBuffer);
+
+    GpuBufferFree(&Temp);
+}
+
+void GpuMemoryInit(gpu_memory *Memory, uint64_t Size)
+{
+    Memory->Size = Size;
+    Memory->Private = nullptr;
+}
+
+void GpuMemoryFree(gpu_memory *Memory)
+{
+    Memory->Size = 0;
+}
+
+gpu_image_memory_info GpuImageGetMemoryInfo(uint32_t Width, uint32_t Height, gpu_image_format Format, gpu_image_usage)
+{
+    // NOTE(amelie.h): Same 64KB placement alignment as D3D12 so aliasing plans look like the real ones.
+    gpu_image_memory_info Info;
+    Info.Alignment = 65536;
+    Info.Size = ((uint64_t)Width * Height * NullImageFormatSize(Format) + Info.Alignment - 1) / Info.Alignment * Info.Alignment;
+    return Info;
+}
+
+void GpuImageInitPlaced(gpu_image *Image, uint32_t Width, uint32_t Height, gpu_image_format Format, gpu_image_usage Usage, gpu_memory *Memory, uint64_t Offset)
+{
+    GpuImageInit(Image, Width, Height, Format, Usage);
+
+    null_image *Private = (null_image*)Image->Private;
+    if (Offset + Private->Size > Memory->Size)
+        LogError("Null: Placed image (%llu bytes at %llu) doesn't fit in its memory (%llu bytes)!", (unsigned long long)Private->Size, (unsigned long long)Offset, (unsigned long long)Memory->Size);
+}
+
+void GpuImageFree(gpu_image *Image)
+{
+    null_image *Private = (null_image*)Image->Private;
+    delete Private;
+}
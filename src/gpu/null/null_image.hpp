@@ -0,0 +1,19 @@
+/**
+ *  Author: Amélie Heinrich
+ *  Company: Amélie Games
+ *  License: MIT
+ *  Create Time: 17/10/2026 09:15
+ */
+
+#pragma once
+
+#include "gpu/gpu_image.hpp"
+
+#include <cstdint>
+
+struct null_image
+{
+    uint64_t Size;
+};
+
+uint32_t NullImageFormatSize(gpu_image_format Format);
@@ -0,0 +1,79 @@
+/**
+ *  Author: Amélie Heinrich
+ *  Company: Amélie Games
+ *  License: MIT
+ *  Create Time: 17/10/2026 09:52
+ */
+
+#include "null_pipeline.hpp"
+
+#include "null_context.hpp"
+#include "null_shader.hpp"
+#include "systems/hash_system.hpp"
+#include "systems/log_system.hpp"
+
+#include <cstring>
+
+// NOTE(amelie.h): Nothing gets compiled, but the pipeline cache is keyed and persisted like on a real device so warm
+// starts can be checked headless. The shader sources stand in for bytecode and the key for the driver blob, a blob
+// that isn't the key is refused like a driver refuses one it didn't write, which exercises the stale path.
+void NullPipelineLookup(gpu_pipeline *Pipeline)
+{
+    if (!Pipeline->Info.Shader)
+        return;
+
+    null_shader *ShaderPrivate = (null_shader*)Pipeline->Info.Shader->Private;
+    uint64_t Key = GpuPipelineCacheHashInfo(&Pipeline->Info);
+    Key = HashString(ShaderPrivate->VertexSource, Key);
+    Key = HashString(ShaderPrivate->PixelSource, Key);
+    Key = HashString(ShaderPrivate->ComputeSource, Key);
+
+    gpu_pipeline_cache *Cache = &NullGpu.PipelineCache;
+    const std::vector<uint8_t> *Cached = GpuPipelineCacheFind(Cache, Key);
+    if (Cached)
+    {
+        if (Cached->size() == sizeof(Key) && !memcmp(Cached->data(), &Key, sizeof(Key)))
+        {
+            Cache->Stats.Hits++;
+            return;
+        }
+        Cache->Stats.Stale++;
+    }
+    Cache->Stats.Misses++;
+    GpuPipelineCacheStore(Cache, Key, &Key, sizeof(Key));
+}
+
+void GpuPipelineCreateGraphics(gpu_pipeline *Pipeline)
+{
+    Pipeline->Info.Type = gpu_pipeline_type::Graphics;
+    if (!Pipeline->Info.Shader)
+        LogError("Null: Graphics pipeline has no shader!");
+    Pipeline->Private = (void*)(new null_pipeline);
+    NullPipelineLookup(Pipeline);
+}
+
+void GpuPipelineCreateCompute(gpu_pipeline *Pipeline)
+{
+    Pipeline->Info.Type = gpu_pipeline_type::Compute;
+    if (!Pipeline->Info.Shader)
+        LogError("Null: Compute pipeline has no shader!");
+    Pipeline->Private = (void*)(new null_pipeline);
+    NullPipelineLookup(Pipeline);
+}
+
+void GpuPipelineFree(gpu_pipeline *Pipeline)
+{
+    null_pipeline *Private = (null_pipeline*)Pipeline->Private;
+    delete Private;
+}
+
+int GpuPipelineGetDescriptor(gpu_pipeline *Pipeline, const std::string& Name)
+{
+    null_pipeline *Private = (null_pipeline*)Pipeline->Private;
+
+    // NOTE(amelie.h): There is no reflection without a shader compiler, so hand out root slots in lookup order.
+    auto Binding = Private->Bindings.find(Name);
+    if (Binding == Private->Bindings.end())
+        Binding = Private->Bindings.emplace(Name, (int)Private->Bindings.size()).first;
+    return Binding->second;
+}
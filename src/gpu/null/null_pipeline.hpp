@@ -0,0 +1,18 @@
+/**
+ *  Author: Amélie Heinrich
+ *  Company: Amélie Games
+ *  License: MIT
+ *  Create Time: 17/10/2026 09:16
+ */
+
+#pragma once
+
+#include "gpu/gpu_pipeline.hpp"
+
+#include <string>
+#include <unordered_map>
+
+struct null_pipeline
+{
+    std::unordered_map<std::string, int> Bindings;
+};
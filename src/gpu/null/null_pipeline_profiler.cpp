@@ -0,0 +1,21 @@
+/**
+ *  Author: Amélie Heinrich
+ *  Company: Amélie Games
+ *  License: MIT
+ *  Create Time: 17/10/2026 09:54
+ */
+
+#include "null_pipeline_profiler.hpp"
+
+#include <cstring>
+
+void GpuPipelineProfilerInit(gpu_pipeline_profiler *Profiler)
+{
+    memset(&Profiler->Stats, 0, sizeof(gpu_pipeline_statistics));
+    Profiler->Private = nullptr;
+}
+
+void GpuPipelineProfilerFree(gpu_pipeline_profiler *)
+{
+
+}
@@ -0,0 +1,10 @@
+/**
+ *  Author: Amélie Heinrich
+ *  Company: Amélie Games
+ *  License: MIT
+ *  Create Time: 17/10/2026 09:16
+ */
+
+#pragma once
+
+#include "gpu/gpu_pipeline_profiler.hpp"
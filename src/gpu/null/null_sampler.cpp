@@ -0,0 +1,20 @@
+/**
+ *  Author: Amélie Heinrich
+ *  Company: Amélie Games
+ *  License: MIT
+ *  Create Time: 17/10/2026 09:55
+ */
+
+#include "null_sampler.hpp"
+
+void GpuSamplerInit(gpu_sampler *Sampler, gpu_texture_address Address, gpu_texture_filter Filter)
+{
+    Sampler->Address = Address;
+    Sampler->Filter = Filter;
+    Sampler->Private = nullptr;
+}
+
+void GpuSamplerFree(gpu_sampler *)
+{
+
+}
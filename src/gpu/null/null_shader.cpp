@@ -0,0 +1,49 @@
+/**
+ *  Author: Amélie Heinrich
+ *  Company: Amélie Games
+ *  License: MIT
+ *  Create Time: 17/10/2026 09:56
+ */
+
+#include "null_shader.hpp"
+
+#include "systems/file_system.hpp"
+#include "systems/log_system.hpp"
+
+std::string NullShaderLoad(const char *Path)
+{
+    if (!FileBufferExists(Path))
+    {
+        LogError("Null: Shader file %s does not exist!", Path);
+        return std::string();
+    }
+    return FileRead(Path);
+}
+
+void GpuShaderInit(gpu_shader *Shader, const char *V,
+                                       const char *P,
+                                       const char *C)
+{
+    Shader->Private = (void*)(new null_shader);
+    null_shader *Private = (null_shader*)Shader->Private;
+
+    if (V)
+        Private->VertexSource = NullShaderLoad(V);
+    if (P)
+        Private->PixelSource = NullShaderLoad(P);
+    if (C)
+        Private->ComputeSource = NullShaderLoad(C);
+}
+
+void GpuShaderInitFromEGS(gpu_shader *Shader, const char *V,
+                                              const char *P,
+                                              const char *C)
+{
+    GpuShaderInit(Shader, V, P, C);
+}
+
+void GpuShaderFree(gpu_shader *Shader)
+{
+    null_shader *Private = (null_shader*)Shader->Private;
+    delete Private;
+}
@@ -0,0 +1,19 @@
+/**
+ *  Author: Amélie Heinrich
+ *  Company: Amélie Games
+ *  License: MIT
+ *  Create Time: 17/10/2026 09:17
+ */
+
+#pragma once
+
+#include <string>
+
+#include "gpu/gpu_shader.hpp"
+
+struct null_shader
+{
+    std::string VertexSource;
+    std::string PixelSource;
+    std::string ComputeSource;
+};
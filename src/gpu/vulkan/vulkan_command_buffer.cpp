@@ -32,6 +32,11 @@ void GpuCommandBufferBindConstantBuffer(gpu_command_buffer *Command, gpu_pipelin
 
 }
 
+void GpuCommandBufferBindFrameAllocation(gpu_command_buffer *Command, gpu_pipeline_type Type, gpu_frame_allocation *Allocation, int Offset)
+{
+
+}
+
 void GpuCommandBufferBindShaderResource(gpu_command_buffer *Command, gpu_pipeline_type Type, gpu_image *Image, int Offset)
 {
 
@@ -77,7 +82,17 @@ void GpuCommandBufferDraw(gpu_command_buffer *Command, int VertexCount)
 
 }
 
-void GpuCommandBufferDrawIndexed(gpu_command_buffer *Command, int IndexCount)
+void GpuCommandBufferDrawIndexed(gpu_command_buffer *Command, int IndexCount, int FirstIndex)
+{
+
+}
+
+void GpuCommandBufferDrawIndexedInstanced(gpu_command_buffer *Command, int IndexCount, int InstanceCount, int FirstIndex)
+{
+
+}
+
+void GpuCommandBufferDrawIndexedIndirect(gpu_command_buffer *Command, gpu_frame_allocation *Arguments, uint32_t FirstDraw, uint32_t MaxDrawCount, gpu_frame_allocation *Counts, uint32_t CountIndex)
 {
 
 }
@@ -107,6 +122,31 @@ void GpuCommandBufferImageBarrier(gpu_command_buffer *Command, gpu_image *Image,
 
 }
 
+void GpuCommandBufferImageBarrierBegin(gpu_command_buffer *Command, gpu_image *Image, gpu_image_layout New)
+{
+
+}
+
+void GpuCommandBufferImageBarrierEnd(gpu_command_buffer *Command, gpu_image *Image, gpu_image_layout New)
+{
+
+}
+
+void GpuCommandBufferImageTransition(gpu_command_buffer *Command, gpu_image *Image, gpu_image_layout Old, gpu_image_layout New)
+{
+
+}
+
+void GpuCommandBufferAliasingBarrier(gpu_command_buffer *Command, gpu_image *Before, gpu_image *After)
+{
+
+}
+
+void GpuCommandBufferDiscardImage(gpu_command_buffer *Command, gpu_image *Image)
+{
+
+}
+
 void GpuCommandBufferBlit(gpu_command_buffer *Command, gpu_image *Source, gpu_image *Dest)
 {
 
@@ -142,6 +182,11 @@ void GpuCommandBufferFlush(gpu_command_buffer *Command)
 
 }
 
+void GpuCommandBufferSubmit(gpu_command_buffer **Buffers, uint32_t Count)
+{
+
+}
+
 void GpuCommandBufferScreenshot(gpu_command_buffer *Command, gpu_image *Image, gpu_buffer *Temporary)
 {
     
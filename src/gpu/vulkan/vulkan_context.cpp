@@ -62,7 +62,23 @@ gpu_command_buffer* GpuGetImageCommandBuffer()
     return nullptr;
 }
 
+gpu_command_buffer* GpuGetPassCommandBuffer(uint32_t Index)
+{
+    return nullptr;
+}
+
 gpu_image* GpuGetSwapChainImage()
 {
     return nullptr;   
 }
+
+gpu_frame_metrics GpuGetFrameMetrics()
+{
+    gpu_frame_metrics Result = {};
+    return Result;
+}
+
+gpu_pipeline_cache* GpuGetPipelineCache()
+{
+    return nullptr;
+}
@@ -0,0 +1,54 @@
+/**
+ *  Author: Amélie Heinrich
+ *  Company: Amélie Games
+ *  License: MIT
+ *  Create Time: 17/10/2026 15:12
+ */
+
+#include "gpu/gpu_frame_allocator.hpp"
+
+gpu_frame_allocation GpuFrameAllocConstant(uint64_t Size)
+{
+    gpu_frame_allocation Result = {};
+    return Result;
+}
+
+gpu_frame_allocation GpuFrameAllocStructured(uint32_t Count, uint32_t Stride)
+{
+    gpu_frame_allocation Result = {};
+    return Result;
+}
+
+gpu_frame_allocation GpuFrameAllocArguments(uint64_t Size)
+{
+    gpu_frame_allocation Result = {};
+    return Result;
+}
+
+void GpuFrameBufferInit(gpu_frame_buffer *Buffer, uint64_t Capacity)
+{
+    Buffer->Capacity = 0;
+    Buffer->Head = 0;
+    Buffer->ViewCount = 0;
+    Buffer->Private = nullptr;
+}
+
+void GpuFrameBufferFree(gpu_frame_buffer *Buffer)
+{
+}
+
+void GpuFrameBufferReset(gpu_frame_buffer *Buffer, uint64_t Size)
+{
+}
+
+gpu_frame_allocation GpuFrameBufferAllocStructured(gpu_frame_buffer *Buffer, uint32_t Count, uint32_t Stride)
+{
+    gpu_frame_allocation Result = {};
+    return Result;
+}
+
+gpu_frame_allocation GpuFrameBufferAllocArguments(gpu_frame_buffer *Buffer, uint64_t Size)
+{
+    gpu_frame_allocation Result = {};
+    return Result;
+}
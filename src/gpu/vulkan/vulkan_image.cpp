@@ -27,6 +27,27 @@ void GpuImageInitFromCPU(gpu_image *Image, cpu_image *CPU)
 
 }
 
+void GpuMemoryInit(gpu_memory *Memory, uint64_t Size)
+{
+
+}
+
+void GpuMemoryFree(gpu_memory *Memory)
+{
+
+}
+
+gpu_image_memory_info GpuImageGetMemoryInfo(uint32_t Width, uint32_t Height, gpu_image_format Format, gpu_image_usage Usage)
+{
+    gpu_image_memory_info Info = {};
+    return Info;
+}
+
+void GpuImageInitPlaced(gpu_image *Image, uint32_t Width, uint32_t Height, gpu_image_format Format, gpu_image_usage Usage, gpu_memory *Memory, uint64_t Offset)
+{
+
+}
+
 void GpuImageFree(gpu_image *Image)
 {
     
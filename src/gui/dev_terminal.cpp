@@ -7,9 +7,18 @@
 
 #include "dev_terminal.hpp"
 
+#include "gpu/gpu_context.hpp"
+#include "gpu/gpu_descriptor_allocator.hpp"
+#include "systems/job_system.hpp"
+#include "systems/log_system.hpp"
 #include "systems/shader_system.hpp"
 #include "game_data.hpp"
 #include "renderer/renderer.hpp"
+#include "renderer/culling.hpp"
+#include "renderer/meshlet_culling.hpp"
+#include "renderer/occlusion_culling.hpp"
+#include "renderer/render_queue.hpp"
+#include "scene/bvh.hpp"
 
 #include <stdio.h>
 #include <stdarg.h>
@@ -81,14 +90,79 @@ void DevTerminalInitCommands()
     });
     DevTerminalAddCommand("reload_settings", [](const std::vector<std::string>&) {
         EgcParseFile("config.egc", &EgcFile);
+        RendererSettingsLoad(RendererGetSettings());
     });
     DevTerminalAddCommand("load_settings", [](const std::vector<std::string>& Args) {
         if (!Args[1].empty())
             EgcParseFile(Args[1], &EgcFile);
+        RendererSettingsLoad(RendererGetSettings());
     });
     DevTerminalAddCommand("sync_settings", [](const std::vector<std::string>&) {
         EgcWriteFile("config.egc", &EgcFile);
     });
+    DevTerminalAddCommand("bench_descriptors", [](const std::vector<std::string>&) {
+        DevTerminalReportFailures("bench_descriptors", GpuDescriptorAllocatorBenchmark());
+    });
+    DevTerminalAddCommand("bench_jobs", [](const std::vector<std::string>&) {
+        DevTerminalReportFailures("bench_jobs", JobSystemBenchmark());
+    });
+    DevTerminalAddCommand("bench_bvh", [](const std::vector<std::string>&) {
+        DevTerminalReportFailures("bench_bvh", BvhBenchmark());
+    });
+    DevTerminalAddCommand("bench_culling", [](const std::vector<std::string>&) {
+        DevTerminalReportFailures("bench_culling", CullBenchmark());
+    });
+    DevTerminalAddCommand("bench_occlusion", [](const std::vector<std::string>&) {
+        DevTerminalReportFailures("bench_occlusion", OcclusionBenchmark());
+    });
+    DevTerminalAddCommand("bench_render_queue", [](const std::vector<std::string>&) {
+        DevTerminalReportFailures("bench_render_queue", RenderQueueBenchmark());
+    });
+    DevTerminalAddCommand("render_queue_stats", [](const std::vector<std::string>&) {
+        render_queue_stats Stats = RendererGetQueueStats();
+        LogInfo("Render Queue: %u draws, %u state changes (%u pipeline, %u material, %u mesh)",
+                Stats.Draws, Stats.StateChanges, Stats.PipelineChanges, Stats.MaterialChanges, Stats.MeshChanges);
+    });
+    DevTerminalAddCommand("bench_meshlets", [](const std::vector<std::string>&) {
+        DevTerminalReportFailures("bench_meshlets", MeshletCullBenchmark());
+    });
+    DevTerminalAddCommand("validate_render_graph", [](const std::vector<std::string>&) {
+        uint32_t Errors = RenderGraphTest();
+
+        render_graph *Graph = RendererGetGraph();
+        LogInfo("Render Graph: renderer frame");
+        RenderGraphLogPlan(Graph);
+        uint32_t FrameErrors = RenderGraphValidate(Graph);
+        LogInfo("Render Graph: renderer frame %s (%u errors)", FrameErrors ? "FAIL" : "PASS", FrameErrors);
+        DevTerminalReportFailures("validate_render_graph", Errors + FrameErrors);
+    });
+    DevTerminalAddCommand("pipeline_cache_stats", [](const std::vector<std::string>&) {
+        gpu_pipeline_cache *Cache = GpuGetPipelineCache();
+        if (!Cache)
+        {
+            LogWarn("Pipeline Cache: Not supported by this backend");
+            return;
+        }
+        GpuPipelineCacheLogStats(Cache);
+    });
+    DevTerminalAddCommand("validate_pipeline_cache", [](const std::vector<std::string>& Args) {
+        gpu_pipeline_cache *Cache = GpuGetPipelineCache();
+        if (!Cache)
+        {
+            LogWarn("Pipeline Cache: Not supported by this backend");
+            return;
+        }
+
+        std::string Run = Args.size() > 1 ? Args[1] : "";
+        if (Run == "cold")
+            DevTerminalReportFailures("validate_pipeline_cache", GpuPipelineCacheValidate(Cache, gpu_pipeline_cache_run::Cold));
+        else if (Run == "warm")
+            DevTerminalReportFailures("validate_pipeline_cache", GpuPipelineCacheValidate(Cache, gpu_pipeline_cache_run::Warm));
+        else if (Run == "stale")
+            DevTerminalReportFailures("validate_pipeline_cache", GpuPipelineCacheValidate(Cache, gpu_pipeline_cache_run::Stale));
+        else
+            LogWarn("Usage: validate_pipeline_cache cold|warm|stale");
+    });
     DevTerminalAddCommand("sync_settings_path", [](const std::vector<std::string>& Args) {
         if (!Args[1].empty())
             EgcWriteFile(Args[1], &EgcFile);
@@ -100,6 +174,7 @@ void DevTerminalInit()
     memset(DevTerminal.InputBuffer, 0, sizeof(char) * 1024);
     DevTerminal.HistoryPos = -1;
     DevTerminal.AutoScroll = true;
+    DevTerminal.Failures = 0;
 
     DevTerminalInitCommands();
 }
@@ -163,16 +238,13 @@ void DevTerminalDraw(bool* Open, bool* Focused)
         if (Cmd[0] != ' ' && !Cmd.empty())
         {
             std::istringstream Stream(Cmd);
-            std::vector<std::string> Args;
-
-            std::string Arg;
-            while (Stream >> Arg)
-                Args.push_back(Arg);
+            std::string Name;
+            Stream >> Name;
 
             DevTerminal.HistoryPos = -1;
             for (int i = (int)DevTerminal.History.size() - 1; i >= 0; i--)
             {
-                if (Stricmp(DevTerminal.History[i], Args[0].c_str()) == 0)
+                if (Stricmp(DevTerminal.History[i], Name.c_str()) == 0)
                 {
                     free(DevTerminal.History[i]);
                     DevTerminal.History.erase(DevTerminal.History.begin() + i);
@@ -180,37 +252,8 @@ void DevTerminalDraw(bool* Open, bool* Focused)
                 }
             }
 
-            bool ShouldFindCommand = true;
-            //for (auto cvar = cvar_registry.cvars.begin(); cvar != cvar_registry.cvars.end(); ++cvar)
-            //{
-            //    if (args[0] == cvar->first)
-            //    {
-            //        if (cvar->second.type == sp_cvar_type::cvar_int)
-            //            cvar_registry.set_i(args[0], std::stoi(args[1]));
-            //        if (cvar->second.type == sp_cvar_type::cvar_float)
-            //            cvar_registry.set_f(args[0], std::stof(args[1]));
-            //        if (cvar->second.type == sp_cvar_type::cvar_string)
-            //            cvar_registry.set_s(args[0], args[1]);
-            //        should_find_command = false;
-            //    }
-            //}
-
-            if (ShouldFindCommand)
-            {
-                bool FoundCommand = false;
-                for (auto Command = DevTerminal.Commands.begin(); Command != DevTerminal.Commands.end(); ++Command)
-                {
-                    if (Args[0] == Command->first)
-                    {
-                        DevTerminal.History.push_back(Strdup(s));
-                        FoundCommand = true;
-
-                        Command->second(Args);
-                    }
-                }
-                if (!FoundCommand)
-                    DevTerminalAddLog("Unknown command: %s", Args[0].c_str());
-            }
+            if (DevTerminalExecute(Cmd))
+                DevTerminal.History.push_back(Strdup(s));
         }
         DevTerminal.ScrollToBottom = true;
         strcpy(s, "");
@@ -224,6 +267,57 @@ void DevTerminalDraw(bool* Open, bool* Focused)
     ImGui::End();
 }
 
+bool DevTerminalExecute(const std::string& Command)
+{
+    std::istringstream Stream(Command);
+    std::vector<std::string> Args;
+
+    std::string Arg;
+    while (Stream >> Arg)
+        Args.push_back(Arg);
+    if (Args.empty())
+        return false;
+
+    bool ShouldFindCommand = true;
+    //for (auto cvar = cvar_registry.cvars.begin(); cvar != cvar_registry.cvars.end(); ++cvar)
+    //{
+    //    if (args[0] == cvar->first)
+    //    {
+    //        if (cvar->second.type == sp_cvar_type::cvar_int)
+    //            cvar_registry.set_i(args[0], std::stoi(args[1]));
+    //        if (cvar->second.type == sp_cvar_type::cvar_float)
+    //            cvar_registry.set_f(args[0], std::stof(args[1]));
+    //        if (cvar->second.type == sp_cvar_type::cvar_string)
+    //            cvar_registry.set_s(args[0], args[1]);
+    //        should_find_command = false;
+    //    }
+    //}
+
+    bool FoundCommand = false;
+    if (ShouldFindCommand)
+    {
+        for (auto Command = DevTerminal.Commands.begin(); Command != DevTerminal.Commands.end(); ++Command)
+        {
+            if (Args[0] == Command->first)
+            {
+                FoundCommand = true;
+                Command->second(Args);
+            }
+        }
+        if (!FoundCommand)
+            DevTerminalAddLog("Unknown command: %s", Args[0].c_str());
+    }
+    return FoundCommand;
+}
+
+void DevTerminalReportFailures(const char *Check, uint32_t Failures)
+{
+    if (!Failures)
+        return;
+    LogError("%s: %u checks failed!", Check, Failures);
+    DevTerminal.Failures += Failures;
+}
+
 void DevTerminalAddLog(const char* Format, ...)
 {
     char Buf[1024];
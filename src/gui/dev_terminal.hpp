@@ -9,6 +9,7 @@
 
 #include "game_data.hpp"
 #include <ImGui/imgui.h>
+#include <string>
 #include <vector>
 #include <unordered_map>
 
@@ -23,6 +24,9 @@ struct dev_terminal
     int HistoryPos;
     bool AutoScroll;
     bool ScrollToBottom;
+
+    // NOTE(amelie.h): Checks run from the terminal bump this when they fail, headless runs turn it into the exit code.
+    uint32_t Failures;
 };
 
 extern dev_terminal DevTerminal;
@@ -30,6 +34,8 @@ extern dev_terminal DevTerminal;
 void DevTerminalInit();
 void DevTerminalShutdown();
 void DevTerminalDraw(bool* Open, bool* Focused);
+bool DevTerminalExecute(const std::string& Command);
 void DevTerminalAddLog(const char* Format, ...);
 void DevTerminalAddCommand(const char *Name, PFN_OnConsoleCommand Command);
+void DevTerminalReportFailures(const char *Check, uint32_t Failures);
 
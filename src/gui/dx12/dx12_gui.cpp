@@ -20,7 +20,7 @@
 
 struct dx12_gui
 {
-    uint32_t FontDescriptor;
+    gpu_descriptor_handle FontDescriptor;
 };
 
 dx12_gui GUI;
@@ -65,6 +65,8 @@ void GuiBeginFrame()
 void GuiEndFrame(gpu_command_buffer *Buffer)
 {   
     dx12_command_buffer *Private = (dx12_command_buffer*)Buffer->Private;
+    // NOTE(amelie.h): ImGui records straight into the list, the back buffer transition must be in it first.
+    Dx12CommandBufferFlushBarriers(Private);
     Private->List->SetDescriptorHeaps(1, &DX12.CBVSRVUAVHeap.Heap);
 
     ImGuiIO& IO = ImGui::GetIO();
@@ -0,0 +1,76 @@
+/**
+ *  Author: Amélie Heinrich
+ *  Company: Amélie Games
+ *  License: MIT
+ *  Create Time: 17/10/2026 10:02
+ */
+
+#include "gui/gui.hpp"
+
+#include "gpu/null/null_context.hpp"
+
+#include <ImGui/imgui.h>
+
+#ifdef _WIN32
+    #include <ImGui/imgui_impl_win32.h>
+    #include "windows/windows_data.hpp"
+#endif
+
+void GuiInit()
+{
+    IMGUI_CHECKVERSION();
+    ImGui::CreateContext();
+
+    ImGuiIO& IO = ImGui::GetIO();
+    IO.DisplaySize = ImVec2(NullGpu.Width, NullGpu.Height);
+    IO.ConfigFlags |= ImGuiConfigFlags_DockingEnable;
+
+    // NOTE(amelie.h): No renderer backend, but the atlas still has to be built before the first NewFrame.
+    unsigned char *Pixels;
+    int Width, Height;
+    IO.Fonts->GetTexDataAsRGBA32(&Pixels, &Width, &Height);
+    IO.Fonts->SetTexID(nullptr);
+
+    ImGui::StyleColorsDark();
+
+#ifdef _WIN32
+    ImGui_ImplWin32_Init(Win32.Window);
+#endif
+}
+
+void GuiBeginFrame()
+{
+#ifdef _WIN32
+    ImGui_ImplWin32_NewFrame();
+#endif
+    ImGui::NewFrame();
+}
+
+void GuiEndFrame(gpu_command_buffer *Buffer)
+{
+    ImGuiIO& IO = ImGui::GetIO();
+    IO.DisplaySize = ImVec2(NullGpu.Width, NullGpu.Height);
+
+    ImGui::Render();
+
+    // NOTE(amelie.h): Record one draw per ImGui command so UI cost shows up in the frame stats.
+    ImDrawData *DrawData = ImGui::GetDrawData();
+    for (int ListIndex = 0; ListIndex < DrawData->CmdListsCount; ListIndex++)
+    {
+        ImDrawList *List = DrawData->CmdLists[ListIndex];
+        for (int CommandIndex = 0; CommandIndex < List->CmdBuffer.Size; CommandIndex++)
+        {
+            const ImDrawCmd& Command = List->CmdBuffer[CommandIndex];
+            if (Command.UserCallback == nullptr)
+                GpuCommandBufferDrawIndexed(Buffer, Command.ElemCount);
+        }
+    }
+}
+
+void GuiExit()
+{
+#ifdef _WIN32
+    ImGui_ImplWin32_Shutdown();
+#endif
+    ImGui::DestroyContext();
+}
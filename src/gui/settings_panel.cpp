@@ -10,11 +10,14 @@
 #include "game_data.hpp"
 #include <ImGui/imgui.h>
 
+#include "game.hpp"
+#include "gpu/gpu_context.hpp"
 #include "renderer/renderer.hpp"
 
 #define SETTINGS_GRAPHICS 0
 #define SETTINGS_MOUSE 1
 #define SETTINGS_AUDIO 2
+#define SETTINGS_PERFORMANCE 3
 
 struct settings_panel
 {
@@ -35,6 +38,11 @@ void SettingsDrawGraphics()
         {
             ImGui::Checkbox("Wireframe", &Settings->Wireframe);
 
+            if (ImGui::SliderFloat("LOD Threshold (pixels)", &Settings->LodThreshold, 0.0f, 16.0f, "%.1f", ImGuiSliderFlags_AlwaysClamp))
+                EgcF32(EgcFile, "lod_threshold") = Settings->LodThreshold;
+            if (ImGui::Checkbox("Occlusion Culling", &Settings->OcclusionCulling))
+                EgcB32(EgcFile, "occlusion_culling") = Settings->OcclusionCulling;
+
             ImGui::TreePop();
         }
 
@@ -100,6 +108,30 @@ void SettingsDrawAudio()
     }
 }
 
+void SettingsDrawPerformance()
+{
+    if (ImGui::TreeNodeEx("Performance", ImGuiTreeNodeFlags_Framed))
+    {
+        frame_stats *Stats = GameGetFrameStats();
+        frame_stats_summary Summary = FrameStatsSummarize(Stats);
+
+        ImGui::Text("Frame time (last %u frames)", Summary.Samples);
+        ImGui::Text("Min: %.3fms | Avg: %.3fms | Max: %.3fms", Summary.Min, Summary.Average, Summary.Max);
+        ImGui::Text("P99: %.3fms | %.1f FPS", Summary.P99, Summary.Average > 0.0f ? 1000.0f / Summary.Average : 0.0f);
+        ImGui::PlotLines("##FrameTimes", Stats->History.data(), (int)Stats->History.size(), (int)Stats->Head, nullptr, 0.0f, Summary.Max * 1.25f, ImVec2(0, 60));
+
+        gpu_frame_metrics Metrics = GpuGetFrameMetrics();
+        ImGui::Text("Frames in flight: %u", Metrics.FramesInFlight);
+        ImGui::Text("CPU wait: %.3fms | Frame latency: %.3fms", Metrics.CpuWaitMs, Metrics.FrameLatencyMs);
+
+        render_queue_stats QueueStats = RendererGetQueueStats();
+        ImGui::Text("Draws: %u | State changes: %u", QueueStats.Draws, QueueStats.StateChanges);
+        ImGui::Text("Pipeline: %u | Material: %u | Mesh: %u", QueueStats.PipelineChanges, QueueStats.MaterialChanges, QueueStats.MeshChanges);
+
+        ImGui::TreePop();
+    }
+}
+
 void SettingsPanelDraw(bool *Closed, bool *Focused)
 {
     ImGui::Begin("Settings", Closed);
@@ -109,6 +141,7 @@ void SettingsPanelDraw(bool *Closed, bool *Focused)
     SettingsDrawGraphics();
     SettingsDrawMouse();
     SettingsDrawAudio();
+    SettingsDrawPerformance();
 
     if (ImGui::Button("Apply"))
         EgcWriteFile("config.egc", &EgcFile);
@@ -0,0 +1,15 @@
+/**
+ *  Author: Amélie Heinrich
+ *  Company: Amélie Games
+ *  License: MIT
+ *  Create Time: 17/10/2026 11:03
+ */
+
+#include "linux_data.hpp"
+
+linux_platform_state Linux;
+
+void ShutdownGame()
+{
+    Linux.Running = false;
+}
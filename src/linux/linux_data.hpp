@@ -0,0 +1,21 @@
+/**
+ *  Author: Amélie Heinrich
+ *  Company: Amélie Games
+ *  License: MIT
+ *  Create Time: 17/10/2026 11:02
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+struct linux_platform_state
+{
+    volatile bool Running;
+    uint64_t FrameLimit;
+    std::vector<std::string> Commands;
+};
+
+extern linux_platform_state Linux;
@@ -0,0 +1,99 @@
+/**
+ *  Author: Amélie Heinrich
+ *  Company: Amélie Games
+ *  License: MIT
+ *  Create Time: 17/10/2026 11:30
+ */
+
+#include "apu/apu_context.hpp"
+#include "egc_parser.hpp"
+#include "game.hpp"
+#include "game_data.hpp"
+#include "gpu/gpu_context.hpp"
+#include "gui/dev_terminal.hpp"
+#include "gui/gui.hpp"
+#include "linux/linux_data.hpp"
+#include "systems/shader_system.hpp"
+#include "systems/log_system.hpp"
+#include "systems/event_system.hpp"
+#include "systems/job_system.hpp"
+#include "systems/rng_system.hpp"
+
+#include <csignal>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+
+void SignalHandler(int)
+{
+    ShutdownGame();
+}
+
+// NOTE(amelie.h): --frames N stops after N frames (0 skips the loop), --exec "cmd args" runs a terminal command once the loop is done.
+// The exit code is 1 when a command is unknown or one of the checks it ran failed.
+void ParseArguments(int argc, char *argv[])
+{
+    Linux.FrameLimit = UINT64_MAX;
+    for (int Index = 1; Index < argc; Index++)
+    {
+        if (!strcmp(argv[Index], "--frames") && Index + 1 < argc)
+            Linux.FrameLimit = strtoull(argv[++Index], nullptr, 10);
+        else if (!strcmp(argv[Index], "--exec") && Index + 1 < argc)
+            Linux.Commands.push_back(argv[++Index]);
+        else
+            LogWarn("Linux: Unknown argument %s", argv[Index]);
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    RngInit(time(NULL));
+    EgcParseFile("config.egc", &EgcFile);
+    EgcParseFile("cvars.egc", &CVars);
+    ParseArguments(argc, argv);
+    EventSystemInit();
+    JobSystemInit(EgcI32(EgcFile, "job_threads"));
+    ApuInit();
+    GpuInit();
+    GuiInit();
+    GameInit();
+
+    Linux.Running = true;
+    signal(SIGINT, SignalHandler);
+    signal(SIGTERM, SignalHandler);
+
+    uint64_t FrameCount = 0;
+    while (Linux.Running && FrameCount < Linux.FrameLimit)
+    {
+        GameUpdate();
+        FrameCount++;
+    }
+
+    int ExitCode = 0;
+    for (auto& Command : Linux.Commands)
+    {
+        LogInfo("> %s", Command.c_str());
+        if (!DevTerminalExecute(Command))
+        {
+            LogWarn("Linux: Unknown command %s", Command.c_str());
+            ExitCode = 1;
+        }
+    }
+    if (DevTerminal.Failures)
+    {
+        LogError("Linux: %u checks failed!", DevTerminal.Failures);
+        ExitCode = 1;
+    }
+
+    ShaderLibraryFree();
+    GameExit();
+    GuiExit();
+    GpuExit();
+    ApuExit();
+    JobSystemExit();
+    EventSystemExit();
+    LogSaveFile("output_log.log");
+    LogResetColor();
+    return (ExitCode);
+}
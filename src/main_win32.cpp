@@ -16,6 +16,7 @@
 #include "systems/shader_system.hpp"
 #include "systems/log_system.hpp"
 #include "systems/event_system.hpp"
+#include "systems/job_system.hpp"
 #include "systems/input_system.hpp"
 #include "windows/windows_data.hpp"
 #include "systems/rng_system.hpp"
@@ -129,6 +130,9 @@ void WindowInit(void)
         case gpu_backend::DirectX12:
             Title = "Game Project | <Direct3D 12>";
             break;
+        case gpu_backend::Null:
+            Title = "Game Project | <Null>";
+            break;
         default:
             Title = "Game Project | <NULL API>";
             break;
@@ -151,6 +155,7 @@ int main(int argc, char *argv[])
     EgcParseFile("config.egc", &EgcFile);
     EgcParseFile("cvars.egc", &CVars);
     EventSystemInit();
+    JobSystemInit(EgcI32(EgcFile, "job_threads"));
     WindowInit();
     ApuInit();
     GpuInit();
@@ -175,6 +180,7 @@ int main(int argc, char *argv[])
     GpuExit();
     ApuExit();
     WindowExit();
+    JobSystemExit();
     EventSystemExit();
     EgcWriteFile("config.egc", &EgcFile);
     LogSaveFile("output_log.log");
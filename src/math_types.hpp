@@ -14,3 +14,15 @@ typedef hmm_vec3 V3;
 typedef hmm_vec4 V4;
 typedef hmm_mat4 M4;
 typedef hmm_quaternion Q4;
+
+struct bounding_sphere
+{
+    V3 Center;
+    float Radius;
+};
+
+struct aabb
+{
+    V3 Min;
+    V3 Max;
+};
@@ -6,13 +6,62 @@
  */
 
 #include "cpu_image.hpp"
+#include "image_format.hpp"
 
 #include <stb/stb_image.h>
+#include "systems/file_system.hpp"
 #include "systems/log_system.hpp"
 
+#include <cstdlib>
+#include <cstring>
+
+void CpuImageLoadCooked(cpu_image *Image, const std::string& Path)
+{
+    Image->Data = nullptr;
+
+    file_mapping Mapping;
+    if (!FileMappingOpen(&Mapping, Path))
+        return;
+
+    const image_file_header *Header = (const image_file_header*)Mapping.Data;
+    if (Mapping.Size < sizeof(image_file_header) || Header->Magic != IMAGE_FILE_MAGIC || Header->Version != IMAGE_FILE_VERSION)
+    {
+        LogError("CpuImage: Cooked image %s is invalid or out of date!", Path.c_str());
+        FileMappingClose(&Mapping);
+        return;
+    }
+
+    uint64_t Size = CpuImageGetSize(Header->Width, Header->Height, Header->Channels, Header->Float);
+    if (sizeof(image_file_header) + Size > Mapping.Size)
+    {
+        LogError("CpuImage: Cooked image %s is truncated!", Path.c_str());
+        FileMappingClose(&Mapping);
+        return;
+    }
+
+    // NOTE(amelie.h): malloc so CpuImageFree can release cooked and stb images the same way.
+    Image->Width = Header->Width;
+    Image->Height = Header->Height;
+    Image->Channels = Header->Channels;
+    Image->Float = Header->Float;
+    Image->Data = malloc(Size);
+    memcpy(Image->Data, Mapping.Data + sizeof(image_file_header), Size);
+    FileMappingClose(&Mapping);
+}
+
+uint64_t CpuImageGetSize(uint32_t Width, uint32_t Height, uint32_t Channels, bool Float)
+{
+    return (uint64_t)Width * Height * Channels * (Float ? sizeof(float) : sizeof(uint8_t));
+}
+
 void CpuImageLoad(cpu_image* Image, const std::string& Path)
 {
     std::string Extension = Path.substr(Path.find_last_of(".") + 1);
+    if (Extension == "tex")
+    {
+        CpuImageLoadCooked(Image, Path);
+        return;
+    }
     if (Extension != "hdr")
     {
         stbi_set_flip_vertically_on_load(true);
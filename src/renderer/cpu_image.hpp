@@ -19,6 +19,8 @@ struct cpu_image
     void *Data;
 };
 
+// NOTE(amelie.h): Paths ending in .tex are read from the cooked format in image_format.hpp, anything else goes through stb.
 void CpuImageLoad(cpu_image* Image, const std::string& Path);
+uint64_t CpuImageGetSize(uint32_t Width, uint32_t Height, uint32_t Channels, bool Float);
 void CpuImageInitColor(cpu_image *Image, uint32_t Width, uint32_t Height, uint32_t Color);
 void CpuImageFree(cpu_image *Image);
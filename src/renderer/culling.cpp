@@ -0,0 +1,335 @@
+/**
+ *  Author: Amélie Heinrich
+ *  Company: Amélie Games
+ *  License: MIT
+ *  Create Time: 17/10/2026 18:10
+ */
+
+#include "culling.hpp"
+
+#include "timer.hpp"
+#include "cameras/noclip_camera.hpp"
+#include "systems/log_system.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <random>
+
+#ifdef HANDMADE_MATH__USE_SSE
+    #include <immintrin.h>
+    #if defined(_MSC_VER)
+        #include <intrin.h>
+        #define CULL_TARGET_AVX
+    #else
+        #define CULL_TARGET_AVX __attribute__((target("avx")))
+    #endif
+#endif
+
+struct cull_plane
+{
+    float X;
+    float Y;
+    float Z;
+    float W;
+    float AbsX;
+    float AbsY;
+    float AbsZ;
+};
+
+bounding_sphere BoundingSphereTransform(bounding_sphere Sphere, hmm_mat4 Transform)
+{
+    float Scale = 0.0f;
+    for (int Column = 0; Column < 3; Column++)
+        Scale = std::max(Scale, HMM_LengthVec3(HMM_Vec3(Transform.Elements[Column][0], Transform.Elements[Column][1], Transform.Elements[Column][2])));
+
+    bounding_sphere Result;
+    Result.Center = HMM_MultiplyMat4ByVec4(Transform, HMM_Vec4v(Sphere.Center, 1.0f)).XYZ;
+    Result.Radius = Sphere.Radius * Scale;
+    return Result;
+}
+
+aabb AabbTransform(aabb Box, hmm_mat4 Transform)
+{
+    // NOTE(amelie.h): Arvo's method, the new half extents are the old ones through the absolute 3x3 matrix.
+    V3 Center = HMM_MultiplyVec3f(HMM_AddVec3(Box.Min, Box.Max), 0.5f);
+    V3 Extent = HMM_MultiplyVec3f(HMM_SubtractVec3(Box.Max, Box.Min), 0.5f);
+
+    V3 NewCenter = HMM_MultiplyMat4ByVec4(Transform, HMM_Vec4v(Center, 1.0f)).XYZ;
+    V3 NewExtent = HMM_Vec3(0.0f, 0.0f, 0.0f);
+    for (int Row = 0; Row < 3; Row++)
+        for (int Column = 0; Column < 3; Column++)
+            NewExtent.Elements[Row] += fabsf(Transform.Elements[Column][Row]) * Extent.Elements[Column];
+
+    return { HMM_SubtractVec3(NewCenter, NewExtent), HMM_AddVec3(NewCenter, NewExtent) };
+}
+
+void CullBoundsResize(cull_bounds *Bounds, uint32_t Count)
+{
+    uint32_t Padded = (Count + CULL_BATCH_SIZE - 1) / CULL_BATCH_SIZE * CULL_BATCH_SIZE;
+
+    Bounds->Count = Count;
+    for (auto *Array : { &Bounds->SphereX, &Bounds->SphereY, &Bounds->SphereZ, &Bounds->SphereRadius,
+                         &Bounds->BoxX, &Bounds->BoxY, &Bounds->BoxZ, &Bounds->ExtentX, &Bounds->ExtentY, &Bounds->ExtentZ })
+        Array->assign(Padded, 0.0f);
+}
+
+void CullBoundsSet(cull_bounds *Bounds, uint32_t Index, bounding_sphere Sphere, aabb Box)
+{
+    Bounds->SphereX[Index] = Sphere.Center.X;
+    Bounds->SphereY[Index] = Sphere.Center.Y;
+    Bounds->SphereZ[Index] = Sphere.Center.Z;
+    Bounds->SphereRadius[Index] = Sphere.Radius;
+
+    Bounds->BoxX[Index] = (Box.Min.X + Box.Max.X) * 0.5f;
+    Bounds->BoxY[Index] = (Box.Min.Y + Box.Max.Y) * 0.5f;
+    Bounds->BoxZ[Index] = (Box.Min.Z + Box.Max.Z) * 0.5f;
+    Bounds->ExtentX[Index] = (Box.Max.X - Box.Min.X) * 0.5f;
+    Bounds->ExtentY[Index] = (Box.Max.Y - Box.Min.Y) * 0.5f;
+    Bounds->ExtentZ[Index] = (Box.Max.Z - Box.Min.Z) * 0.5f;
+}
+
+void CullLoadPlanes(cull_plane *Out, const V4 *Planes)
+{
+    for (int Plane = 0; Plane < 6; Plane++)
+        Out[Plane] = { Planes[Plane].X, Planes[Plane].Y, Planes[Plane].Z, Planes[Plane].W, fabsf(Planes[Plane].X), fabsf(Planes[Plane].Y), fabsf(Planes[Plane].Z) };
+}
+
+uint32_t CullFrustumScalar(const cull_bounds *Bounds, const cull_plane *Planes, uint32_t *Visible)
+{
+    uint32_t VisibleCount = 0;
+    for (uint32_t Index = 0; Index < Bounds->Count; Index++)
+    {
+        bool Inside = true;
+        for (int PlaneIndex = 0; PlaneIndex < 6; PlaneIndex++)
+        {
+            const cull_plane& Plane = Planes[PlaneIndex];
+            float Sphere = Plane.X * Bounds->SphereX[Index] + Plane.Y * Bounds->SphereY[Index] + Plane.Z * Bounds->SphereZ[Index] - Plane.W;
+            float Box = Plane.X * Bounds->BoxX[Index] + Plane.Y * Bounds->BoxY[Index] + Plane.Z * Bounds->BoxZ[Index] - Plane.W
+                      + Plane.AbsX * Bounds->ExtentX[Index] + Plane.AbsY * Bounds->ExtentY[Index] + Plane.AbsZ * Bounds->ExtentZ[Index];
+            Inside &= (Sphere >= -Bounds->SphereRadius[Index]) & (Box >= 0.0f);
+        }
+
+        Visible[VisibleCount] = Index;
+        VisibleCount += Inside;
+    }
+    return VisibleCount;
+}
+
+#ifdef HANDMADE_MATH__USE_SSE
+
+bool CullSupportsAVX()
+{
+#if defined(_MSC_VER)
+    int Info[4];
+    __cpuid(Info, 1);
+    bool OSSaves = (Info[2] & (1 << 27)) != 0;
+    bool HasAVX = (Info[2] & (1 << 28)) != 0;
+    return OSSaves && HasAVX && (_xgetbv(0) & 6) == 6;
+#else
+    return __builtin_cpu_supports("avx");
+#endif
+}
+
+uint32_t CullFrustumSSE(const cull_bounds *Bounds, const cull_plane *Planes, uint32_t *Visible)
+{
+    uint32_t VisibleCount = 0;
+    __m128 Zero = _mm_setzero_ps();
+    for (uint32_t Base = 0; Base < Bounds->Count; Base += 4)
+    {
+        __m128 SphereX = _mm_loadu_ps(&Bounds->SphereX[Base]);
+        __m128 SphereY = _mm_loadu_ps(&Bounds->SphereY[Base]);
+        __m128 SphereZ = _mm_loadu_ps(&Bounds->SphereZ[Base]);
+        __m128 NegativeRadius = _mm_sub_ps(Zero, _mm_loadu_ps(&Bounds->SphereRadius[Base]));
+        __m128 BoxX = _mm_loadu_ps(&Bounds->BoxX[Base]);
+        __m128 BoxY = _mm_loadu_ps(&Bounds->BoxY[Base]);
+        __m128 BoxZ = _mm_loadu_ps(&Bounds->BoxZ[Base]);
+        __m128 ExtentX = _mm_loadu_ps(&Bounds->ExtentX[Base]);
+        __m128 ExtentY = _mm_loadu_ps(&Bounds->ExtentY[Base]);
+        __m128 ExtentZ = _mm_loadu_ps(&Bounds->ExtentZ[Base]);
+
+        __m128 Inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+        for (int PlaneIndex = 0; PlaneIndex < 6; PlaneIndex++)
+        {
+            const cull_plane& Plane = Planes[PlaneIndex];
+            __m128 X = _mm_set1_ps(Plane.X);
+            __m128 Y = _mm_set1_ps(Plane.Y);
+            __m128 Z = _mm_set1_ps(Plane.Z);
+            __m128 W = _mm_set1_ps(Plane.W);
+
+            __m128 Sphere = _mm_sub_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(X, SphereX), _mm_mul_ps(Y, SphereY)), _mm_mul_ps(Z, SphereZ)), W);
+            __m128 Box = _mm_sub_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(X, BoxX), _mm_mul_ps(Y, BoxY)), _mm_mul_ps(Z, BoxZ)), W);
+            Box = _mm_add_ps(Box, _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(Plane.AbsX), ExtentX), _mm_mul_ps(_mm_set1_ps(Plane.AbsY), ExtentY)),
+                                             _mm_mul_ps(_mm_set1_ps(Plane.AbsZ), ExtentZ)));
+
+            Inside = _mm_and_ps(Inside, _mm_and_ps(_mm_cmpge_ps(Sphere, NegativeRadius), _mm_cmpge_ps(Box, Zero)));
+        }
+
+        // NOTE(amelie.h): Branchless compaction, every lane is written and only the visible ones advance the cursor.
+        int Mask = _mm_movemask_ps(Inside);
+        uint32_t Lanes = std::min(4u, Bounds->Count - Base);
+        for (uint32_t Lane = 0; Lane < Lanes; Lane++)
+        {
+            Visible[VisibleCount] = Base + Lane;
+            VisibleCount += (Mask >> Lane) & 1;
+        }
+    }
+    return VisibleCount;
+}
+
+CULL_TARGET_AVX uint32_t CullFrustumAVX(const cull_bounds *Bounds, const cull_plane *Planes, uint32_t *Visible)
+{
+    uint32_t VisibleCount = 0;
+    __m256 Zero = _mm256_setzero_ps();
+    for (uint32_t Base = 0; Base < Bounds->Count; Base += 8)
+    {
+        __m256 SphereX = _mm256_loadu_ps(&Bounds->SphereX[Base]);
+        __m256 SphereY = _mm256_loadu_ps(&Bounds->SphereY[Base]);
+        __m256 SphereZ = _mm256_loadu_ps(&Bounds->SphereZ[Base]);
+        __m256 NegativeRadius = _mm256_sub_ps(Zero, _mm256_loadu_ps(&Bounds->SphereRadius[Base]));
+        __m256 BoxX = _mm256_loadu_ps(&Bounds->BoxX[Base]);
+        __m256 BoxY = _mm256_loadu_ps(&Bounds->BoxY[Base]);
+        __m256 BoxZ = _mm256_loadu_ps(&Bounds->BoxZ[Base]);
+        __m256 ExtentX = _mm256_loadu_ps(&Bounds->ExtentX[Base]);
+        __m256 ExtentY = _mm256_loadu_ps(&Bounds->ExtentY[Base]);
+        __m256 ExtentZ = _mm256_loadu_ps(&Bounds->ExtentZ[Base]);
+
+        __m256 Inside = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+        for (int PlaneIndex = 0; PlaneIndex < 6; PlaneIndex++)
+        {
+            const cull_plane& Plane = Planes[PlaneIndex];
+            __m256 X = _mm256_set1_ps(Plane.X);
+            __m256 Y = _mm256_set1_ps(Plane.Y);
+            __m256 Z = _mm256_set1_ps(Plane.Z);
+            __m256 W = _mm256_set1_ps(Plane.W);
+
+            __m256 Sphere = _mm256_sub_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(X, SphereX), _mm256_mul_ps(Y, SphereY)), _mm256_mul_ps(Z, SphereZ)), W);
+            __m256 Box = _mm256_sub_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(X, BoxX), _mm256_mul_ps(Y, BoxY)), _mm256_mul_ps(Z, BoxZ)), W);
+            Box = _mm256_add_ps(Box, _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(Plane.AbsX), ExtentX), _mm256_mul_ps(_mm256_set1_ps(Plane.AbsY), ExtentY)),
+                                                   _mm256_mul_ps(_mm256_set1_ps(Plane.AbsZ), ExtentZ)));
+
+            Inside = _mm256_and_ps(Inside, _mm256_and_ps(_mm256_cmp_ps(Sphere, NegativeRadius, _CMP_GE_OQ), _mm256_cmp_ps(Box, Zero, _CMP_GE_OQ)));
+        }
+
+        int Mask = _mm256_movemask_ps(Inside);
+        uint32_t Lanes = std::min(8u, Bounds->Count - Base);
+        for (uint32_t Lane = 0; Lane < Lanes; Lane++)
+        {
+            Visible[VisibleCount] = Base + Lane;
+            VisibleCount += (Mask >> Lane) & 1;
+        }
+    }
+    return VisibleCount;
+}
+
+#endif
+
+cull_path CullGetBestPath()
+{
+#ifdef HANDMADE_MATH__USE_SSE
+    static cull_path Best = CullSupportsAVX() ? cull_path::AVX : cull_path::SSE;
+    return Best;
+#else
+    return cull_path::Scalar;
+#endif
+}
+
+uint32_t CullFrustum(const cull_bounds *Bounds, const V4 *Planes, uint32_t *Visible, cull_path Path)
+{
+    cull_plane Loaded[6];
+    CullLoadPlanes(Loaded, Planes);
+
+    switch (Path)
+    {
+#ifdef HANDMADE_MATH__USE_SSE
+        case cull_path::SSE:
+            return CullFrustumSSE(Bounds, Loaded, Visible);
+        case cull_path::AVX:
+            if (CullGetBestPath() == cull_path::AVX)
+                return CullFrustumAVX(Bounds, Loaded, Visible);
+            return CullFrustumSSE(Bounds, Loaded, Visible);
+#endif
+        default:
+            return CullFrustumScalar(Bounds, Loaded, Visible);
+    }
+}
+
+uint32_t CullBenchmark()
+{
+    const uint32_t Counts[] = { 100'000, 1'000'000 };
+    const uint32_t Iterations = 20;
+    const float WorldSize = 2000.0f;
+    const char *Names[] = { "scalar", "SSE", "AVX" };
+
+    noclip_camera Camera = {};
+    Camera.Width = 1280.0f;
+    Camera.Height = 720.0f;
+    Camera.Position = HMM_Vec3(0.0f, 0.0f, 0.0f);
+    Camera.Front = HMM_Vec3(0.0f, 0.0f, -1.0f);
+    Camera.Up = HMM_Vec3(0.0f, 1.0f, 0.0f);
+    Camera.Right = HMM_Vec3(1.0f, 0.0f, 0.0f);
+    NoClipCameraUpdateFrustum(&Camera);
+
+    LogInfo("Culling Benchmark: sphere + AABB against 6 planes, best path is %s", Names[(int)CullGetBestPath()]);
+
+    std::mt19937 Random(1234);
+    std::uniform_real_distribution<float> Position(-WorldSize * 0.5f, WorldSize * 0.5f);
+    std::uniform_real_distribution<float> Size(0.5f, 20.0f);
+    uint32_t Failures = 0;
+    for (uint32_t Count : Counts)
+    {
+        cull_bounds Bounds;
+        CullBoundsResize(&Bounds, Count);
+        for (uint32_t Index = 0; Index < Count; Index++)
+        {
+            V3 Center = HMM_Vec3(Position(Random), Position(Random), Position(Random));
+            V3 Extent = HMM_Vec3(Size(Random), Size(Random), Size(Random));
+            CullBoundsSet(&Bounds, Index, { Center, HMM_LengthVec3(Extent) }, { HMM_SubtractVec3(Center, Extent), HMM_AddVec3(Center, Extent) });
+        }
+
+        std::vector<uint32_t> Visible(Count);
+        std::vector<uint32_t> ScalarSet;
+        std::vector<uint32_t> Difference;
+        double ScalarMs = 0.0;
+        for (cull_path Path : { cull_path::Scalar, cull_path::SSE, cull_path::AVX })
+        {
+#ifdef HANDMADE_MATH__USE_SSE
+            if (Path == cull_path::AVX && CullGetBestPath() != cull_path::AVX)
+                continue;
+#else
+            if (Path != cull_path::Scalar)
+                continue;
+#endif
+            uint32_t VisibleCount = 0;
+            timer Timer;
+            TimerInit(&Timer);
+            for (uint32_t Iteration = 0; Iteration < Iterations; Iteration++)
+                VisibleCount = CullFrustum(&Bounds, Camera.Planes, Visible.data(), Path);
+            double Ms = NanosecondsToMilliseconds(TimerGetElapsedNanoseconds(&Timer)) / Iterations;
+
+            // NOTE(amelie.h): Every path has to keep exactly the objects the scalar one keeps, matching counts alone
+            // would hide one object swapped for another.
+            std::vector<uint32_t> Set(Visible.begin(), Visible.begin() + VisibleCount);
+            std::sort(Set.begin(), Set.end());
+            if (Path == cull_path::Scalar)
+            {
+                ScalarMs = Ms;
+                ScalarSet = Set;
+            }
+            Difference.clear();
+            std::set_symmetric_difference(Set.begin(), Set.end(), ScalarSet.begin(), ScalarSet.end(), std::back_inserter(Difference));
+
+            LogInfo("  %7u objects | %-6s | %.3fms (%.2f ns/object, %.2fx) | %u visible",
+                    Count, Names[(int)Path], Ms, (Ms * 1'000'000.0) / Count, ScalarMs / Ms, VisibleCount);
+            if (!Difference.empty())
+            {
+                LogError("Culling Benchmark: %s disagrees with scalar on %zu of %u objects (first is object %u)!",
+                         Names[(int)Path], Difference.size(), Count, Difference[0]);
+                Failures++;
+            }
+        }
+    }
+
+    LogInfo("Culling Benchmark: %s", Failures ? "FAIL" : "PASS");
+    return Failures;
+}
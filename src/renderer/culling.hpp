@@ -0,0 +1,57 @@
+/**
+ *  Author: Amélie Heinrich
+ *  Company: Amélie Games
+ *  License: MIT
+ *  Create Time: 17/10/2026 18:10
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "math_types.hpp"
+
+#define CULL_BATCH_SIZE 8
+
+enum class cull_path
+{
+    Scalar,
+    SSE,
+    AVX
+};
+
+// NOTE(amelie.h): World space bounds as a structure of arrays, padded to CULL_BATCH_SIZE so a batch of 4 or 8 objects
+// loads straight into registers. An object is visible when both its sphere and its box touch the frustum: the sphere
+// is the cheap test, the box trims the long thin objects the sphere keeps.
+struct cull_bounds
+{
+    uint32_t Count;
+
+    std::vector<float> SphereX;
+    std::vector<float> SphereY;
+    std::vector<float> SphereZ;
+    std::vector<float> SphereRadius;
+
+    std::vector<float> BoxX;
+    std::vector<float> BoxY;
+    std::vector<float> BoxZ;
+    std::vector<float> ExtentX;
+    std::vector<float> ExtentY;
+    std::vector<float> ExtentZ;
+};
+
+bounding_sphere BoundingSphereTransform(bounding_sphere Sphere, hmm_mat4 Transform);
+aabb AabbTransform(aabb Box, hmm_mat4 Transform);
+
+void CullBoundsResize(cull_bounds *Bounds, uint32_t Count);
+void CullBoundsSet(cull_bounds *Bounds, uint32_t Index, bounding_sphere Sphere, aabb Box);
+
+// NOTE(amelie.h): Planes are the six noclip_camera planes, normals pointing inside and W the distance along the normal.
+// Writes the indices of the visible objects to Visible, which needs room for Bounds->Count entries, and returns how many.
+// The AVX path is only picked when the CPU and OS support it.
+cull_path CullGetBestPath();
+uint32_t CullFrustum(const cull_bounds *Bounds, const V4 *Planes, uint32_t *Visible, cull_path Path = CullGetBestPath());
+
+// NOTE(amelie.h): Returns how many paths kept a different set of objects than the scalar one.
+uint32_t CullBenchmark();
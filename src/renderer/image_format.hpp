@@ -0,0 +1,25 @@
+/**
+ *  Author: Amélie Heinrich
+ *  Company: Amélie Games
+ *  License: MIT
+ *  Create Time: 17/10/2026 17:05
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#define IMAGE_FILE_MAGIC 0x58455443
+#define IMAGE_FILE_VERSION 1
+
+// NOTE(amelie.h): Cooked image layout. An image_file_header followed by Width * Height RGBA pixels, one byte per
+// channel or one float per channel when Float is set. Rows are already flipped the way the renderer expects.
+struct image_file_header
+{
+    uint32_t Magic;
+    uint32_t Version;
+    uint32_t Width;
+    uint32_t Height;
+    uint32_t Channels;
+    uint32_t Float;
+};
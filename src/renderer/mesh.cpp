@@ -7,130 +7,351 @@
 
 #include "mesh.hpp"
 
-#include <assimp/Importer.hpp>
-#include <assimp/scene.h>
-#include <assimp/postprocess.h>
+#include "mesh_format.hpp"
+#include "timer.hpp"
 
+#include "scene/scene.hpp"
+#include "systems/file_system.hpp"
 #include "systems/log_system.hpp"
 
-mesh ProcessMesh(loaded_model *Model, aiMesh *Mesh, const aiScene *Scene, aiMatrix4x4* Matrix)
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+#include <unordered_map>
+
+static_assert(MESH_MAX_LODS == MESH_FILE_MAX_LODS, "Cooked LOD table and runtime LOD table must match!");
+static_assert(sizeof(meshlet) == 48, "Cooked meshlets are stored as raw meshlet structs!");
+
+bool ModelLoadMeshlets(mesh *Out, const file_mapping *Mapping, const mesh_file_entry *Entry)
 {
-    mesh Out;
+    uint64_t MeshletSize = (uint64_t)Entry->MeshletCount * sizeof(meshlet);
+    uint64_t VertexSize = (uint64_t)Entry->MeshletVertexCount * sizeof(uint32_t);
+    uint64_t TriangleSize = (uint64_t)Entry->MeshletTriangleCount * 3;
+    if (Entry->MeshletOffset + MeshletSize > Mapping->Size || Entry->MeshletVertexOffset + VertexSize > Mapping->Size ||
+        Entry->MeshletTriangleOffset + TriangleSize > Mapping->Size)
+        return false;
 
-    Out.Transform = HMM_Mat4d(1.0f);
+    meshlet_data *Data = &Out->Meshlets;
+    const meshlet *Meshlets = (const meshlet*)(Mapping->Data + Entry->MeshletOffset);
+    const uint32_t *Vertices = (const uint32_t*)(Mapping->Data + Entry->MeshletVertexOffset);
+    const uint8_t *Triangles = Mapping->Data + Entry->MeshletTriangleOffset;
+    Data->Meshlets.assign(Meshlets, Meshlets + Entry->MeshletCount);
+    Data->Vertices.assign(Vertices, Vertices + Entry->MeshletVertexCount);
+    Data->Triangles.assign(Triangles, Triangles + TriangleSize);
 
-    std::vector<mesh_vertex> Vertices;
-    std::vector<uint32_t> Indices;
+    // NOTE(amelie.h): Culling writes these straight into index lists, so a bad file must not reach past the vertex buffer.
+    for (auto& Meshlet : Data->Meshlets)
+    {
+        if ((uint64_t)Meshlet.VertexOffset + Meshlet.VertexCount > Entry->MeshletVertexCount ||
+            (uint64_t)Meshlet.TriangleOffset + Meshlet.TriangleCount * 3 > TriangleSize || Meshlet.VertexCount > MESHLET_MAX_VERTICES)
+            return false;
+        for (uint32_t Corner = 0; Corner < Meshlet.TriangleCount * 3; Corner++)
+            if (Data->Triangles[Meshlet.TriangleOffset + Corner] >= Meshlet.VertexCount)
+                return false;
+    }
+    for (uint32_t Vertex : Data->Vertices)
+        if (Vertex >= Entry->VertexCount)
+            return false;
+    return true;
+}
 
-    for (uint32_t VertexIndex = 0; VertexIndex < Mesh->mNumVertices; VertexIndex++)
+bool ModelLoadOccluder(mesh *Out, const uint8_t *Vertices, const uint8_t *Indices, const mesh_file_entry *Entry, uint32_t Stride, mesh_vertex_format Format)
+{
+    uint32_t Level = 0;
+    while (Level + 1 < Out->LodCount && Out->Lods[Level + 1].Error <= OCCLUSION_OCCLUDER_MAX_ERROR * Out->Bounds.Radius)
+        Level++;
+
+    // NOTE(amelie.h): Coarse LODs only touch a fraction of the shared vertex buffer, only those get decoded.
+    const mesh_lod *Lod = &Out->Lods[Level];
+    std::vector<uint32_t> Remap(Entry->VertexCount, UINT32_MAX);
+    mesh_occluder *Occluder = &Out->Occluder;
+    Occluder->Indices.resize(Lod->IndexCount);
+    for (uint32_t Index = 0; Index < Lod->IndexCount; Index++)
     {
-        mesh_vertex Vertex;
-        
-        Vertex.Position.X = Mesh->mVertices[VertexIndex].x;
-        Vertex.Position.Y = Mesh->mVertices[VertexIndex].y;
-        Vertex.Position.Z = Mesh->mVertices[VertexIndex].z;
+        uint32_t Vertex = Entry->IndexStride == sizeof(uint16_t) ? ((const uint16_t*)Indices)[Lod->FirstIndex + Index] : ((const uint32_t*)Indices)[Lod->FirstIndex + Index];
+        if (Vertex >= Entry->VertexCount)
+            return false;
 
-        if (Mesh->HasNormals())
+        if (Remap[Vertex] == UINT32_MAX)
         {
-            Vertex.Normal.X = Mesh->mNormals[VertexIndex].x;
-            Vertex.Normal.Y = Mesh->mNormals[VertexIndex].y;
-            Vertex.Normal.Z = Mesh->mNormals[VertexIndex].z;
-        }
+            Remap[Vertex] = (uint32_t)Occluder->Positions.size();
 
-        if (Mesh->mTextureCoords[0])
-        {
-            Vertex.UV.X = Mesh->mTextureCoords[0][VertexIndex].x;
-            Vertex.UV.Y = Mesh->mTextureCoords[0][VertexIndex].y;
-        } 
-        else
-        {
-            Vertex.UV = HMM_Vec2(0.0f, 0.0f);
+            V3 Position;
+            if (Format == mesh_vertex_format::Quantized)
+            {
+                uint16_t Quantized[3];
+                memcpy(Quantized, Vertices + (uint64_t)Vertex * Stride, sizeof(Quantized));
+                for (int Axis = 0; Axis < 3; Axis++)
+                    Position.Elements[Axis] = Out->PositionOffset.Elements[Axis] + Quantized[Axis] / 65535.0f * Out->PositionScale.Elements[Axis];
+            }
+            else
+            {
+                memcpy(Position.Elements, Vertices + (uint64_t)Vertex * Stride, sizeof(Position.Elements));
+            }
+            Occluder->Positions.push_back(Position);
         }
+        Occluder->Indices[Index] = Remap[Vertex];
+    }
+    return true;
+}
 
-        Vertices.push_back(Vertex);
+uint32_t MeshVertexFormatStride(mesh_vertex_format Format)
+{
+    switch (Format)
+    {
+        case mesh_vertex_format::Full:
+            return sizeof(mesh_vertex);
+        case mesh_vertex_format::Packed:
+            return sizeof(mesh_vertex_packed);
+        case mesh_vertex_format::Quantized:
+            return sizeof(mesh_vertex_quantized);
+        default:
+            return 0;
     }
+}
 
-    for (uint32_t FaceIndex = 0; FaceIndex < Mesh->mNumFaces; FaceIndex++)
+std::vector<gpu_vertex_attribute> MeshVertexFormatAttributes(mesh_vertex_format Format)
+{
+    switch (Format)
     {
-        aiFace Face = Mesh->mFaces[FaceIndex];
-        for (uint32_t IndexIndex = 0; IndexIndex < Face.mNumIndices; IndexIndex++)
-            Indices.push_back(Face.mIndices[IndexIndex]);
+        case mesh_vertex_format::Packed:
+            return {
+                { "POSITION", gpu_vertex_format::Float3, offsetof(mesh_vertex_packed, Position) },
+                { "NORMAL", gpu_vertex_format::SNorm16x2, offsetof(mesh_vertex_packed, Normal) },
+                { "TEXCOORD", gpu_vertex_format::Half2, offsetof(mesh_vertex_packed, UV) }
+            };
+        case mesh_vertex_format::Quantized:
+            return {
+                { "POSITION", gpu_vertex_format::UNorm16x4, offsetof(mesh_vertex_quantized, Position) },
+                { "NORMAL", gpu_vertex_format::SNorm16x2, offsetof(mesh_vertex_quantized, Normal) },
+                { "TEXCOORD", gpu_vertex_format::Half2, offsetof(mesh_vertex_quantized, UV) }
+            };
+        default:
+            return {};
     }
+}
 
-    Out.VertexCount = Vertices.size();
-    Out.IndexCount = Indices.size();
+uint32_t MeshSelectLod(mesh *Mesh, hmm_mat4 Transform, camera_data *Camera, float ViewportHeight, float Threshold)
+{
+    // NOTE(amelie.h): Project each LOD's object space error to pixels at the closest point of the bounding sphere
+    // and take the coarsest one that stays under Threshold pixels.
+    V3 Center = HMM_MultiplyMat4ByVec4(Transform, HMM_Vec4v(Mesh->Bounds.Center, 1.0f)).XYZ;
+    float Scale = 0.0f;
+    for (int Column = 0; Column < 3; Column++)
+        Scale = std::max(Scale, HMM_LengthVec3(HMM_Vec3(Transform.Elements[Column][0], Transform.Elements[Column][1], Transform.Elements[Column][2])));
 
-    GpuBufferInit(&Out.VertexBuffer, Vertices.size() * sizeof(mesh_vertex), sizeof(mesh_vertex), gpu_buffer_type::Vertex);
-    GpuBufferUpload(&Out.VertexBuffer, Vertices.data(), Vertices.size() * sizeof(mesh_vertex));
-    GpuBufferInit(&Out.IndexBuffer, Indices.size() * sizeof(uint32_t), sizeof(uint32_t), gpu_buffer_type::Index);
-    GpuBufferUpload(&Out.IndexBuffer, Indices.data(), Indices.size() * sizeof(uint32_t));
+    float Distance = HMM_LengthVec3(HMM_SubtractVec3(Center, Camera->Position)) - Mesh->Bounds.Radius * Scale;
+    if (Distance <= 0.0f)
+        return 0;
 
-    aiMaterial *Material = Scene->mMaterials[Mesh->mMaterialIndex];
-    
+    float PixelsPerUnit = Camera->Projection.Elements[1][1] * ViewportHeight * 0.5f / Distance;
+    uint32_t Lod = 0;
+    for (uint32_t Level = 1; Level < Mesh->LodCount; Level++)
     {
-        aiString String;
-        Material->GetTexture(aiTextureType_DIFFUSE, 0, &String);
-        if (String.length)
-        {
-            std::string TexturePath = Model->WorkingDirectory + '/' + String.C_Str();
-
-            cpu_image Image;
-            CpuImageLoad(&Image, TexturePath);
-            GpuImageInitFromCPU(&Out.Albedo, &Image);
-            CpuImageFree(&Image);
-        }
+        if (Mesh->Lods[Level].Error * Scale * PixelsPerUnit > Threshold)
+            break;
+        Lod = Level;
     }
+    return Lod;
+}
 
+aabb MeshComputeBox(const uint8_t *Vertices, uint64_t VertexCount, uint32_t Stride, mesh_vertex_format Format, V3 PositionOffset, V3 PositionScale)
+{
+    // NOTE(amelie.h): Quantized positions already span exactly the box the encoder measured.
+    if (Format == mesh_vertex_format::Quantized || !VertexCount)
+        return { PositionOffset, HMM_AddVec3(PositionOffset, PositionScale) };
+
+    // NOTE(amelie.h): Full and Packed both start with a float3 position.
+    aabb Box = { HMM_Vec3(FLT_MAX, FLT_MAX, FLT_MAX), HMM_Vec3(-FLT_MAX, -FLT_MAX, -FLT_MAX) };
+    for (uint64_t Vertex = 0; Vertex < VertexCount; Vertex++)
     {
-        aiString String;
-        Material->GetTexture(aiTextureType_NORMALS, 0, &String);
-        if (String.length)
+        float Position[3];
+        memcpy(Position, Vertices + Vertex * Stride, sizeof(Position));
+        for (int Axis = 0; Axis < 3; Axis++)
         {
-            std::string TexturePath = Model->WorkingDirectory + '/' + String.C_Str();
-            
-            cpu_image Image;
-            CpuImageLoad(&Image, TexturePath);
-            GpuImageInitFromCPU(&Out.Normal, &Image);
-            CpuImageFree(&Image);
+            Box.Min.Elements[Axis] = std::min(Box.Min.Elements[Axis], Position[Axis]);
+            Box.Max.Elements[Axis] = std::max(Box.Max.Elements[Axis], Position[Axis]);
         }
     }
+    return Box;
+}
+
+void ModelLoadTexture(loaded_model *Model, gpu_image *Image, const char *Path)
+{
+    if (!Path[0])
+        return;
 
-    return Out;
+    cpu_image CPU;
+    CpuImageLoad(&CPU, Model->WorkingDirectory + '/' + Path);
+    GpuImageInitFromCPU(Image, &CPU);
+    CpuImageFree(&CPU);
 }
 
-void ProcessNode(loaded_model *Model, aiNode *Node, const aiScene *Scene)
+bool ModelLoadCooked(loaded_model *Model, const std::string& Path)
 {
-    for (int MeshIndex = 0; MeshIndex < Node->mNumMeshes; MeshIndex++)
+    file_mapping Mapping;
+    if (!FileMappingOpen(&Mapping, Path))
+        return false;
+
+    const mesh_file_header *Header = (const mesh_file_header*)Mapping.Data;
+    if (Mapping.Size < sizeof(mesh_file_header) || Header->Magic != MESH_FILE_MAGIC || Header->Version != MESH_FILE_VERSION ||
+        Header->VertexFormat >= (uint32_t)mesh_vertex_format::Count || Header->VertexStride != MeshVertexFormatStride((mesh_vertex_format)Header->VertexFormat))
     {
-        aiMesh *Mesh = Scene->mMeshes[MeshIndex];
-        auto MeshToPush = ProcessMesh(Model, Mesh, Scene, &Node->mTransformation);
-        Model->Meshes.push_back(MeshToPush);
+        LogError("Cooked model %s is invalid or out of date!", Path.c_str());
+        FileMappingClose(&Mapping);
+        return false;
     }
-    for (int ChildIndex = 0; ChildIndex < Node->mNumChildren; ChildIndex++)
+
+    const mesh_file_entry *Entries = (const mesh_file_entry*)(Mapping.Data + sizeof(mesh_file_header));
+    if (sizeof(mesh_file_header) + Header->MeshCount * sizeof(mesh_file_entry) > Mapping.Size)
     {
-        ProcessNode(Model, Node->mChildren[ChildIndex], Scene);
+        LogError("Cooked model %s is truncated!", Path.c_str());
+        FileMappingClose(&Mapping);
+        return false;
     }
+
+    Model->WorkingDirectory = Path.substr(0, Path.find_last_of('/'));
+    Model->VertexFormat = (mesh_vertex_format)Header->VertexFormat;
+    std::unordered_map<std::string, uint32_t> Materials;
+    bool Valid = true;
+    for (uint32_t MeshIndex = 0; MeshIndex < Header->MeshCount; MeshIndex++)
+    {
+        const mesh_file_entry *Entry = &Entries[MeshIndex];
+        uint64_t VertexSize = Entry->VertexCount * Header->VertexStride;
+        uint64_t IndexSize = Entry->IndexCount * Entry->IndexStride;
+        if (Entry->IndexStride != sizeof(uint16_t) && Entry->IndexStride != sizeof(uint32_t))
+        {
+            LogError("Cooked model %s has an invalid index stride of %u!", Path.c_str(), Entry->IndexStride);
+            Valid = false;
+            break;
+        }
+        if (Entry->VertexOffset + VertexSize > Mapping.Size || Entry->IndexOffset + IndexSize > Mapping.Size)
+        {
+            LogError("Cooked model %s has a mesh outside of the file!", Path.c_str());
+            Valid = false;
+            break;
+        }
+        if (Entry->LodCount == 0 || Entry->LodCount > MESH_MAX_LODS)
+        {
+            LogError("Cooked model %s has an invalid LOD count of %u!", Path.c_str(), Entry->LodCount);
+            Valid = false;
+            break;
+        }
+
+        mesh Out = {};
+        bool ValidLods = true;
+        for (uint32_t Level = 0; Level < Entry->LodCount; Level++)
+        {
+            const mesh_file_lod *Lod = &Entry->Lods[Level];
+            if ((uint64_t)Lod->FirstIndex + Lod->IndexCount > Entry->IndexCount)
+                ValidLods = false;
+            Out.Lods[Level] = { Lod->FirstIndex, Lod->IndexCount, Lod->Error };
+        }
+        if (!ValidLods)
+        {
+            LogError("Cooked model %s has a LOD outside of its index buffer!", Path.c_str());
+            Valid = false;
+            break;
+        }
+        Out.LodCount = Entry->LodCount;
+        Out.Bounds.Center = HMM_Vec3(Entry->BoundsCenter[0], Entry->BoundsCenter[1], Entry->BoundsCenter[2]);
+        Out.Bounds.Radius = Entry->BoundsRadius;
+        if (!ModelLoadMeshlets(&Out, &Mapping, Entry))
+        {
+            LogError("Cooked model %s has invalid meshlets!", Path.c_str());
+            Valid = false;
+            break;
+        }
+
+        memcpy(&Out.Transform, Entry->Transform, sizeof(Out.Transform));
+        Out.PositionOffset = HMM_Vec3(Entry->PositionOffset[0], Entry->PositionOffset[1], Entry->PositionOffset[2]);
+        Out.PositionScale = HMM_Vec3(Entry->PositionScale[0], Entry->PositionScale[1], Entry->PositionScale[2]);
+        Out.VertexCount = (int)Entry->VertexCount;
+        Out.Box = MeshComputeBox(Mapping.Data + Entry->VertexOffset, Entry->VertexCount, Header->VertexStride, Model->VertexFormat, Out.PositionOffset, Out.PositionScale);
+        Out.IndexCount = (int)Entry->IndexCount;
+        if (!ModelLoadOccluder(&Out, Mapping.Data + Entry->VertexOffset, Mapping.Data + Entry->IndexOffset, Entry, Header->VertexStride, Model->VertexFormat))
+        {
+            LogError("Cooked model %s has an index outside of its vertex buffer!", Path.c_str());
+            Valid = false;
+            break;
+        }
+
+        // NOTE(amelie.h): The blobs go straight from the mapped file into the upload ring, no intermediate copy.
+        GpuBufferInit(&Out.VertexBuffer, VertexSize, Header->VertexStride, gpu_buffer_type::Vertex);
+        GpuBufferUpload(&Out.VertexBuffer, Mapping.Data + Entry->VertexOffset, VertexSize);
+        GpuBufferInit(&Out.IndexBuffer, IndexSize, Entry->IndexStride, gpu_buffer_type::Index);
+        GpuBufferUpload(&Out.IndexBuffer, Mapping.Data + Entry->IndexOffset, IndexSize);
+
+        std::string MaterialKey = std::string(Entry->Albedo) + '|' + Entry->Normal;
+        auto Material = Materials.find(MaterialKey);
+        if (Material == Materials.end())
+        {
+            mesh_material NewMaterial = {};
+            ModelLoadTexture(Model, &NewMaterial.Albedo, Entry->Albedo);
+            ModelLoadTexture(Model, &NewMaterial.Normal, Entry->Normal);
+            Material = Materials.emplace(MaterialKey, (uint32_t)Model->Materials.size()).first;
+            Model->Materials.push_back(NewMaterial);
+        }
+        Out.Material = Material->second;
+
+        Model->Meshes.push_back(Out);
+    }
+
+    FileMappingClose(&Mapping);
+
+    // NOTE(amelie.h): A half loaded model is worse than none, drop the meshes and materials created before the bad entry.
+    if (!Valid)
+    {
+        ModelFree(Model);
+        return false;
+    }
+    return true;
+}
+
+std::string ModelGetCookedPath(const std::string& Path)
+{
+    return FileReplaceExtension(Path, ".mesh");
 }
 
 void ModelLoad(loaded_model *Model, const std::string& Path)
 {
-    Assimp::Importer Importer;
-    const aiScene *Scene = Importer.ReadFile(Path, aiProcess_CalcTangentSpace);
-    if (!Scene || Scene->mFlags & AI_SCENE_FLAGS_INCOMPLETE || !Scene->mRootNode)
+    timer Timer;
+    TimerInit(&Timer);
+    Model->VertexFormat = mesh_vertex_format::Full;
+
+    // NOTE(amelie.h): The runtime never imports source assets, tools/asset_cooker produces the .mesh and .tex files.
+    std::string CookedPath = ModelGetCookedPath(Path);
+    if (!FileBufferExists(CookedPath))
     {
-        LogError("Failed to load assimp model! (%s)", Path.c_str());
+        LogError("Model %s has not been cooked, run asset_cooker first!", Path.c_str());
+        return;
     }
-    Model->WorkingDirectory = Path.substr(0, Path.find_last_of('/'));
-    ProcessNode(Model, Scene->mRootNode, Scene);
+
+    if (!ModelLoadCooked(Model, CookedPath))
+    {
+        LogError("Failed to load model! (%s)", Path.c_str());
+        return;
+    }
+
+    LogInfo("Loaded model %s (%zu meshes, %zu materials) in %.2fms", CookedPath.c_str(), Model->Meshes.size(), Model->Materials.size(), TimerGetElapsed(&Timer));
 }
 
 void ModelFree(loaded_model *Model)
 {
-    for (auto Mesh : Model->Meshes)
+    for (auto& Material : Model->Materials)
+    {
+        if (Material.Albedo.Private)
+            GpuImageFree(&Material.Albedo);
+        if (Material.Normal.Private)
+            GpuImageFree(&Material.Normal);
+    }
+    for (auto& Mesh : Model->Meshes)
     {
-        GpuImageFree(&Mesh.Albedo);
         GpuBufferFree(&Mesh.VertexBuffer);
         GpuBufferFree(&Mesh.IndexBuffer);
     }
+    Model->Materials.clear();
     Model->Meshes.clear();
 }
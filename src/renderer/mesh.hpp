@@ -13,6 +13,21 @@
 #include "math_types.hpp"
 #include "gpu/gpu_buffer.hpp"
 #include "gpu/gpu_image.hpp"
+#include "gpu/gpu_pipeline.hpp"
+#include "renderer/meshlet.hpp"
+#include "renderer/occlusion_culling.hpp"
+
+struct camera_data;
+
+// NOTE(amelie.h): Vertex layouts a model can be cooked with. Packed stores octahedral snorm16 normals and half UVs,
+// Quantized also stores positions as unorm16 inside the mesh bounds, undone with the mesh PositionOffset/PositionScale.
+enum class mesh_vertex_format : uint32_t
+{
+    Full,
+    Packed,
+    Quantized,
+    Count
+};
 
 struct mesh_vertex
 {
@@ -21,6 +36,39 @@ struct mesh_vertex
     V2 UV;
 };
 
+struct mesh_vertex_packed
+{
+    V3 Position;
+    int16_t Normal[2];
+    uint16_t UV[2];
+};
+
+struct mesh_vertex_quantized
+{
+    uint16_t Position[4];
+    int16_t Normal[2];
+    uint16_t UV[2];
+};
+
+#define MESH_MAX_LODS 8
+
+// NOTE(amelie.h): A LOD is a range of the mesh index buffer. Error is the object space distance the simplified surface
+// may be away from LOD 0.
+struct mesh_lod
+{
+    uint32_t FirstIndex;
+    uint32_t IndexCount;
+    float Error;
+};
+
+// NOTE(amelie.h): Meshes cooked with the same texture pair share a material, so the images are only loaded once and the
+// render queue can tell when two draws need the same bindings.
+struct mesh_material
+{
+    gpu_image Albedo;
+    gpu_image Normal;
+};
+
 struct mesh
 {
     gpu_buffer VertexBuffer;
@@ -28,16 +76,33 @@ struct mesh
     int VertexCount;
     int IndexCount;
 
-    gpu_image Albedo;
-    gpu_image Normal;
+    uint32_t Material;
     hmm_mat4 Transform;
+    V3 PositionOffset;
+    V3 PositionScale;
+
+    bounding_sphere Bounds;
+    aabb Box;
+    mesh_lod Lods[MESH_MAX_LODS];
+    uint32_t LodCount;
+
+    // NOTE(amelie.h): CPU copy of the LOD 0 meshlets for culling, their vertex indices point into VertexBuffer.
+    meshlet_data Meshlets;
+    mesh_occluder Occluder;
 };
 
 struct loaded_model
 {
     std::vector<mesh> Meshes;
+    std::vector<mesh_material> Materials;
     std::string WorkingDirectory;
+    mesh_vertex_format VertexFormat;
 };
 
+uint32_t MeshVertexFormatStride(mesh_vertex_format Format);
+uint32_t MeshSelectLod(mesh *Mesh, hmm_mat4 Transform, camera_data *Camera, float ViewportHeight, float Threshold);
+std::vector<gpu_vertex_attribute> MeshVertexFormatAttributes(mesh_vertex_format Format);
+
+std::string ModelGetCookedPath(const std::string& Path);
 void ModelLoad(loaded_model *Model, const std::string& Path);
 void ModelFree(loaded_model *Model);
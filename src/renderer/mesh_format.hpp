@@ -0,0 +1,68 @@
+/**
+ *  Author: Amélie Heinrich
+ *  Company: Amélie Games
+ *  License: MIT
+ *  Create Time: 17/10/2026 16:45
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#define MESH_FILE_MAGIC 0x4853454D
+#define MESH_FILE_VERSION 5
+#define MESH_FILE_PATH_LENGTH 128
+#define MESH_FILE_ALIGNMENT 16
+#define MESH_FILE_MAX_LODS 8
+
+// NOTE(amelie.h): Cooked model layout. A mesh_file_header, MeshCount mesh_file_entry structs, then the vertex
+// and index blobs. Every blob starts on a MESH_FILE_ALIGNMENT boundary and offsets are from the start of the file.
+// Vertices are laid out as VertexFormat (a mesh_vertex_format), indices are IndexStride bytes wide (uint16_t for meshes
+// under 65536 vertices, uint32_t otherwise), and texture paths point at cooked .tex files relative to the cooked file.
+// The index blob holds every LOD back to back, LOD 0 first, each one a range described by a mesh_file_lod.
+// LOD 0 is also split into meshlets: a blob of MeshletCount meshlet structs, one of MeshletVertexCount uint32_t
+// vertex indices and one of MeshletTriangleCount * 3 uint8_t local indices.
+struct mesh_file_header
+{
+    uint32_t Magic;
+    uint32_t Version;
+    uint32_t MeshCount;
+    uint32_t VertexStride;
+    uint32_t VertexFormat;
+    uint32_t Reserved[3]; // NOTE(amelie.h): Keeps the entry table aligned.
+};
+
+struct mesh_file_lod
+{
+    uint32_t FirstIndex;
+    uint32_t IndexCount;
+    float Error;
+    uint32_t Reserved;
+};
+
+struct mesh_file_entry
+{
+    uint64_t VertexOffset;
+    uint64_t VertexCount;
+    uint64_t IndexOffset;
+    uint64_t IndexCount;
+    uint32_t IndexStride;
+    uint32_t Reserved;
+    float Transform[16];
+    float PositionOffset[3];
+    float PositionScale[3];
+    float BoundsCenter[3];
+    float BoundsRadius;
+    uint32_t LodCount;
+    uint32_t Reserved2[3];
+    mesh_file_lod Lods[MESH_FILE_MAX_LODS];
+    uint64_t MeshletOffset;
+    uint64_t MeshletVertexOffset;
+    uint64_t MeshletTriangleOffset;
+    uint32_t MeshletCount;
+    uint32_t MeshletVertexCount;
+    uint32_t MeshletTriangleCount;
+    uint32_t Reserved3;
+    char Albedo[MESH_FILE_PATH_LENGTH];
+    char Normal[MESH_FILE_PATH_LENGTH];
+};
@@ -0,0 +1,116 @@
+/**
+ *  Author: Amélie Heinrich
+ *  Company: Amélie Games
+ *  License: MIT
+ *  Create Time: 17/10/2026 18:00
+ */
+
+#include "meshlet.hpp"
+#include "mesh.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+void MeshletComputeBounds(meshlet *Meshlet, const std::vector<mesh_vertex>& Vertices, const uint32_t *MeshletVertices, const uint8_t *MeshletTriangles)
+{
+    V3 Min = Vertices[MeshletVertices[0]].Position;
+    V3 Max = Min;
+    for (uint32_t Vertex = 0; Vertex < Meshlet->VertexCount; Vertex++)
+    {
+        V3 Position = Vertices[MeshletVertices[Vertex]].Position;
+        for (int Axis = 0; Axis < 3; Axis++)
+        {
+            Min.Elements[Axis] = std::min(Min.Elements[Axis], Position.Elements[Axis]);
+            Max.Elements[Axis] = std::max(Max.Elements[Axis], Position.Elements[Axis]);
+        }
+    }
+
+    Meshlet->Center = HMM_MultiplyVec3f(HMM_AddVec3(Min, Max), 0.5f);
+    Meshlet->Radius = 0.0f;
+    for (uint32_t Vertex = 0; Vertex < Meshlet->VertexCount; Vertex++)
+        Meshlet->Radius = std::max(Meshlet->Radius, HMM_LengthVec3(HMM_SubtractVec3(Vertices[MeshletVertices[Vertex]].Position, Meshlet->Center)));
+
+    // NOTE(amelie.h): Geometric normals, counter clockwise is front facing like the forward pipelines expect.
+    std::vector<V3> Normals;
+    Normals.reserve(Meshlet->TriangleCount);
+    V3 Axis = HMM_Vec3(0.0f, 0.0f, 0.0f);
+    for (uint32_t Triangle = 0; Triangle < Meshlet->TriangleCount; Triangle++)
+    {
+        V3 A = Vertices[MeshletVertices[MeshletTriangles[Triangle * 3 + 0]]].Position;
+        V3 B = Vertices[MeshletVertices[MeshletTriangles[Triangle * 3 + 1]]].Position;
+        V3 C = Vertices[MeshletVertices[MeshletTriangles[Triangle * 3 + 2]]].Position;
+        V3 Normal = HMM_Cross(HMM_SubtractVec3(B, A), HMM_SubtractVec3(C, A));
+        float Length = HMM_LengthVec3(Normal);
+        if (Length <= 0.0f)
+            continue;
+
+        Normal = HMM_DivideVec3f(Normal, Length);
+        Normals.push_back(Normal);
+        Axis = HMM_AddVec3(Axis, Normal);
+    }
+
+    Meshlet->ConeAxis = HMM_Vec3(0.0f, 0.0f, 0.0f);
+    Meshlet->ConeCutoff = 1.0f;
+    float AxisLength = HMM_LengthVec3(Axis);
+    if (AxisLength <= 0.0f)
+        return;
+
+    Meshlet->ConeAxis = HMM_DivideVec3f(Axis, AxisLength);
+    float MinDot = 1.0f;
+    for (auto& Normal : Normals)
+        MinDot = std::min(MinDot, HMM_DotVec3(Normal, Meshlet->ConeAxis));
+
+    // NOTE(amelie.h): MinDot is cos of the normal cone half angle. Widening it by 90 degrees to get the backface cone
+    // gives -cos(angle + 90) = sin(angle).
+    if (MinDot > 0.0f)
+        Meshlet->ConeCutoff = sqrtf(1.0f - MinDot * MinDot);
+}
+
+void MeshletBuild(meshlet_data *Out, const std::vector<mesh_vertex>& Vertices, const uint32_t *Indices, uint32_t IndexCount)
+{
+    Out->Meshlets.clear();
+    Out->Vertices.clear();
+    Out->Triangles.clear();
+
+    std::vector<uint8_t> Local(Vertices.size(), 0xFF);
+    meshlet Current = {};
+
+    auto Flush = [&]() {
+        if (!Current.TriangleCount)
+            return;
+        for (uint32_t Vertex = 0; Vertex < Current.VertexCount; Vertex++)
+            Local[Out->Vertices[Current.VertexOffset + Vertex]] = 0xFF;
+
+        MeshletComputeBounds(&Current, Vertices, &Out->Vertices[Current.VertexOffset], &Out->Triangles[Current.TriangleOffset]);
+        Out->Meshlets.push_back(Current);
+
+        Current = {};
+        Current.VertexOffset = (uint32_t)Out->Vertices.size();
+        Current.TriangleOffset = (uint32_t)Out->Triangles.size();
+    };
+
+    for (uint32_t Triangle = 0; Triangle < IndexCount / 3; Triangle++)
+    {
+        const uint32_t *Corners = &Indices[Triangle * 3];
+        uint32_t NewVertices = 0;
+        for (int Corner = 0; Corner < 3; Corner++)
+            if (Local[Corners[Corner]] == 0xFF && (Corner < 1 || Corners[Corner] != Corners[0]) && (Corner < 2 || Corners[Corner] != Corners[1]))
+                NewVertices++;
+
+        if (Current.VertexCount + NewVertices > MESHLET_MAX_VERTICES || Current.TriangleCount + 1 > MESHLET_MAX_TRIANGLES)
+            Flush();
+
+        for (int Corner = 0; Corner < 3; Corner++)
+        {
+            uint32_t Vertex = Corners[Corner];
+            if (Local[Vertex] == 0xFF)
+            {
+                Local[Vertex] = (uint8_t)Current.VertexCount++;
+                Out->Vertices.push_back(Vertex);
+            }
+            Out->Triangles.push_back(Local[Vertex]);
+        }
+        Current.TriangleCount++;
+    }
+    Flush();
+}
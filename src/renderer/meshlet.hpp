@@ -0,0 +1,46 @@
+/**
+ *  Author: Amélie Heinrich
+ *  Company: Amélie Games
+ *  License: MIT
+ *  Create Time: 17/10/2026 18:00
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "math_types.hpp"
+
+struct mesh_vertex;
+
+// NOTE(amelie.h): 64 vertices and 124 triangles is what most mesh shader hardware likes, and keeps local indices in a byte.
+#define MESHLET_MAX_VERTICES 64
+#define MESHLET_MAX_TRIANGLES 124
+
+// NOTE(amelie.h): A meshlet indexes MeshletVertices from VertexOffset, those hold indices into the mesh vertex buffer.
+// Its triangles are TriangleCount * 3 bytes of MeshletTriangles from TriangleOffset, each byte a local vertex index.
+// The cone is a backface cone: if the camera sits inside it, every triangle of the meshlet faces away.
+// A ConeCutoff of 1 means the normals spread too much for the cone to ever cull.
+struct meshlet
+{
+    uint32_t VertexOffset;
+    uint32_t TriangleOffset;
+    uint32_t VertexCount;
+    uint32_t TriangleCount;
+
+    V3 Center;
+    float Radius;
+    V3 ConeAxis;
+    float ConeCutoff;
+};
+
+struct meshlet_data
+{
+    std::vector<meshlet> Meshlets;
+    std::vector<uint32_t> Vertices;
+    std::vector<uint8_t> Triangles;
+};
+
+// NOTE(amelie.h): Greedy, walks the index list in order so feed it vertex cache optimized indices to get compact meshlets.
+void MeshletBuild(meshlet_data *Out, const std::vector<mesh_vertex>& Vertices, const uint32_t *Indices, uint32_t IndexCount);
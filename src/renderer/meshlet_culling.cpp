@@ -0,0 +1,203 @@
+/**
+ *  Author: Amélie Heinrich
+ *  Company: Amélie Games
+ *  License: MIT
+ *  Create Time: 17/10/2026 18:05
+ */
+
+#include "meshlet_culling.hpp"
+
+#include "timer.hpp"
+#include "cameras/noclip_camera.hpp"
+#include "renderer/mesh.hpp"
+#include "systems/log_system.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+
+uint32_t MeshletCull(const meshlet_data *Data, hmm_mat4 Transform, const V4 *Planes, V3 CameraPosition, std::vector<uint32_t>& Indices, meshlet_cull_stats *Stats)
+{
+    float Scales[3];
+    for (int Column = 0; Column < 3; Column++)
+        Scales[Column] = HMM_LengthVec3(HMM_Vec3(Transform.Elements[Column][0], Transform.Elements[Column][1], Transform.Elements[Column][2]));
+    float Scale = std::max(Scales[0], std::max(Scales[1], Scales[2]));
+    float MinScale = std::min(Scales[0], std::min(Scales[1], Scales[2]));
+    bool ConeTest = MinScale > 0.0f && Scale / MinScale < 1.01f;
+
+    uint32_t Visible = 0;
+    for (auto& Meshlet : Data->Meshlets)
+    {
+        Stats->Meshlets++;
+
+        V3 Center = HMM_MultiplyMat4ByVec4(Transform, HMM_Vec4v(Meshlet.Center, 1.0f)).XYZ;
+        float Radius = Meshlet.Radius * Scale;
+
+        bool Inside = true;
+        for (int Plane = 0; Plane < 6 && Inside; Plane++)
+            Inside = HMM_DotVec3(Planes[Plane].XYZ, Center) - Planes[Plane].W >= -Radius;
+        if (!Inside)
+        {
+            Stats->FrustumCulled++;
+            continue;
+        }
+
+        if (ConeTest && Meshlet.ConeCutoff < 1.0f)
+        {
+            V3 Axis = HMM_NormalizeVec3(HMM_MultiplyMat4ByVec4(Transform, HMM_Vec4v(Meshlet.ConeAxis, 0.0f)).XYZ);
+            V3 View = HMM_SubtractVec3(Center, CameraPosition);
+            if (HMM_DotVec3(View, Axis) >= Meshlet.ConeCutoff * HMM_LengthVec3(View) + Radius)
+            {
+                Stats->ConeCulled++;
+                continue;
+            }
+        }
+
+        const uint32_t *Vertices = &Data->Vertices[Meshlet.VertexOffset];
+        const uint8_t *Triangles = &Data->Triangles[Meshlet.TriangleOffset];
+        for (uint32_t Corner = 0; Corner < Meshlet.TriangleCount * 3; Corner++)
+            Indices.push_back(Vertices[Triangles[Corner]]);
+
+        Stats->Triangles += Meshlet.TriangleCount;
+        Visible++;
+    }
+    return Visible;
+}
+
+uint32_t MeshletCullBenchmark()
+{
+    const uint32_t Rings = 256;
+    const uint32_t Segments = 512;
+    const int GridSize = 8;
+    const float Spacing = 3.0f;
+
+    // NOTE(amelie.h): A dense sphere instanced on a grid around the camera, the same shape the cooker would hand us.
+    std::vector<mesh_vertex> Vertices;
+    std::vector<uint32_t> Indices;
+    for (uint32_t Ring = 0; Ring <= Rings; Ring++)
+    {
+        for (uint32_t Segment = 0; Segment <= Segments; Segment++)
+        {
+            float Theta = HMM_PI32 * Ring / Rings;
+            float Phi = 2.0f * HMM_PI32 * Segment / Segments;
+            V3 Position = HMM_Vec3(sinf(Theta) * cosf(Phi), cosf(Theta), sinf(Theta) * sinf(Phi));
+            Vertices.push_back({ Position, Position, HMM_Vec2((float)Segment / Segments, (float)Ring / Rings) });
+        }
+    }
+    for (uint32_t Ring = 0; Ring < Rings; Ring++)
+    {
+        for (uint32_t Segment = 0; Segment < Segments; Segment++)
+        {
+            uint32_t A = Ring * (Segments + 1) + Segment;
+            uint32_t B = A + Segments + 1;
+            Indices.insert(Indices.end(), { A, A + 1, B, A + 1, B + 1, B });
+        }
+    }
+
+    timer Timer;
+    TimerInit(&Timer);
+    meshlet_data Data;
+    MeshletBuild(&Data, Vertices, Indices.data(), (uint32_t)Indices.size());
+    double BuildMs = NanosecondsToMilliseconds(TimerGetElapsedNanoseconds(&Timer));
+
+    std::vector<hmm_mat4> Transforms;
+    for (int X = -GridSize / 2; X < GridSize / 2; X++)
+        for (int Z = -GridSize / 2; Z < GridSize / 2; Z++)
+            Transforms.push_back(HMM_Translate(HMM_Vec3((X + 0.5f) * Spacing, 0.0f, (Z + 0.5f) * Spacing)));
+
+    uint64_t TotalTriangles = (uint64_t)(Indices.size() / 3) * Transforms.size();
+    LogInfo("Meshlet Culling Benchmark: %zu instances of %zu triangles, %zu meshlets each (built in %.2fms, %.1f triangles/meshlet)",
+            Transforms.size(), Indices.size() / 3, Data.Meshlets.size(), BuildMs, (float)(Indices.size() / 3) / Data.Meshlets.size());
+
+    noclip_camera Camera = {};
+    Camera.Width = 1280.0f;
+    Camera.Height = 720.0f;
+    Camera.WorldUp = HMM_Vec3(0.0f, 1.0f, 0.0f);
+
+    // NOTE(amelie.h): Kept triangles come back as mesh vertex indices in their original order, this finds which source
+    // triangle they were.
+    uint32_t TriangleCount = (uint32_t)(Indices.size() / 3);
+    std::unordered_map<uint64_t, uint32_t> TriangleIndices;
+    TriangleIndices.reserve(TriangleCount);
+    auto TriangleKey = [](const uint32_t *Corners) {
+        return (uint64_t)Corners[0] << 42 | (uint64_t)Corners[1] << 21 | (uint64_t)Corners[2];
+    };
+    for (uint32_t Triangle = 0; Triangle < TriangleCount; Triangle++)
+        TriangleIndices.emplace(TriangleKey(&Indices[Triangle * 3]), Triangle);
+
+    std::vector<uint32_t> Visible;
+    std::vector<uint32_t> InstanceVisible;
+    std::vector<uint8_t> Kept(TriangleCount);
+    Visible.reserve(Indices.size() * Transforms.size());
+    uint32_t Failures = 0;
+    const float Yaws[] = { 0.0f, 45.0f, 90.0f, 180.0f };
+    for (float Yaw : Yaws)
+    {
+        Camera.Position = HMM_Vec3(0.0f, 0.5f, 0.0f);
+        Camera.Front = HMM_Vec3(cosf(HMM_ToRadians(Yaw)), 0.0f, sinf(HMM_ToRadians(Yaw)));
+        Camera.Right = HMM_NormalizeVec3(HMM_Cross(Camera.Front, Camera.WorldUp));
+        Camera.Up = HMM_Cross(Camera.Right, Camera.Front);
+        NoClipCameraUpdateFrustum(&Camera);
+
+        meshlet_cull_stats Stats = {};
+        Visible.clear();
+        TimerRestart(&Timer);
+        for (auto& Transform : Transforms)
+            MeshletCull(&Data, Transform, Camera.Planes, Camera.Position, Visible, &Stats);
+        double CullMs = NanosecondsToMilliseconds(TimerGetElapsedNanoseconds(&Timer));
+
+        // NOTE(amelie.h): Brute force reference. A triangle facing the camera with a corner inside every plane is
+        // certainly on screen, culling must have kept it.
+        uint32_t Dropped = 0;
+        for (auto& Transform : Transforms)
+        {
+            meshlet_cull_stats InstanceStats = {};
+            InstanceVisible.clear();
+            MeshletCull(&Data, Transform, Camera.Planes, Camera.Position, InstanceVisible, &InstanceStats);
+
+            std::fill(Kept.begin(), Kept.end(), 0);
+            for (size_t Corner = 0; Corner + 2 < InstanceVisible.size(); Corner += 3)
+            {
+                auto Triangle = TriangleIndices.find(TriangleKey(&InstanceVisible[Corner]));
+                if (Triangle != TriangleIndices.end())
+                    Kept[Triangle->second] = 1;
+            }
+
+            for (uint32_t Triangle = 0; Triangle < TriangleCount; Triangle++)
+            {
+                if (Kept[Triangle])
+                    continue;
+
+                V3 Corners[3];
+                bool CornerInside = false;
+                for (int Corner = 0; Corner < 3; Corner++)
+                {
+                    Corners[Corner] = HMM_MultiplyMat4ByVec4(Transform, HMM_Vec4v(Vertices[Indices[Triangle * 3 + Corner]].Position, 1.0f)).XYZ;
+                    bool Inside = true;
+                    for (int Plane = 0; Plane < 6 && Inside; Plane++)
+                        Inside = HMM_DotVec3(Camera.Planes[Plane].XYZ, Corners[Corner]) - Camera.Planes[Plane].W >= 0.0f;
+                    CornerInside |= Inside;
+                }
+                if (!CornerInside)
+                    continue;
+
+                V3 Normal = HMM_Cross(HMM_SubtractVec3(Corners[1], Corners[0]), HMM_SubtractVec3(Corners[2], Corners[0]));
+                if (HMM_DotVec3(Normal, HMM_SubtractVec3(Camera.Position, Corners[0])) > 0.0f)
+                    Dropped++;
+            }
+        }
+
+        LogInfo("  yaw %5.1f | %.3fms (%.1f ns/meshlet) | frustum culled %.1f%%, cone culled %.1f%% | %u of %llu triangles kept (%.1f%%) | %u visible triangles dropped",
+                Yaw, CullMs, (CullMs * 1'000'000.0) / Stats.Meshlets,
+                100.0f * Stats.FrustumCulled / Stats.Meshlets, 100.0f * Stats.ConeCulled / Stats.Meshlets,
+                Stats.Triangles, (unsigned long long)TotalTriangles, 100.0 * Stats.Triangles / TotalTriangles, Dropped);
+        if (Dropped)
+        {
+            LogError("Meshlet Culling Benchmark: yaw %.1f dropped %u triangles facing the camera inside the frustum!", Yaw, Dropped);
+            Failures++;
+        }
+    }
+
+    LogInfo("Meshlet Culling Benchmark: %s", Failures ? "FAIL" : "PASS");
+    return Failures;
+}
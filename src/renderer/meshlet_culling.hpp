@@ -0,0 +1,31 @@
+/**
+ *  Author: Amélie Heinrich
+ *  Company: Amélie Games
+ *  License: MIT
+ *  Create Time: 17/10/2026 18:05
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "math_types.hpp"
+#include "renderer/meshlet.hpp"
+
+struct meshlet_cull_stats
+{
+    uint32_t Meshlets;
+    uint32_t FrustumCulled;
+    uint32_t ConeCulled;
+    uint32_t Triangles;
+};
+
+// NOTE(amelie.h): CPU reference for meshlet culling. Planes are the six world space planes of noclip_camera, normals
+// pointing inside and W the distance along the normal. Surviving triangles are appended to Indices as indices into the
+// mesh vertex buffer. The backface cone test is skipped for non uniformly scaled transforms, where it isn't conservative.
+// Returns the number of visible meshlets.
+uint32_t MeshletCull(const meshlet_data *Data, hmm_mat4 Transform, const V4 *Planes, V3 CameraPosition, std::vector<uint32_t>& Indices, meshlet_cull_stats *Stats);
+
+// NOTE(amelie.h): Returns how many views dropped a triangle that faces the camera inside the frustum.
+uint32_t MeshletCullBenchmark();
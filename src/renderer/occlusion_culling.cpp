@@ -0,0 +1,490 @@
+/**
+ *  Author: Amélie Heinrich
+ *  Company: Amélie Games
+ *  License: MIT
+ *  Create Time: 17/10/2026 18:25
+ */
+
+#include "occlusion_culling.hpp"
+
+#include "timer.hpp"
+#include "cameras/noclip_camera.hpp"
+#include "systems/log_system.hpp"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstring>
+#include <random>
+
+#ifdef HANDMADE_MATH__USE_SSE
+    #include <immintrin.h>
+#endif
+
+struct occlusion_vertex
+{
+    float X;
+    float Y;
+    float Z;
+};
+
+void OcclusionBegin(occlusion_buffer *Buffer, hmm_mat4 View, hmm_mat4 Projection)
+{
+    Buffer->ViewProjection = HMM_MultiplyMat4(Projection, View);
+    Buffer->ProjectionScale = Projection.Elements[1][1];
+    Buffer->Stats = {};
+    for (int Level = 0; Level < OCCLUSION_LEVELS; Level++)
+        Buffer->Levels[Level].assign((OCCLUSION_WIDTH >> Level) * (OCCLUSION_HEIGHT >> Level), 0.0f);
+}
+
+bool OcclusionIsOccluder(const occlusion_buffer *Buffer, bounding_sphere Sphere)
+{
+    float W = HMM_MultiplyMat4ByVec4(Buffer->ViewProjection, HMM_Vec4v(Sphere.Center, 1.0f)).W;
+    if (W <= Sphere.Radius)
+        return true;
+    return Sphere.Radius * Buffer->ProjectionScale * OCCLUSION_HEIGHT * 0.5f / W >= OCCLUSION_OCCLUDER_MIN_PIXELS;
+}
+
+occlusion_vertex OcclusionProject(V4 Clip)
+{
+    float InverseW = 1.0f / Clip.W;
+    return { (Clip.X * InverseW * 0.5f + 0.5f) * OCCLUSION_WIDTH, (0.5f - Clip.Y * InverseW * 0.5f) * OCCLUSION_HEIGHT, InverseW };
+}
+
+// NOTE(amelie.h): Triangle setup shared by both paths. The edge functions are positive inside whatever the winding,
+// occluders are rasterized two sided since the nearest surface wins anyway.
+struct occlusion_triangle
+{
+    float EdgeA[3];
+    float EdgeB[3];
+    float EdgeC[3];
+    float DepthA;
+    float DepthB;
+    float DepthC;
+    int MinX;
+    int MaxX;
+    int MinY;
+    int MaxY;
+};
+
+bool OcclusionSetupTriangle(occlusion_triangle *Out, occlusion_vertex V0, occlusion_vertex V1, occlusion_vertex V2)
+{
+    float Area = (V1.X - V0.X) * (V2.Y - V0.Y) - (V2.X - V0.X) * (V1.Y - V0.Y);
+    if (fabsf(Area) < 1e-6f)
+        return false;
+    if (Area < 0.0f)
+    {
+        std::swap(V1, V2);
+        Area = -Area;
+    }
+
+    Out->MinX = std::max(0, (int)floorf(std::min(V0.X, std::min(V1.X, V2.X))));
+    Out->MaxX = std::min(OCCLUSION_WIDTH - 1, (int)ceilf(std::max(V0.X, std::max(V1.X, V2.X))));
+    Out->MinY = std::max(0, (int)floorf(std::min(V0.Y, std::min(V1.Y, V2.Y))));
+    Out->MaxY = std::min(OCCLUSION_HEIGHT - 1, (int)ceilf(std::max(V0.Y, std::max(V1.Y, V2.Y))));
+    if (Out->MinX > Out->MaxX || Out->MinY > Out->MaxY)
+        return false;
+    Out->MinX &= ~3;
+
+    const occlusion_vertex *Vertices[3] = { &V0, &V1, &V2 };
+    for (int Edge = 0; Edge < 3; Edge++)
+    {
+        const occlusion_vertex *From = Vertices[Edge];
+        const occlusion_vertex *To = Vertices[(Edge + 1) % 3];
+        Out->EdgeA[Edge] = From->Y - To->Y;
+        Out->EdgeB[Edge] = To->X - From->X;
+        Out->EdgeC[Edge] = -Out->EdgeA[Edge] * From->X - Out->EdgeB[Edge] * From->Y;
+    }
+
+    Out->DepthA = ((V1.Z - V0.Z) * (V2.Y - V0.Y) - (V2.Z - V0.Z) * (V1.Y - V0.Y)) / Area;
+    Out->DepthB = ((V2.Z - V0.Z) * (V1.X - V0.X) - (V1.Z - V0.Z) * (V2.X - V0.X)) / Area;
+    Out->DepthC = V0.Z - Out->DepthA * V0.X - Out->DepthB * V0.Y;
+
+    // NOTE(amelie.h): Inner conservative rasterization. Edges and depth are evaluated at the pixel center but pulled back
+    // by their largest change within half a pixel, so a pixel is only written when the triangle covers all of it, with
+    // the farthest depth the triangle reaches inside it.
+    for (int Edge = 0; Edge < 3; Edge++)
+        Out->EdgeC[Edge] -= 0.5f * (fabsf(Out->EdgeA[Edge]) + fabsf(Out->EdgeB[Edge]));
+    Out->DepthC -= 0.5f * (fabsf(Out->DepthA) + fabsf(Out->DepthB));
+    return true;
+}
+
+void OcclusionRasterizeScalar(float *Depth, const occlusion_triangle *Triangle)
+{
+    for (int Y = Triangle->MinY; Y <= Triangle->MaxY; Y++)
+    {
+        float PixelY = Y + 0.5f;
+        float Row[3];
+        for (int Edge = 0; Edge < 3; Edge++)
+            Row[Edge] = Triangle->EdgeB[Edge] * PixelY + Triangle->EdgeC[Edge];
+        float RowDepth = Triangle->DepthB * PixelY + Triangle->DepthC;
+
+        float *Pixels = Depth + Y * OCCLUSION_WIDTH;
+        for (int X = Triangle->MinX; X <= Triangle->MaxX; X++)
+        {
+            float PixelX = X + 0.5f;
+            if (Triangle->EdgeA[0] * PixelX + Row[0] > 0.0f && Triangle->EdgeA[1] * PixelX + Row[1] > 0.0f && Triangle->EdgeA[2] * PixelX + Row[2] > 0.0f)
+                Pixels[X] = std::max(Pixels[X], Triangle->DepthA * PixelX + RowDepth);
+        }
+    }
+}
+
+#ifdef HANDMADE_MATH__USE_SSE
+
+void OcclusionRasterizeSSE(float *Depth, const occlusion_triangle *Triangle)
+{
+    __m128 Zero = _mm_setzero_ps();
+    __m128 Offsets = _mm_setr_ps(0.5f, 1.5f, 2.5f, 3.5f);
+    __m128 EdgeA0 = _mm_set1_ps(Triangle->EdgeA[0]);
+    __m128 EdgeA1 = _mm_set1_ps(Triangle->EdgeA[1]);
+    __m128 EdgeA2 = _mm_set1_ps(Triangle->EdgeA[2]);
+    __m128 DepthA = _mm_set1_ps(Triangle->DepthA);
+
+    for (int Y = Triangle->MinY; Y <= Triangle->MaxY; Y++)
+    {
+        float PixelY = Y + 0.5f;
+        __m128 Row0 = _mm_set1_ps(Triangle->EdgeB[0] * PixelY + Triangle->EdgeC[0]);
+        __m128 Row1 = _mm_set1_ps(Triangle->EdgeB[1] * PixelY + Triangle->EdgeC[1]);
+        __m128 Row2 = _mm_set1_ps(Triangle->EdgeB[2] * PixelY + Triangle->EdgeC[2]);
+        __m128 RowDepth = _mm_set1_ps(Triangle->DepthB * PixelY + Triangle->DepthC);
+
+        // NOTE(amelie.h): MinX is aligned to 4 and the width is a multiple of 4, so a block never leaves the row.
+        float *Pixels = Depth + Y * OCCLUSION_WIDTH;
+        for (int X = Triangle->MinX; X <= Triangle->MaxX; X += 4)
+        {
+            __m128 PixelX = _mm_add_ps(_mm_set1_ps((float)X), Offsets);
+            __m128 Inside = _mm_cmpgt_ps(_mm_add_ps(_mm_mul_ps(EdgeA0, PixelX), Row0), Zero);
+            Inside = _mm_and_ps(Inside, _mm_cmpgt_ps(_mm_add_ps(_mm_mul_ps(EdgeA1, PixelX), Row1), Zero));
+            Inside = _mm_and_ps(Inside, _mm_cmpgt_ps(_mm_add_ps(_mm_mul_ps(EdgeA2, PixelX), Row2), Zero));
+            if (!_mm_movemask_ps(Inside))
+                continue;
+
+            __m128 Old = _mm_loadu_ps(Pixels + X);
+            __m128 New = _mm_max_ps(Old, _mm_add_ps(_mm_mul_ps(DepthA, PixelX), RowDepth));
+            _mm_storeu_ps(Pixels + X, _mm_or_ps(_mm_and_ps(Inside, New), _mm_andnot_ps(Inside, Old)));
+        }
+    }
+}
+
+#endif
+
+void OcclusionRasterizeTriangle(occlusion_buffer *Buffer, occlusion_vertex V0, occlusion_vertex V1, occlusion_vertex V2, cull_path Path)
+{
+    occlusion_triangle Triangle;
+    if (!OcclusionSetupTriangle(&Triangle, V0, V1, V2))
+        return;
+
+    Buffer->Stats.Triangles++;
+#ifdef HANDMADE_MATH__USE_SSE
+    if (Path != cull_path::Scalar)
+    {
+        OcclusionRasterizeSSE(Buffer->Levels[0].data(), &Triangle);
+        return;
+    }
+#endif
+    OcclusionRasterizeScalar(Buffer->Levels[0].data(), &Triangle);
+}
+
+void OcclusionRasterize(occlusion_buffer *Buffer, const mesh_occluder *Occluder, hmm_mat4 Transform, cull_path Path)
+{
+    hmm_mat4 Matrix = HMM_MultiplyMat4(Buffer->ViewProjection, Transform);
+    Buffer->Clip.resize(Occluder->Positions.size());
+    for (size_t Vertex = 0; Vertex < Occluder->Positions.size(); Vertex++)
+        Buffer->Clip[Vertex] = HMM_MultiplyMat4ByVec4(Matrix, HMM_Vec4v(Occluder->Positions[Vertex], 1.0f));
+
+    Buffer->Stats.Occluders++;
+    for (size_t Index = 0; Index + 2 < Occluder->Indices.size(); Index += 3)
+    {
+        V4 Corners[3] = { Buffer->Clip[Occluder->Indices[Index]], Buffer->Clip[Occluder->Indices[Index + 1]], Buffer->Clip[Occluder->Indices[Index + 2]] };
+
+        // NOTE(amelie.h): Trivial reject against the side planes, then clip against the near plane (z = -w with HMM_Perspective).
+        bool Outside = false;
+        for (int Axis = 0; Axis < 2 && !Outside; Axis++)
+        {
+            Outside |= Corners[0].Elements[Axis] > Corners[0].W && Corners[1].Elements[Axis] > Corners[1].W && Corners[2].Elements[Axis] > Corners[2].W;
+            Outside |= Corners[0].Elements[Axis] < -Corners[0].W && Corners[1].Elements[Axis] < -Corners[1].W && Corners[2].Elements[Axis] < -Corners[2].W;
+        }
+        if (Outside)
+            continue;
+
+        float Distances[3];
+        int InsideCount = 0;
+        for (int Corner = 0; Corner < 3; Corner++)
+        {
+            Distances[Corner] = Corners[Corner].Z + Corners[Corner].W;
+            InsideCount += Distances[Corner] >= 0.0f;
+        }
+        if (InsideCount == 3)
+        {
+            OcclusionRasterizeTriangle(Buffer, OcclusionProject(Corners[0]), OcclusionProject(Corners[1]), OcclusionProject(Corners[2]), Path);
+            continue;
+        }
+        if (InsideCount == 0)
+            continue;
+
+        V4 Polygon[4];
+        int PolygonCount = 0;
+        for (int Corner = 0; Corner < 3; Corner++)
+        {
+            int Next = (Corner + 1) % 3;
+            if (Distances[Corner] >= 0.0f)
+                Polygon[PolygonCount++] = Corners[Corner];
+            if ((Distances[Corner] >= 0.0f) != (Distances[Next] >= 0.0f))
+            {
+                float T = Distances[Corner] / (Distances[Corner] - Distances[Next]);
+                Polygon[PolygonCount++] = HMM_AddVec4(Corners[Corner], HMM_MultiplyVec4f(HMM_SubtractVec4(Corners[Next], Corners[Corner]), T));
+            }
+        }
+        for (int Fan = 1; Fan + 1 < PolygonCount; Fan++)
+            OcclusionRasterizeTriangle(Buffer, OcclusionProject(Polygon[0]), OcclusionProject(Polygon[Fan]), OcclusionProject(Polygon[Fan + 1]), Path);
+    }
+}
+
+void OcclusionFinish(occlusion_buffer *Buffer)
+{
+    for (int Level = 1; Level < OCCLUSION_LEVELS; Level++)
+    {
+        int Width = OCCLUSION_WIDTH >> Level;
+        int Height = OCCLUSION_HEIGHT >> Level;
+        const float *Source = Buffer->Levels[Level - 1].data();
+        float *Destination = Buffer->Levels[Level].data();
+        for (int Y = 0; Y < Height; Y++)
+        {
+            const float *Top = Source + (Y * 2) * Width * 2;
+            const float *Bottom = Top + Width * 2;
+            for (int X = 0; X < Width; X++)
+                Destination[Y * Width + X] = std::min(std::min(Top[X * 2], Top[X * 2 + 1]), std::min(Bottom[X * 2], Bottom[X * 2 + 1]));
+        }
+    }
+}
+
+bool OcclusionTestBox(occlusion_buffer *Buffer, aabb Box)
+{
+    Buffer->Stats.Tested++;
+
+    float MinX = FLT_MAX, MinY = FLT_MAX, MaxX = -FLT_MAX, MaxY = -FLT_MAX;
+    float Nearest = 0.0f;
+    for (int Corner = 0; Corner < 8; Corner++)
+    {
+        V3 Position = HMM_Vec3(Corner & 1 ? Box.Max.X : Box.Min.X, Corner & 2 ? Box.Max.Y : Box.Min.Y, Corner & 4 ? Box.Max.Z : Box.Min.Z);
+        V4 Clip = HMM_MultiplyMat4ByVec4(Buffer->ViewProjection, HMM_Vec4v(Position, 1.0f));
+        if (Clip.Z < -Clip.W)
+            return true;
+
+        occlusion_vertex Projected = OcclusionProject(Clip);
+        MinX = std::min(MinX, Projected.X);
+        MaxX = std::max(MaxX, Projected.X);
+        MinY = std::min(MinY, Projected.Y);
+        MaxY = std::max(MaxY, Projected.Y);
+        Nearest = std::max(Nearest, Projected.Z);
+    }
+    if (MaxX < 0.0f || MaxY < 0.0f || MinX >= OCCLUSION_WIDTH || MinY >= OCCLUSION_HEIGHT)
+        return true;
+
+    // NOTE(amelie.h): Occluders only write pixels they fully cover, so every pixel the rectangle touches is enough.
+    int X0 = std::clamp((int)floorf(MinX), 0, OCCLUSION_WIDTH - 1);
+    int X1 = std::clamp((int)floorf(MaxX), 0, OCCLUSION_WIDTH - 1);
+    int Y0 = std::clamp((int)floorf(MinY), 0, OCCLUSION_HEIGHT - 1);
+    int Y1 = std::clamp((int)floorf(MaxY), 0, OCCLUSION_HEIGHT - 1);
+
+    // NOTE(amelie.h): Go up the hierarchy until the rectangle spans at most 4x4 texels.
+    int Level = 0;
+    while (Level < OCCLUSION_LEVELS - 1 && ((X1 >> Level) - (X0 >> Level) > 3 || (Y1 >> Level) - (Y0 >> Level) > 3))
+        Level++;
+
+    int Width = OCCLUSION_WIDTH >> Level;
+    const float *Depth = Buffer->Levels[Level].data();
+    for (int Y = Y0 >> Level; Y <= Y1 >> Level; Y++)
+        for (int X = X0 >> Level; X <= X1 >> Level; X++)
+            if (Depth[Y * Width + X] <= Nearest)
+                return true;
+
+    Buffer->Stats.Occluded++;
+    return false;
+}
+
+bool OcclusionRayHitsBox(V3 Origin, V3 Target, aabb Box)
+{
+    float Near = 0.0f;
+    float Far = 1.0f;
+    for (int Axis = 0; Axis < 3; Axis++)
+    {
+        float Direction = Target.Elements[Axis] - Origin.Elements[Axis];
+        if (fabsf(Direction) < 1e-8f)
+        {
+            if (Origin.Elements[Axis] < Box.Min.Elements[Axis] || Origin.Elements[Axis] > Box.Max.Elements[Axis])
+                return false;
+            continue;
+        }
+        float A = (Box.Min.Elements[Axis] - Origin.Elements[Axis]) / Direction;
+        float B = (Box.Max.Elements[Axis] - Origin.Elements[Axis]) / Direction;
+        Near = std::max(Near, std::min(A, B));
+        Far = std::min(Far, std::max(A, B));
+    }
+    return Near <= Far;
+}
+
+uint32_t OcclusionBenchmark()
+{
+    const int Rooms = 8;
+    const float RoomSize = 10.0f;
+    const float WallHeight = 3.0f;
+    const float WallThickness = 0.2f;
+    const float DoorWidth = 1.5f;
+    const uint32_t ObjectCount = 20'000;
+    const uint32_t Iterations = 20;
+    const char *SimdName = CullGetBestPath() == cull_path::Scalar ? "scalar" : "SSE";
+
+    // NOTE(amelie.h): A grid of rooms joined by doorways, every wall is two boxes with a gap between them.
+    std::vector<aabb> Walls;
+    float HalfDoor = DoorWidth * 0.5f;
+    float HalfWall = WallThickness * 0.5f;
+    for (int Line = 0; Line <= Rooms; Line++)
+    {
+        for (int Cell = 0; Cell < Rooms; Cell++)
+        {
+            float Along = Line * RoomSize;
+            float Start = Cell * RoomSize;
+            float Middle = Start + RoomSize * 0.5f;
+            bool Door = Line > 0 && Line < Rooms;
+            float Ends[2][2] = { { Start, Door ? Middle - HalfDoor : Start + RoomSize }, { Middle + HalfDoor, Start + RoomSize } };
+            for (int Segment = 0; Segment < (Door ? 2 : 1); Segment++)
+            {
+                Walls.push_back({ HMM_Vec3(Along - HalfWall, 0.0f, Ends[Segment][0]), HMM_Vec3(Along + HalfWall, WallHeight, Ends[Segment][1]) });
+                Walls.push_back({ HMM_Vec3(Ends[Segment][0], 0.0f, Along - HalfWall), HMM_Vec3(Ends[Segment][1], WallHeight, Along + HalfWall) });
+            }
+        }
+    }
+
+    mesh_occluder Occluder;
+    const uint32_t BoxIndices[] = { 0, 1, 3, 0, 3, 2, 4, 6, 7, 4, 7, 5, 0, 4, 5, 0, 5, 1, 2, 3, 7, 2, 7, 6, 0, 2, 6, 0, 6, 4, 1, 5, 7, 1, 7, 3 };
+    for (auto& Wall : Walls)
+    {
+        uint32_t Base = (uint32_t)Occluder.Positions.size();
+        for (int Corner = 0; Corner < 8; Corner++)
+            Occluder.Positions.push_back(HMM_Vec3(Corner & 1 ? Wall.Max.X : Wall.Min.X, Corner & 2 ? Wall.Max.Y : Wall.Min.Y, Corner & 4 ? Wall.Max.Z : Wall.Min.Z));
+        for (uint32_t Index : BoxIndices)
+            Occluder.Indices.push_back(Base + Index);
+    }
+
+    std::mt19937 Random(1234);
+    std::uniform_real_distribution<float> Position(0.0f, Rooms * RoomSize);
+    std::uniform_real_distribution<float> Height(0.0f, 2.0f);
+    std::uniform_real_distribution<float> Size(0.1f, 0.5f);
+    std::vector<aabb> Objects(ObjectCount);
+    for (auto& Object : Objects)
+    {
+        V3 Center = HMM_Vec3(Position(Random), Height(Random), Position(Random));
+        V3 Extent = HMM_Vec3(Size(Random), Size(Random), Size(Random));
+        Object = { HMM_SubtractVec3(Center, Extent), HMM_AddVec3(Center, Extent) };
+    }
+
+    cull_bounds Bounds;
+    CullBoundsResize(&Bounds, ObjectCount);
+    for (uint32_t Index = 0; Index < ObjectCount; Index++)
+    {
+        V3 Center = HMM_MultiplyVec3f(HMM_AddVec3(Objects[Index].Min, Objects[Index].Max), 0.5f);
+        CullBoundsSet(&Bounds, Index, { Center, HMM_LengthVec3(HMM_SubtractVec3(Objects[Index].Max, Center)) }, Objects[Index]);
+    }
+    std::vector<uint32_t> Visible(ObjectCount);
+
+    LogInfo("Occlusion Benchmark: %zu wall triangles, %u objects, %dx%d depth buffer with %d levels",
+            Occluder.Indices.size() / 3, ObjectCount, OCCLUSION_WIDTH, OCCLUSION_HEIGHT, OCCLUSION_LEVELS);
+
+    noclip_camera Camera = {};
+    Camera.Width = 1280.0f;
+    Camera.Height = 720.0f;
+    Camera.WorldUp = HMM_Vec3(0.0f, 1.0f, 0.0f);
+
+    occlusion_buffer Buffer;
+    occlusion_buffer Reference;
+    uint32_t Failures = 0;
+    const float Yaws[] = { 0.0f, 30.0f, 45.0f, 90.0f };
+    for (float Yaw : Yaws)
+    {
+        Camera.Position = HMM_Vec3(RoomSize * 0.5f, 1.5f, RoomSize * 0.5f);
+        Camera.Front = HMM_Vec3(cosf(HMM_ToRadians(Yaw)), 0.0f, sinf(HMM_ToRadians(Yaw)));
+        Camera.Right = HMM_NormalizeVec3(HMM_Cross(Camera.Front, Camera.WorldUp));
+        Camera.Up = HMM_Cross(Camera.Right, Camera.Front);
+        NoClipCameraUpdateFrustum(&Camera);
+        Camera.View = HMM_LookAt(Camera.Position, HMM_AddVec3(Camera.Position, Camera.Front), Camera.WorldUp);
+        Camera.Projection = HMM_Perspective(75.0f, Camera.Width / Camera.Height, 0.001f, 10000.0f);
+        uint32_t FrustumVisible = CullFrustum(&Bounds, Camera.Planes, Visible.data());
+
+        // NOTE(amelie.h): Scalar reference first, the SIMD path has to produce the exact same depth buffer.
+        OcclusionBegin(&Reference, Camera.View, Camera.Projection);
+        OcclusionRasterize(&Reference, &Occluder, HMM_Mat4d(1.0f), cull_path::Scalar);
+        OcclusionFinish(&Reference);
+
+        double RasterMs[2] = {};
+        timer Timer;
+        TimerInit(&Timer);
+        for (cull_path Path : { cull_path::Scalar, CullGetBestPath() })
+        {
+            TimerRestart(&Timer);
+            for (uint32_t Iteration = 0; Iteration < Iterations; Iteration++)
+            {
+                OcclusionBegin(&Buffer, Camera.View, Camera.Projection);
+                OcclusionRasterize(&Buffer, &Occluder, HMM_Mat4d(1.0f), Path);
+            }
+            RasterMs[Path != cull_path::Scalar] = NanosecondsToMilliseconds(TimerGetElapsedNanoseconds(&Timer)) / Iterations;
+        }
+        bool Match = memcmp(Buffer.Levels[0].data(), Reference.Levels[0].data(), Buffer.Levels[0].size() * sizeof(float)) == 0;
+
+        TimerRestart(&Timer);
+        OcclusionFinish(&Buffer);
+        double FinishMs = NanosecondsToMilliseconds(TimerGetElapsedNanoseconds(&Timer));
+
+        std::vector<uint32_t> Survivors;
+        TimerRestart(&Timer);
+        for (uint32_t Index = 0; Index < FrustumVisible; Index++)
+            if (OcclusionTestBox(&Buffer, Objects[Visible[Index]]))
+                Survivors.push_back(Visible[Index]);
+        double TestMs = NanosecondsToMilliseconds(TimerGetElapsedNanoseconds(&Timer));
+
+        // NOTE(amelie.h): Every corner and the center of a culled object must be off screen or behind a wall, rays are exact here.
+        uint32_t FalseOcclusions = 0;
+        size_t Survivor = 0;
+        for (uint32_t Index = 0; Index < FrustumVisible; Index++)
+        {
+            if (Survivor < Survivors.size() && Survivors[Survivor] == Visible[Index])
+            {
+                Survivor++;
+                continue;
+            }
+
+            const aabb& Object = Objects[Visible[Index]];
+            for (int Sample = 0; Sample < 9; Sample++)
+            {
+                V3 Point = Sample == 8 ? HMM_MultiplyVec3f(HMM_AddVec3(Object.Min, Object.Max), 0.5f)
+                                       : HMM_Vec3(Sample & 1 ? Object.Max.X : Object.Min.X, Sample & 2 ? Object.Max.Y : Object.Min.Y, Sample & 4 ? Object.Max.Z : Object.Min.Z);
+                V4 Clip = HMM_MultiplyMat4ByVec4(Buffer.ViewProjection, HMM_Vec4v(Point, 1.0f));
+                if (fabsf(Clip.X) > Clip.W || fabsf(Clip.Y) > Clip.W)
+                    continue;
+
+                bool Blocked = false;
+                for (size_t Wall = 0; Wall < Walls.size() && !Blocked; Wall++)
+                    Blocked = OcclusionRayHitsBox(Camera.Position, Point, Walls[Wall]);
+                if (!Blocked)
+                {
+                    FalseOcclusions++;
+                    break;
+                }
+            }
+        }
+
+        LogInfo("  yaw %4.1f | raster %.3fms scalar, %.3fms %s (%.2fx, %u triangles, %s) | hierarchy %.3fms | test %.3fms (%.1f ns/box)",
+                Yaw, RasterMs[0], RasterMs[1], SimdName, RasterMs[0] / RasterMs[1], Buffer.Stats.Triangles,
+                Match ? "identical" : "MISMATCH", FinishMs, TestMs, (TestMs * 1'000'000.0) / std::max(FrustumVisible, 1u));
+        LogInfo("           | %u in frustum, %u occluded (%.1f%%), %zu drawn | %u false occlusions",
+                FrustumVisible, Buffer.Stats.Occluded, 100.0f * Buffer.Stats.Occluded / std::max(FrustumVisible, 1u), Survivors.size(), FalseOcclusions);
+        if (FalseOcclusions || !Match)
+        {
+            LogError("Occlusion Benchmark: yaw %.1f culled %u visible objects%s!", Yaw, FalseOcclusions, Match ? "" : " and the SIMD depth buffer differs");
+            Failures++;
+        }
+    }
+
+    LogInfo("Occlusion Benchmark: %s", Failures ? "FAIL" : "PASS");
+    return Failures;
+}
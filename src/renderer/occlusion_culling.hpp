@@ -0,0 +1,59 @@
+/**
+ *  Author: Amélie Heinrich
+ *  Company: Amélie Games
+ *  License: MIT
+ *  Create Time: 17/10/2026 18:25
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "math_types.hpp"
+#include "renderer/culling.hpp"
+
+#define OCCLUSION_WIDTH 256
+#define OCCLUSION_HEIGHT 128
+#define OCCLUSION_LEVELS 6
+#define OCCLUSION_OCCLUDER_MAX_ERROR 0.01f
+#define OCCLUSION_OCCLUDER_MIN_PIXELS 4.0f
+
+// NOTE(amelie.h): Object space copy of a coarse LOD, only the vertices it references. The LOD is the coarsest one whose
+// error stays under OCCLUSION_OCCLUDER_MAX_ERROR of the bounding radius, so it barely sticks out of the real surface.
+struct mesh_occluder
+{
+    std::vector<V3> Positions;
+    std::vector<uint32_t> Indices;
+};
+
+struct occlusion_stats
+{
+    uint32_t Occluders;
+    uint32_t Triangles;
+    uint32_t Tested;
+    uint32_t Occluded;
+};
+
+// NOTE(amelie.h): Depth is stored as 1/w, which interpolates linearly in screen space and doesn't care about the depth
+// range of the projection. Bigger is nearer and 0 is empty. Every level past the first keeps the smallest (farthest)
+// value of the 2x2 texels below it, so a box is hidden when its nearest point is behind every texel it covers.
+struct occlusion_buffer
+{
+    hmm_mat4 ViewProjection;
+    float ProjectionScale;
+    std::vector<float> Levels[OCCLUSION_LEVELS];
+    std::vector<V4> Clip;
+    occlusion_stats Stats;
+};
+
+void OcclusionBegin(occlusion_buffer *Buffer, hmm_mat4 View, hmm_mat4 Projection);
+// NOTE(amelie.h): Only worth rasterizing when its bounding sphere covers at least OCCLUSION_OCCLUDER_MIN_PIXELS.
+bool OcclusionIsOccluder(const occlusion_buffer *Buffer, bounding_sphere Sphere);
+void OcclusionRasterize(occlusion_buffer *Buffer, const mesh_occluder *Occluder, hmm_mat4 Transform, cull_path Path = CullGetBestPath());
+void OcclusionFinish(occlusion_buffer *Buffer);
+// NOTE(amelie.h): World space box, returns false only when it's certainly hidden. Boxes crossing the near plane are visible.
+bool OcclusionTestBox(occlusion_buffer *Buffer, aabb Box);
+
+// NOTE(amelie.h): Returns how many views culled something a ray from the camera can reach, or rasterized differently on the SIMD path.
+uint32_t OcclusionBenchmark();
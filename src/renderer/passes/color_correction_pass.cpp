@@ -13,12 +13,8 @@
 #include "systems/log_system.hpp"
 #include "systems/event_system.hpp"
 
-void ColorCorrectionPassInit(color_correction_pass *Pass, gpu_image *HDRImage)
+void ColorCorrectionPassInit(color_correction_pass *Pass)
 {
-    Pass->HDRImage = HDRImage;
-    
-    hmm_v2 Dimensions = GpuGetDimensions();
-
     ShaderLibraryPush("Color Correction", "", "", "shaders/color_correction/Compute.hlsl");
     Pass->Pipeline.Info.Shader = ShaderLibraryGet("Color Correction");
     GpuPipelineCreateCompute(&Pass->Pipeline);
@@ -29,27 +25,15 @@ void ColorCorrectionPassExit(color_correction_pass *Pass)
     GpuPipelineFree(&Pass->Pipeline);
 }
 
-void ColorCorrectionPassUpdate(color_correction_pass *Pass, gpu_buffer *Settings)
+void ColorCorrectionPassUpdate(color_correction_pass *Pass, gpu_command_buffer *Buffer, gpu_frame_allocation *Settings, gpu_image *HDRImage)
 {
-    gpu_command_buffer *Buffer = GpuGetImageCommandBuffer();
+    if (!Settings->Data)
+        return;
 
     hmm_v2 Dimensions = GpuGetDimensions();
 
-    GpuCommandBufferBegin(Buffer);
-
-    GpuCommandBufferImageBarrier(Buffer, Pass->HDRImage, gpu_image_layout::ImageLayoutStorage);
-
     GpuCommandBufferBindPipeline(Buffer, &Pass->Pipeline);
-    GpuCommandBufferBindStorageImage(Buffer, gpu_pipeline_type::Compute, Pass->HDRImage, 0);
-    GpuCommandBufferBindConstantBuffer(Buffer, gpu_pipeline_type::Compute, Settings, 1);
+    GpuCommandBufferBindStorageImage(Buffer, gpu_pipeline_type::Compute, HDRImage, 0);
+    GpuCommandBufferBindFrameAllocation(Buffer, gpu_pipeline_type::Compute, Settings, 1);
     GpuCommandBufferDispatch(Buffer, Dimensions.Width / 31, Dimensions.Height / 31, 1);
-
-    GpuCommandBufferEnd(Buffer);
-    GpuCommandBufferFlush(Buffer);
-}
-
-void ColorCorrectionPassResize(color_correction_pass *Pass, uint32_t Width, uint32_t Height, gpu_image *HDRImage)
-{
-    Pass->HDRImage = HDRImage;
-    hmm_v2 Dimensions = GpuGetDimensions();
 }
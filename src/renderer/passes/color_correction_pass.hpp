@@ -8,6 +8,7 @@
 #pragma once
 
 #include "gpu/gpu_buffer.hpp"
+#include "gpu/gpu_command_buffer.hpp"
 #include "gpu/gpu_image.hpp"
 #include "gpu/gpu_sampler.hpp"
 #include "gpu/gpu_shader.hpp"
@@ -15,11 +16,10 @@
 
 struct color_correction_pass
 {
-    gpu_image *HDRImage;
     gpu_pipeline Pipeline;
 };
 
-void ColorCorrectionPassInit(color_correction_pass *Pass, gpu_image *HDRImage);
+void ColorCorrectionPassInit(color_correction_pass *Pass);
 void ColorCorrectionPassExit(color_correction_pass *Pass);
-void ColorCorrectionPassUpdate(color_correction_pass *Pass, gpu_buffer *Settings);
-void ColorCorrectionPassResize(color_correction_pass *Pass, uint32_t Width, uint32_t Height, gpu_image *HDRImage);
\ No newline at end of file
+// NOTE(amelie.h): HDRImage has to be in storage layout.
+void ColorCorrectionPassUpdate(color_correction_pass *Pass, gpu_command_buffer *Buffer, gpu_frame_allocation *Settings, gpu_image *HDRImage);
\ No newline at end of file
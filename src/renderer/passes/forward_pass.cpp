@@ -12,98 +12,345 @@
 #include "systems/shader_system.hpp"
 #include "systems/log_system.hpp"
 #include "systems/event_system.hpp"
+#include "systems/job_system.hpp"
 
-void ForwardPassInit(forward_pass *Pass)
+#include <cstring>
+
+struct forward_constants
 {
-    GpuSamplerInit(&Pass->Sampler, gpu_texture_address::Wrap, gpu_texture_filter::Nearest);
+    hmm_mat4 View;
+    hmm_mat4 Projection;
+};
 
-    hmm_v2 Dimensions = GpuGetDimensions();
+// NOTE(amelie.h): Everything the workers need to record their share of the runs, built before they start.
+struct forward_recording
+{
+    forward_pass *Pass;
+    gpu_pipeline *Pipelines;
+    int *InstanceBindings;
+    bool Wireframe;
+    gpu_image *RenderTarget;
+    gpu_image *DepthTarget;
+    gpu_frame_allocation Constants;
+    gpu_frame_allocation InstanceBuffer;
+    gpu_frame_allocation Arguments;
+    gpu_frame_allocation Counts;
+    gpu_command_buffer **Workers;
+    uint32_t RunsPerWorker;
+};
 
-    GpuImageInit(&Pass->RenderTarget, Dimensions.Width, Dimensions.Height, gpu_image_format::RGBA16Float, gpu_image_usage::ImageUsageRenderTarget);
-    GpuImageInit(&Pass->DepthTarget, Dimensions.Width, Dimensions.Height, gpu_image_format::R32Depth, gpu_image_usage::ImageUsageDepthTarget);
+void ForwardPassCreatePipeline(gpu_pipeline *Pipeline, const char *Shader, mesh_vertex_format Format, bool Wireframe)
+{
+    Pipeline->Info.Formats.resize(1);
+    Pipeline->Info.Shader = ShaderLibraryGet(Shader);
+    Pipeline->Info.VertexAttributes = MeshVertexFormatAttributes(Format);
+    Pipeline->Info.CullMode = Wireframe ? cull_mode::None : cull_mode::Back;
+    Pipeline->Info.DepthFormat = gpu_image_format::R32Depth;
+    Pipeline->Info.Formats[0] = gpu_image_format::RGBA16Float;
+    Pipeline->Info.DepthFunc = depth_func::Less;
+    Pipeline->Info.FillMode = Wireframe ? fill_mode::Line : fill_mode::Solid;
+    Pipeline->Info.HasDepth = true;
+    Pipeline->Info.Type = gpu_pipeline_type::Graphics;
+    GpuPipelineCreateGraphics(Pipeline);
+}
+
+void ForwardPassInit(forward_pass *Pass)
+{
+    GpuSamplerInit(&Pass->Sampler, gpu_texture_address::Wrap, gpu_texture_filter::Nearest);
+    GpuFrameBufferInit(&Pass->FrameBuffer, FORWARD_PASS_FRAME_BUFFER_SIZE);
 
+    // NOTE(amelie.h): The vertex format decides the layout, compressed formats share one vertex shader that decodes them.
     ShaderLibraryPush("Forward", "shaders/forward/Vertex.hlsl", "shaders/forward/Pixel.hlsl");
     ShaderLibraryPush("Wireframe", "shaders/forward_wireframe/Vertex.hlsl", "shaders/forward_wireframe/Pixel.hlsl");
+    ShaderLibraryPush("Forward Packed", "shaders/forward_packed/Vertex.hlsl", "shaders/forward/Pixel.hlsl");
+    ShaderLibraryPush("Wireframe Packed", "shaders/forward_packed/Vertex.hlsl", "shaders/forward_wireframe/Pixel.hlsl");
 
-    Pass->Pipeline.Info.Formats.resize(1);
-    Pass->Pipeline.Info.Shader = ShaderLibraryGet("Forward");
-    Pass->Pipeline.Info.CullMode = cull_mode::Back;
-    Pass->Pipeline.Info.DepthFormat = gpu_image_format::R32Depth;
-    Pass->Pipeline.Info.Formats[0] = gpu_image_format::RGBA16Float;
-    Pass->Pipeline.Info.DepthFunc = depth_func::Less;
-    Pass->Pipeline.Info.FillMode = fill_mode::Solid;
-    Pass->Pipeline.Info.HasDepth = true;
-    Pass->Pipeline.Info.Type = gpu_pipeline_type::Graphics;
-    GpuPipelineCreateGraphics(&Pass->Pipeline);
-
-    Pass->WireframePipeline.Info.Formats.resize(1);
-    Pass->WireframePipeline.Info.Shader = ShaderLibraryGet("Wireframe");
-    Pass->WireframePipeline.Info.CullMode = cull_mode::None;
-    Pass->WireframePipeline.Info.DepthFormat = gpu_image_format::R32Depth;
-    Pass->WireframePipeline.Info.Formats[0] = gpu_image_format::RGBA16Float;
-    Pass->WireframePipeline.Info.DepthFunc = depth_func::Less;
-    Pass->WireframePipeline.Info.FillMode = fill_mode::Line;
-    Pass->WireframePipeline.Info.HasDepth = true;
-    Pass->WireframePipeline.Info.Type = gpu_pipeline_type::Graphics;
-    GpuPipelineCreateGraphics(&Pass->WireframePipeline);
-
-    ModelLoad(&Pass->Model, "assets/models/SciFiHelmet.gltf");
-    GpuBufferInit(&Pass->CameraBuffer, 256, 0, gpu_buffer_type::Uniform);
+    for (uint32_t FormatIndex = 0; FormatIndex < (uint32_t)mesh_vertex_format::Count; FormatIndex++)
+    {
+        mesh_vertex_format Format = (mesh_vertex_format)FormatIndex;
+        bool Packed = Format != mesh_vertex_format::Full;
+        ForwardPassCreatePipeline(&Pass->Pipelines[FormatIndex], Packed ? "Forward Packed" : "Forward", Format, false);
+        ForwardPassCreatePipeline(&Pass->WireframePipelines[FormatIndex], Packed ? "Wireframe Packed" : "Wireframe", Format, true);
+        Pass->InstanceBindings[FormatIndex] = GpuPipelineGetDescriptor(&Pass->Pipelines[FormatIndex], "Instances");
+        Pass->WireframeInstanceBindings[FormatIndex] = GpuPipelineGetDescriptor(&Pass->WireframePipelines[FormatIndex], "Instances");
+    }
 }
 
 void ForwardPassExit(forward_pass *Pass)
 {
     GpuSamplerFree(&Pass->Sampler);
-    ModelFree(&Pass->Model);
-    GpuBufferFree(&Pass->CameraBuffer);
-    GpuPipelineFree(&Pass->Pipeline);
-    GpuPipelineFree(&Pass->WireframePipeline);
-    GpuImageFree(&Pass->DepthTarget);
-    GpuImageFree(&Pass->RenderTarget);
+    GpuFrameBufferFree(&Pass->FrameBuffer);
+    for (uint32_t FormatIndex = 0; FormatIndex < (uint32_t)mesh_vertex_format::Count; FormatIndex++)
+    {
+        GpuPipelineFree(&Pass->Pipelines[FormatIndex]);
+        GpuPipelineFree(&Pass->WireframePipelines[FormatIndex]);
+    }
 }
 
-void ForwardPassUpdate(forward_pass *Pass, camera_data *Camera, bool Wireframe)
+void ForwardPassPushInstance(forward_pass *Pass, loaded_model *Model, hmm_mat4 Transform)
+{
+    auto Range = Pass->Ranges.find(Model);
+    if (Range == Pass->Ranges.end())
+    {
+        Range = Pass->Ranges.emplace(Model, forward_model_range{ Pass->SlotCount, (uint32_t)Pass->Materials.size() }).first;
+        Pass->SlotCount += (uint32_t)Model->Meshes.size();
+        for (mesh_material& Material : Model->Materials)
+            Pass->Materials.push_back(&Material);
+    }
+
+    for (uint32_t MeshIndex = 0; MeshIndex < Model->Meshes.size(); MeshIndex++)
+    {
+        mesh *Mesh = &Model->Meshes[MeshIndex];
+        Pass->Draws.push_back({ Model, Mesh, Transform * Mesh->Transform, Range->second.FirstSlot + MeshIndex, Range->second.FirstMaterial + Mesh->Material });
+    }
+}
+
+// NOTE(amelie.h): The big meshes that survived the frustum are drawn into the software depth buffer, then every survivor
+// is tested against it. Occluders test fine against themselves since their box is always in front of their surface.
+uint32_t ForwardPassCullOccluded(forward_pass *Pass, camera_data *Camera, uint32_t VisibleCount)
+{
+    OcclusionBegin(&Pass->Occlusion, Camera->View, Camera->Projection);
+    for (uint32_t VisibleIndex = 0; VisibleIndex < VisibleCount; VisibleIndex++)
+    {
+        uint32_t DrawIndex = Pass->Visible[VisibleIndex];
+        forward_draw& Draw = Pass->Draws[DrawIndex];
+        bounding_sphere Sphere = { HMM_Vec3(Pass->Bounds.SphereX[DrawIndex], Pass->Bounds.SphereY[DrawIndex], Pass->Bounds.SphereZ[DrawIndex]), Pass->Bounds.SphereRadius[DrawIndex] };
+        if (OcclusionIsOccluder(&Pass->Occlusion, Sphere))
+            OcclusionRasterize(&Pass->Occlusion, &Draw.Mesh->Occluder, Draw.Transform);
+    }
+    OcclusionFinish(&Pass->Occlusion);
+
+    uint32_t Kept = 0;
+    for (uint32_t VisibleIndex = 0; VisibleIndex < VisibleCount; VisibleIndex++)
+    {
+        uint32_t DrawIndex = Pass->Visible[VisibleIndex];
+        V3 Center = HMM_Vec3(Pass->Bounds.BoxX[DrawIndex], Pass->Bounds.BoxY[DrawIndex], Pass->Bounds.BoxZ[DrawIndex]);
+        V3 Extent = HMM_Vec3(Pass->Bounds.ExtentX[DrawIndex], Pass->Bounds.ExtentY[DrawIndex], Pass->Bounds.ExtentZ[DrawIndex]);
+        if (OcclusionTestBox(&Pass->Occlusion, { HMM_SubtractVec3(Center, Extent), HMM_AddVec3(Center, Extent) }))
+            Pass->Visible[Kept++] = DrawIndex;
+    }
+    return Kept;
+}
+
+// NOTE(amelie.h): Visible draws are bucketed by mesh and LOD with a counting pass, then every bucket gets a contiguous
+// range of the instance buffer. A LOD is picked when its simplification error projects to at most lod_threshold pixels.
+void ForwardPassBuildBatches(forward_pass *Pass, camera_data *Camera, uint32_t VisibleCount, float LodThreshold)
 {
     hmm_v2 Dimensions = GpuGetDimensions();
 
-    gpu_command_buffer *Buffer = GpuGetImageCommandBuffer();
+    Pass->Batches.clear();
+    Pass->BatchIndices.assign((size_t)Pass->SlotCount * MESH_MAX_LODS, UINT32_MAX);
+    Pass->VisibleBatches.resize(VisibleCount);
+    for (uint32_t VisibleIndex = 0; VisibleIndex < VisibleCount; VisibleIndex++)
+    {
+        uint32_t DrawIndex = Pass->Visible[VisibleIndex];
+        forward_draw& Draw = Pass->Draws[DrawIndex];
+        uint32_t Lod = MeshSelectLod(Draw.Mesh, Draw.Transform, Camera, Dimensions.Height, LodThreshold);
+        V3 Center = HMM_Vec3(Pass->Bounds.SphereX[DrawIndex], Pass->Bounds.SphereY[DrawIndex], Pass->Bounds.SphereZ[DrawIndex]);
+        float Depth = HMM_LengthVec3(HMM_SubtractVec3(Center, Camera->Position));
+
+        uint32_t& BatchIndex = Pass->BatchIndices[Draw.Slot * MESH_MAX_LODS + Lod];
+        if (BatchIndex == UINT32_MAX)
+        {
+            BatchIndex = (uint32_t)Pass->Batches.size();
+            hmm_mat4 Dequantize = HMM_Translate(Draw.Mesh->PositionOffset) * HMM_Scale(Draw.Mesh->PositionScale);
+            Pass->Batches.push_back({ Draw.Model, Draw.Mesh, Dequantize, Draw.Slot, Draw.Material, Lod, 0, 0, Depth });
+        }
+        forward_batch& Batch = Pass->Batches[BatchIndex];
+        Batch.InstanceCount++;
+        Batch.Depth = HMM_MIN(Batch.Depth, Depth);
+        Pass->VisibleBatches[VisibleIndex] = BatchIndex;
+    }
+
+    uint32_t Total = 0;
+    for (forward_batch& Batch : Pass->Batches)
+    {
+        Batch.FirstInstance = Total;
+        Total += Batch.InstanceCount;
+        Batch.InstanceCount = 0;
+    }
+}
+
+// NOTE(amelie.h): Every visible draw is one instance, so Transforms has room for the visible count.
+void ForwardPassWriteInstances(forward_pass *Pass, uint32_t VisibleCount, hmm_mat4 *Transforms)
+{
+    for (uint32_t VisibleIndex = 0; VisibleIndex < VisibleCount; VisibleIndex++)
+    {
+        forward_batch& Batch = Pass->Batches[Pass->VisibleBatches[VisibleIndex]];
+        Transforms[Batch.FirstInstance + Batch.InstanceCount++] = Pass->Draws[Pass->Visible[VisibleIndex]].Transform * Batch.Dequantize;
+    }
+}
+
+// NOTE(amelie.h): Command buffers don't inherit bindings, the first run recorded into one binds everything.
+void ForwardPassRecordRuns(forward_recording *Recording, gpu_command_buffer *Buffer, uint32_t Start, uint32_t End)
+{
+    forward_pass *Pass = Recording->Pass;
+    for (uint32_t RunIndex = Start; RunIndex < End; RunIndex++)
+    {
+        forward_run& Run = Pass->Runs[RunIndex];
+        forward_batch& Batch = Pass->Batches[Pass->Queue.Items[Run.First]];
+        uint32_t PipelineIndex = RenderQueueKeyPipeline(Pass->Queue.Keys[Run.First]);
+        uint32_t Changes = RunIndex == Start ? (RenderQueueChangePipeline | RenderQueueChangeMesh | RenderQueueChangeMaterial) : Run.Changes;
+
+        if (Changes & RenderQueueChangePipeline)
+        {
+            GpuCommandBufferBindPipeline(Buffer, &Recording->Pipelines[PipelineIndex]);
+            GpuCommandBufferBindFrameAllocation(Buffer, gpu_pipeline_type::Graphics, &Recording->Constants, 0);
+            GpuCommandBufferBindFrameAllocation(Buffer, gpu_pipeline_type::Graphics, &Recording->InstanceBuffer, Recording->InstanceBindings[PipelineIndex]);
+            if (!Recording->Wireframe)
+                GpuCommandBufferBindSampler(Buffer, gpu_pipeline_type::Graphics, &Pass->Sampler, 3);
+        }
+        if (Changes & RenderQueueChangeMesh)
+        {
+            GpuCommandBufferBindBuffer(Buffer, &Batch.Mesh->VertexBuffer);
+            GpuCommandBufferBindBuffer(Buffer, &Batch.Mesh->IndexBuffer);
+        }
+        if (!Recording->Wireframe && (Changes & RenderQueueChangeMaterial))
+        {
+            mesh_material *Material = Pass->Materials[Batch.Material];
+            GpuCommandBufferBindShaderResource(Buffer, gpu_pipeline_type::Graphics, &Material->Albedo, 1);
+            GpuCommandBufferBindShaderResource(Buffer, gpu_pipeline_type::Graphics, &Material->Normal, 2);
+        }
+
+        GpuCommandBufferDrawIndexedIndirect(Buffer, &Recording->Arguments, Run.First, Run.Count, &Recording->Counts, RunIndex);
+    }
+}
+
+void ForwardPassRecordWorker(void *Data, uint32_t Start, uint32_t End)
+{
+    forward_recording *Recording = (forward_recording*)Data;
+    gpu_command_buffer *Buffer = Recording->Workers[Start / Recording->RunsPerWorker];
+    hmm_v2 Dimensions = GpuGetDimensions();
 
-    GpuCommandBufferBegin(Buffer);
-    GpuCommandBufferImageBarrier(Buffer, &Pass->RenderTarget, gpu_image_layout::ImageLayoutRenderTarget);
     GpuCommandBufferSetViewport(Buffer, Dimensions.Width, Dimensions.Height, 0, 0);
-    GpuCommandBufferBindRenderTarget(Buffer, &Pass->RenderTarget, &Pass->DepthTarget);
-    GpuCommandBufferClearColor(Buffer, &Pass->RenderTarget, 0.3f, 0.2f, 0.1f, 1.0f);
-    GpuCommandBufferClearDepth(Buffer, &Pass->DepthTarget, 1.0f, 0.0f);
-    if (Wireframe)
-        GpuCommandBufferBindPipeline(Buffer, &Pass->WireframePipeline);
-    else
-        GpuCommandBufferBindPipeline(Buffer, &Pass->Pipeline);
-    GpuCommandBufferBindConstantBuffer(Buffer, gpu_pipeline_type::Graphics, &Pass->CameraBuffer, 0);
-    if (!Wireframe)
-        GpuCommandBufferBindSampler(Buffer, gpu_pipeline_type::Graphics, &Pass->Sampler, 3);
-    for (auto Mesh : Pass->Model.Meshes)
-    {
-        hmm_mat4 UploadMatrices[3] = { Camera->View, Camera->Projection, Mesh.Transform };
-        GpuBufferUpload(&Pass->CameraBuffer, UploadMatrices, sizeof(UploadMatrices));
-
-        GpuCommandBufferBindBuffer(Buffer, &Mesh.VertexBuffer);
-        GpuCommandBufferBindBuffer(Buffer, &Mesh.IndexBuffer);
-        if (!Wireframe)
-            GpuCommandBufferBindShaderResource(Buffer, gpu_pipeline_type::Graphics, &Mesh.Albedo, 1);
-        if (!Wireframe)
-            GpuCommandBufferBindShaderResource(Buffer, gpu_pipeline_type::Graphics, &Mesh.Normal, 2);
-        GpuCommandBufferDrawIndexed(Buffer, Mesh.IndexCount);
-    }
-    GpuCommandBufferEnd(Buffer);
-    GpuCommandBufferFlush(Buffer);
+    GpuCommandBufferBindRenderTarget(Buffer, Recording->RenderTarget, Recording->DepthTarget);
+    ForwardPassRecordRuns(Recording, Buffer, Start, End);
 }
 
-void ForwardPassResize(forward_pass *Pass, uint32_t Width, uint32_t Height)
+void ForwardPassUpdate(forward_pass *Pass, gpu_command_buffer *Buffer, gpu_command_buffer **Workers, uint32_t WorkerCount, camera_data *Camera, model_instance *Instances, uint32_t InstanceCount, renderer_settings *Settings, gpu_image *RenderTarget, gpu_image *DepthTarget)
 {
     hmm_v2 Dimensions = GpuGetDimensions();
+    bool Wireframe = Settings->Wireframe;
+
+    GpuCommandBufferSetViewport(Buffer, Dimensions.Width, Dimensions.Height, 0, 0);
+    GpuCommandBufferBindRenderTarget(Buffer, RenderTarget, DepthTarget);
+    GpuCommandBufferClearColor(Buffer, RenderTarget, 0.3f, 0.2f, 0.1f, 1.0f);
+    GpuCommandBufferClearDepth(Buffer, DepthTarget, 1.0f, 0.0f);
+
+    Pass->Draws.clear();
+    Pass->Materials.clear();
+    Pass->Ranges.clear();
+    Pass->SlotCount = 0;
+    for (uint32_t InstanceIndex = 0; InstanceIndex < InstanceCount; InstanceIndex++)
+        ForwardPassPushInstance(Pass, Instances[InstanceIndex].Model, Instances[InstanceIndex].Transform);
+
+    uint32_t DrawCount = (uint32_t)Pass->Draws.size();
+    CullBoundsResize(&Pass->Bounds, DrawCount);
+    Pass->Visible.resize(DrawCount);
+    for (uint32_t DrawIndex = 0; DrawIndex < DrawCount; DrawIndex++)
+    {
+        forward_draw& Draw = Pass->Draws[DrawIndex];
+        CullBoundsSet(&Pass->Bounds, DrawIndex, BoundingSphereTransform(Draw.Mesh->Bounds, Draw.Transform), AabbTransform(Draw.Mesh->Box, Draw.Transform));
+    }
+
+    // NOTE(amelie.h): Whole entities were already culled against the scene BVH, this trims the meshes of the ones kept.
+    uint32_t VisibleCount = CullFrustum(&Pass->Bounds, Camera->Planes, Pass->Visible.data());
+    if (Settings->OcclusionCulling)
+        VisibleCount = ForwardPassCullOccluded(Pass, Camera, VisibleCount);
+    ForwardPassBuildBatches(Pass, Camera, VisibleCount, Settings->LodThreshold);
+
+    // NOTE(amelie.h): The pipeline id in the key is the vertex format. Wireframe doesn't sample the material, so every
+    // batch shares material 0 there.
+    RenderQueueClear(&Pass->Queue);
+    for (uint32_t BatchIndex = 0; BatchIndex < (uint32_t)Pass->Batches.size(); BatchIndex++)
+    {
+        forward_batch& Batch = Pass->Batches[BatchIndex];
+        uint32_t Material = Wireframe ? 0 : Batch.Material;
+        RenderQueuePush(&Pass->Queue, RenderQueueMakeKey((uint32_t)Batch.Model->VertexFormat, Material, Batch.Depth, Batch.Slot), BatchIndex);
+    }
+    RenderQueueSort(&Pass->Queue);
 
-    GpuImageFree(&Pass->DepthTarget);
-    GpuImageFree(&Pass->RenderTarget);
-    GpuImageInit(&Pass->RenderTarget, Dimensions.Width, Dimensions.Height, gpu_image_format::RGBA16Float, gpu_image_usage::ImageUsageRenderTarget);
-    GpuImageInit(&Pass->DepthTarget, Dimensions.Width, Dimensions.Height, gpu_image_format::R32Depth, gpu_image_usage::ImageUsageDepthTarget);
+    forward_recording Recording = {};
+    Recording.Pass = Pass;
+    Recording.Pipelines = Wireframe ? Pass->WireframePipelines : Pass->Pipelines;
+    Recording.InstanceBindings = Wireframe ? Pass->WireframeInstanceBindings : Pass->InstanceBindings;
+    Recording.Wireframe = Wireframe;
+    Recording.RenderTarget = RenderTarget;
+    Recording.DepthTarget = DepthTarget;
+
+    uint32_t BatchCount = (uint32_t)Pass->Queue.Keys.size();
+    if (!BatchCount)
+    {
+        Pass->Stats = {};
+        return;
+    }
+
+    forward_constants Upload;
+    Upload.View = Camera->View;
+    Upload.Projection = Camera->Projection;
+    Recording.Constants = GpuFrameAllocConstant(sizeof(Upload));
+
+    // NOTE(amelie.h): Records follow the sorted queue. A run ends whenever the next batch needs new bindings, each run
+    // is one indirect call whose draw count sits at its index in Counts. Everything that scales with the visible count
+    // comes from the pass's frame buffer, sized for this frame up front.
+    uint64_t InstanceSize = (uint64_t)VisibleCount * sizeof(hmm_mat4);
+    uint64_t ArgumentSize = (uint64_t)BatchCount * sizeof(gpu_draw_indexed_arguments);
+    uint64_t CountSize = (uint64_t)BatchCount * sizeof(uint32_t);
+    GpuFrameBufferReset(&Pass->FrameBuffer, GpuFrameAlign(InstanceSize) + GpuFrameAlign(ArgumentSize) + GpuFrameAlign(CountSize));
+    Recording.InstanceBuffer = GpuFrameBufferAllocStructured(&Pass->FrameBuffer, VisibleCount, sizeof(hmm_mat4));
+    Recording.Arguments = GpuFrameBufferAllocArguments(&Pass->FrameBuffer, ArgumentSize);
+    Recording.Counts = GpuFrameBufferAllocArguments(&Pass->FrameBuffer, CountSize);
+
+    // NOTE(amelie.h): The allocators already logged what didn't fit, nothing is drawn this frame.
+    if (!Recording.InstanceBuffer.Data || !Recording.Constants.Data || !Recording.Arguments.Data || !Recording.Counts.Data)
+    {
+        Pass->Stats = {};
+        return;
+    }
+    memcpy(Recording.Constants.Data, &Upload, sizeof(Upload));
+    ForwardPassWriteInstances(Pass, VisibleCount, (hmm_mat4*)Recording.InstanceBuffer.Data);
+    gpu_draw_indexed_arguments *Records = (gpu_draw_indexed_arguments*)Recording.Arguments.Data;
+    uint32_t *RunCounts = (uint32_t*)Recording.Counts.Data;
+
+    render_queue_stats Stats = {};
+    Pass->Runs.clear();
+    for (uint32_t QueueIndex = 0; QueueIndex < BatchCount; QueueIndex++)
+    {
+        uint32_t Changes = RenderQueueGetChanges(&Pass->Queue, QueueIndex);
+        RenderQueueStatsAdd(&Stats, Changes);
+        if (Changes != RenderQueueChangeNone || Pass->Runs.empty())
+            Pass->Runs.push_back({ QueueIndex, 0, Changes });
+        Pass->Runs.back().Count++;
+
+        forward_batch& Batch = Pass->Batches[Pass->Queue.Items[QueueIndex]];
+        mesh_lod *Lod = &Batch.Mesh->Lods[Batch.Lod];
+
+        gpu_draw_indexed_arguments *Record = &Records[QueueIndex];
+        Record->DrawConstant = Batch.FirstInstance;
+        Record->IndexCount = Lod->IndexCount;
+        Record->InstanceCount = Batch.InstanceCount;
+        Record->FirstIndex = Lod->FirstIndex;
+        Record->VertexOffset = 0;
+        Record->FirstInstance = 0;
+    }
+
+    uint32_t RunCount = (uint32_t)Pass->Runs.size();
+    for (uint32_t RunIndex = 0; RunIndex < RunCount; RunIndex++)
+        RunCounts[RunIndex] = Pass->Runs[RunIndex].Count;
+
+    // NOTE(amelie.h): Every worker gets a contiguous slice of the runs, the buffers execute in order so the sort holds.
+    if (WorkerCount)
+    {
+        Recording.Workers = Workers;
+        Recording.RunsPerWorker = (RunCount + WorkerCount - 1) / WorkerCount;
+
+        job_counter Counter;
+        ParallelFor(&Counter, RunCount, Recording.RunsPerWorker, ForwardPassRecordWorker, &Recording);
+        JobSystemWait(&Counter);
+    }
+    else
+    {
+        ForwardPassRecordRuns(&Recording, Buffer, 0, RunCount);
+    }
+    Pass->Stats = Stats;
 }
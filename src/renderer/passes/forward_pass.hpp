@@ -8,28 +8,114 @@
 #pragma once
 
 #include "gpu/gpu_buffer.hpp"
+#include "gpu/gpu_command_buffer.hpp"
+#include "gpu/gpu_frame_allocator.hpp"
 #include "gpu/gpu_image.hpp"
 #include "gpu/gpu_sampler.hpp"
 #include "gpu/gpu_shader.hpp"
 #include "gpu/gpu_pipeline.hpp"
 #include "renderer/cpu_image.hpp"
+#include "renderer/culling.hpp"
+#include "renderer/occlusion_culling.hpp"
+#include "renderer/render_queue.hpp"
+#include "renderer/renderer_settings.hpp"
 
 #include "scene/scene.hpp"
 #include "renderer/mesh.hpp"
 
-struct forward_pass
+#include <unordered_map>
+
+// NOTE(amelie.h): Starting size of the pass's own frame memory, it grows to whatever the visible instances need.
+#define FORWARD_PASS_FRAME_BUFFER_SIZE (256 * 1024)
+// NOTE(amelie.h): Most worker command buffers the draw runs are split across.
+#define FORWARD_PASS_MAX_WORKERS 4
+
+// NOTE(amelie.h): One copy of a model submitted for this frame. The model is shared between copies and must stay alive
+// until the frame is recorded.
+struct model_instance
 {
-    gpu_image RenderTarget;
-    gpu_image DepthTarget;
+    loaded_model *Model;
+    hmm_mat4 Transform;
+};
 
-    gpu_buffer CameraBuffer;
-    gpu_pipeline Pipeline;
-    gpu_pipeline WireframePipeline;
+// NOTE(amelie.h): One mesh of one instance. Slot and Material number the meshes and materials of every model drawn this
+// frame, so two instances of the same model end up with the same ones.
+struct forward_draw
+{
+    loaded_model *Model;
+    mesh *Mesh;
+    hmm_mat4 Transform;
+    uint32_t Slot;
+    uint32_t Material;
+};
+
+// NOTE(amelie.h): Every visible copy of a mesh at one LOD, written as one indirect draw record. Depth is the nearest copy,
+// Dequantize maps the stored vertex positions back to object space and is folded into every instance transform.
+struct forward_batch
+{
+    loaded_model *Model;
+    mesh *Mesh;
+    hmm_mat4 Dequantize;
+    uint32_t Slot;
+    uint32_t Material;
+    uint32_t Lod;
+    uint32_t FirstInstance;
+    uint32_t InstanceCount;
+    float Depth;
+};
+
+// NOTE(amelie.h): Sorted batches sharing the same bindings, drawn by one indirect call. Changes is what its first batch
+// binds when the run doesn't start a command buffer.
+struct forward_run
+{
+    uint32_t First;
+    uint32_t Count;
+    uint32_t Changes;
+};
+
+struct forward_model_range
+{
+    uint32_t FirstSlot;
+    uint32_t FirstMaterial;
+};
+
+struct forward_pass
+{
+    // NOTE(amelie.h): One pipeline per vertex format, a frame can mix models cooked with different ones.
+    gpu_pipeline Pipelines[(uint32_t)mesh_vertex_format::Count];
+    gpu_pipeline WireframePipelines[(uint32_t)mesh_vertex_format::Count];
+    // NOTE(amelie.h): Root slot of the instance buffer in each pipeline, looked up when it is created.
+    int InstanceBindings[(uint32_t)mesh_vertex_format::Count];
+    int WireframeInstanceBindings[(uint32_t)mesh_vertex_format::Count];
     gpu_sampler Sampler;
-    loaded_model Model;
+    // NOTE(amelie.h): Instance transforms, indirect records and run counts of the frame.
+    gpu_frame_buffer FrameBuffer;
+
+    // NOTE(amelie.h): Rebuilt every frame from the submitted instances, Bounds are the world space bounds of every draw.
+    std::vector<forward_draw> Draws;
+    std::vector<mesh_material*> Materials;
+    std::unordered_map<loaded_model*, forward_model_range> Ranges;
+    uint32_t SlotCount;
+    cull_bounds Bounds;
+    std::vector<uint32_t> Visible;
+    occlusion_buffer Occlusion;
+
+    // NOTE(amelie.h): BatchIndices maps Slot * MESH_MAX_LODS + Lod to the batch drawing it, VisibleBatches the batch of
+    // every visible draw.
+    std::vector<forward_batch> Batches;
+    std::vector<uint32_t> BatchIndices;
+    std::vector<uint32_t> VisibleBatches;
+
+    // NOTE(amelie.h): Batches sorted by state, every run of batches sharing the same bindings is one indirect call. Stats
+    // is what the last recorded frame had to bind, not counting the rebinds at the start of every worker buffer.
+    render_queue Queue;
+    std::vector<forward_run> Runs;
+    render_queue_stats Stats;
 };
 
 void ForwardPassInit(forward_pass *Pass);
 void ForwardPassExit(forward_pass *Pass);
-void ForwardPassUpdate(forward_pass *Pass, camera_data *Camera, bool Wireframe);
-void ForwardPassResize(forward_pass *Pass, uint32_t Width, uint32_t Height);
+// NOTE(amelie.h): Draws the submitted Instances, copies sharing a model are drawn instanced. The targets have to be in
+// render target and depth layout. Buffer gets the clears, the draw runs are split across Workers in order when
+// there are any, they have to be begun and execute after Buffer.
+void ForwardPassUpdate(forward_pass *Pass, gpu_command_buffer *Buffer, gpu_command_buffer **Workers, uint32_t WorkerCount, camera_data *Camera, model_instance *Instances, uint32_t InstanceCount, renderer_settings *Settings, gpu_image *RenderTarget, gpu_image *DepthTarget);
@@ -13,14 +13,8 @@
 #include "systems/log_system.hpp"
 #include "systems/event_system.hpp"
 
-void TonemappingPassInit(tonemapping_pass *Pass, gpu_image *HDRImage)
+void TonemappingPassInit(tonemapping_pass *Pass)
 {
-    Pass->HDRImage = HDRImage;
-    
-    hmm_v2 Dimensions = GpuGetDimensions();
-
-    GpuImageInit(&Pass->LDRImage, Dimensions.Width, Dimensions.Height, gpu_image_format::RGBA8, gpu_image_usage::ImageUsageRenderTarget);
-
     ShaderLibraryPush("Tonemapping", "", "", "shaders/tonemapping/Compute.hlsl");
     Pass->Pipeline.Info.Shader = ShaderLibraryGet("Tonemapping");
     GpuPipelineCreateCompute(&Pass->Pipeline);
@@ -29,35 +23,18 @@ void TonemappingPassInit(tonemapping_pass *Pass, gpu_image *HDRImage)
 void TonemappingPassExit(tonemapping_pass *Pass)
 {
     GpuPipelineFree(&Pass->Pipeline);
-    GpuImageFree(&Pass->LDRImage);
 }
 
-void TonemappingPassUpdate(tonemapping_pass *Pass, gpu_buffer *Settings)
+void TonemappingPassUpdate(tonemapping_pass *Pass, gpu_command_buffer *Buffer, gpu_frame_allocation *Settings, gpu_image *HDRImage, gpu_image *LDRImage)
 {
-    gpu_command_buffer *Buffer = GpuGetImageCommandBuffer();
+    if (!Settings->Data)
+        return;
 
     hmm_v2 Dimensions = GpuGetDimensions();
 
-    GpuCommandBufferBegin(Buffer);
-
-    GpuCommandBufferImageBarrier(Buffer, Pass->HDRImage, gpu_image_layout::ImageLayoutShaderResource);
-    GpuCommandBufferImageBarrier(Buffer, &Pass->LDRImage, gpu_image_layout::ImageLayoutStorage);
-
     GpuCommandBufferBindPipeline(Buffer, &Pass->Pipeline);
-    GpuCommandBufferBindShaderResource(Buffer, gpu_pipeline_type::Compute, Pass->HDRImage, 0);
-    GpuCommandBufferBindStorageImage(Buffer, gpu_pipeline_type::Compute, &Pass->LDRImage, 1);
-    GpuCommandBufferBindConstantBuffer(Buffer, gpu_pipeline_type::Compute, Settings, 2);
+    GpuCommandBufferBindShaderResource(Buffer, gpu_pipeline_type::Compute, HDRImage, 0);
+    GpuCommandBufferBindStorageImage(Buffer, gpu_pipeline_type::Compute, LDRImage, 1);
+    GpuCommandBufferBindFrameAllocation(Buffer, gpu_pipeline_type::Compute, Settings, 2);
     GpuCommandBufferDispatch(Buffer, Dimensions.Width / 31, Dimensions.Height / 31, 1);
-
-    GpuCommandBufferEnd(Buffer);
-    GpuCommandBufferFlush(Buffer);
-}
-
-void TonemappingPassResize(tonemapping_pass *Pass, uint32_t Width, uint32_t Height, gpu_image *HDRImage)
-{
-    Pass->HDRImage = HDRImage;
-    hmm_v2 Dimensions = GpuGetDimensions();
-
-    GpuImageFree(&Pass->LDRImage);
-    GpuImageInit(&Pass->LDRImage, Dimensions.Width, Dimensions.Height, gpu_image_format::RGBA8, gpu_image_usage::ImageUsageRenderTarget);
 }
@@ -8,6 +8,7 @@
 #pragma once
 
 #include "gpu/gpu_buffer.hpp"
+#include "gpu/gpu_command_buffer.hpp"
 #include "gpu/gpu_image.hpp"
 #include "gpu/gpu_sampler.hpp"
 #include "gpu/gpu_shader.hpp"
@@ -15,13 +16,10 @@
 
 struct tonemapping_pass
 {
-    gpu_image *HDRImage;
-    gpu_image LDRImage;
-
     gpu_pipeline Pipeline;
 };
 
-void TonemappingPassInit(tonemapping_pass *Pass, gpu_image *HDRImage);
+void TonemappingPassInit(tonemapping_pass *Pass);
 void TonemappingPassExit(tonemapping_pass *Pass);
-void TonemappingPassUpdate(tonemapping_pass *Pass, gpu_buffer *Settings);
-void TonemappingPassResize(tonemapping_pass *Pass, uint32_t Width, uint32_t Height, gpu_image *HDRImage);
+// NOTE(amelie.h): HDRImage has to be in shader resource layout and LDRImage in storage layout.
+void TonemappingPassUpdate(tonemapping_pass *Pass, gpu_command_buffer *Buffer, gpu_frame_allocation *Settings, gpu_image *HDRImage, gpu_image *LDRImage);
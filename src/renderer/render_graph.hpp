@@ -0,0 +1,137 @@
+/**
+ *  Author: Amélie Heinrich
+ *  Company: Amélie Games
+ *  License: MIT
+ *  Create Time: 17/10/2026 18:40
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "gpu/gpu_command_buffer.hpp"
+#include "gpu/gpu_image.hpp"
+
+#define RENDER_GRAPH_UNUSED 0xFFFFFFFF
+
+enum class render_graph_access
+{
+    Read,
+    Write,
+    ReadWrite
+};
+
+struct render_graph;
+
+typedef void (*PFN_RenderGraphExecute)(render_graph *Graph, gpu_command_buffer *Buffer, void *Data);
+
+// NOTE(amelie.h): Transient images are owned by the graph and placed in one block of memory, images whose lifetimes
+// don't overlap can share it. Imported images belong to someone else, they enter the frame in InitialLayout and leave
+// it in FinalLayout. Between passes transients rest in CreationLayout, the layout they were created with.
+struct render_graph_resource
+{
+    const char *Name;
+    bool Imported;
+
+    uint32_t Width;
+    uint32_t Height;
+    gpu_image_format Format;
+    gpu_image_usage Usage;
+    gpu_image Transient;
+    gpu_image *Image;
+
+    gpu_image_layout CreationLayout;
+    gpu_image_layout InitialLayout;
+    gpu_image_layout FinalLayout;
+
+    // NOTE(amelie.h): Filled by RenderGraphCompile. Lifetimes are in pass indices, RENDER_GRAPH_UNUSED when no pass
+    // that survived culling touches the image.
+    uint32_t FirstPass;
+    uint32_t LastPass;
+    uint64_t Size;
+    uint64_t Alignment;
+    uint64_t Offset;
+    bool Aliased;
+};
+
+struct render_graph_pass_access
+{
+    uint32_t Resource;
+    gpu_image_layout Layout;
+    render_graph_access Access;
+};
+
+struct render_graph_barrier
+{
+    uint32_t Resource;
+    gpu_image_layout Old;
+    gpu_image_layout New;
+};
+
+struct render_graph_pass
+{
+    const char *Name;
+    PFN_RenderGraphExecute Execute;
+    void *Data;
+    // NOTE(amelie.h): Passes without side effects are culled when nothing alive reads what they write.
+    bool SideEffects;
+    bool Enabled;
+    uint32_t WorkerCount;
+    std::vector<render_graph_pass_access> Accesses;
+
+    // NOTE(amelie.h): Filled by RenderGraphCompile. Activations are transients whose memory may hold another image,
+    // they get an aliasing barrier and a discard before the Before transitions.
+    bool Alive;
+    std::vector<uint32_t> Activations;
+    std::vector<render_graph_barrier> Before;
+    std::vector<render_graph_barrier> After;
+
+    render_graph *Graph;
+    gpu_command_buffer *Buffer;
+    std::vector<gpu_command_buffer*> Workers;
+};
+
+struct render_graph
+{
+    std::vector<render_graph_resource> Resources;
+    std::vector<render_graph_pass> Passes;
+
+    uint64_t MemorySize;
+    uint64_t TransientSize;
+    gpu_memory Memory;
+    bool Realized;
+    bool Dirty;
+};
+
+void RenderGraphInit(render_graph *Graph);
+void RenderGraphFree(render_graph *Graph);
+
+uint32_t RenderGraphAddTransient(render_graph *Graph, const char *Name, uint32_t Width, uint32_t Height, gpu_image_format Format, gpu_image_usage Usage);
+uint32_t RenderGraphAddImported(render_graph *Graph, const char *Name, gpu_image_layout InitialLayout, gpu_image_layout FinalLayout);
+// NOTE(amelie.h): Imported images can change every frame, like the swap chain image.
+void RenderGraphSetImported(render_graph *Graph, uint32_t Resource, gpu_image *Image);
+gpu_image *RenderGraphGetImage(render_graph *Graph, uint32_t Resource);
+
+uint32_t RenderGraphAddPass(render_graph *Graph, const char *Name, PFN_RenderGraphExecute Execute, void *Data, bool SideEffects = false);
+void RenderGraphAddAccess(render_graph *Graph, uint32_t Pass, uint32_t Resource, gpu_image_layout Layout, render_graph_access Access);
+// NOTE(amelie.h): Marks the graph dirty when the pass flips, the next RenderGraphExecute recompiles it.
+void RenderGraphSetEnabled(render_graph *Graph, uint32_t Pass, bool Enabled);
+// NOTE(amelie.h): Hands the pass Count more command buffers in Workers, for passes that split their recording across
+// threads. They are begun before the pass executes and submitted in order right after its own buffer, the After
+// barriers go at the end of the last one. Fewer are handed out when the pool runs dry.
+void RenderGraphSetWorkers(render_graph *Graph, uint32_t Pass, uint32_t Count);
+
+// NOTE(amelie.h): Culls passes, plans the barriers and places the transients. Only queries image sizes, nothing is allocated.
+void RenderGraphCompile(render_graph *Graph);
+// NOTE(amelie.h): Allocates the memory block and places the transients in it. Waits for the GPU if it had to free old ones.
+void RenderGraphRealize(render_graph *Graph);
+// NOTE(amelie.h): Records every alive pass in parallel into its own pass command buffers and submits them in order.
+void RenderGraphExecute(render_graph *Graph);
+
+// NOTE(amelie.h): Replays the plan and checks every access sees its layout, every barrier starts where the image really
+// is, images end where they should and no two live transients share memory. Returns the number of problems found.
+uint32_t RenderGraphValidate(const render_graph *Graph);
+void RenderGraphLogPlan(const render_graph *Graph);
+// NOTE(amelie.h): Checks the planner on a synthetic frame and a deliberately broken plan. Returns the number of failures.
+uint32_t RenderGraphTest();
@@ -0,0 +1,215 @@
+/**
+ *  Author: Amélie Heinrich
+ *  Company: Amélie Games
+ *  License: MIT
+ *  Create Time: 17/10/2026 18:35
+ */
+
+#include "render_queue.hpp"
+
+#include "timer.hpp"
+#include "systems/log_system.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+#include <random>
+
+#define RENDER_QUEUE_MESH_SHIFT 0
+#define RENDER_QUEUE_DEPTH_SHIFT (RENDER_QUEUE_MESH_SHIFT + RENDER_QUEUE_MESH_BITS)
+#define RENDER_QUEUE_MATERIAL_SHIFT (RENDER_QUEUE_DEPTH_SHIFT + RENDER_QUEUE_DEPTH_BITS)
+#define RENDER_QUEUE_PIPELINE_SHIFT (RENDER_QUEUE_MATERIAL_SHIFT + RENDER_QUEUE_MATERIAL_BITS)
+
+static_assert(RENDER_QUEUE_PIPELINE_SHIFT + RENDER_QUEUE_PIPELINE_BITS == 64, "Render queue keys must fill 64 bits!");
+
+uint64_t RenderQueueMask(uint32_t Bits)
+{
+    return (1ull << Bits) - 1;
+}
+
+uint64_t RenderQueueMakeKey(uint32_t Pipeline, uint32_t Material, float Depth, uint32_t Mesh)
+{
+    // NOTE(amelie.h): Positive floats sort like their bit patterns, the top bits keep the exponent and a few mantissa
+    // bits, so close draws get fine buckets and far ones coarse ones.
+    uint32_t DepthBits = 0;
+    if (Depth > 0.0f)
+        memcpy(&DepthBits, &Depth, sizeof(DepthBits));
+    DepthBits >>= 32 - RENDER_QUEUE_DEPTH_BITS;
+
+    return ((uint64_t)Pipeline & RenderQueueMask(RENDER_QUEUE_PIPELINE_BITS)) << RENDER_QUEUE_PIPELINE_SHIFT |
+           ((uint64_t)Material & RenderQueueMask(RENDER_QUEUE_MATERIAL_BITS)) << RENDER_QUEUE_MATERIAL_SHIFT |
+           ((uint64_t)DepthBits & RenderQueueMask(RENDER_QUEUE_DEPTH_BITS)) << RENDER_QUEUE_DEPTH_SHIFT |
+           ((uint64_t)Mesh & RenderQueueMask(RENDER_QUEUE_MESH_BITS)) << RENDER_QUEUE_MESH_SHIFT;
+}
+
+uint32_t RenderQueueKeyPipeline(uint64_t Key)
+{
+    return (uint32_t)((Key >> RENDER_QUEUE_PIPELINE_SHIFT) & RenderQueueMask(RENDER_QUEUE_PIPELINE_BITS));
+}
+
+uint32_t RenderQueueKeyMaterial(uint64_t Key)
+{
+    return (uint32_t)((Key >> RENDER_QUEUE_MATERIAL_SHIFT) & RenderQueueMask(RENDER_QUEUE_MATERIAL_BITS));
+}
+
+uint32_t RenderQueueKeyMesh(uint64_t Key)
+{
+    return (uint32_t)((Key >> RENDER_QUEUE_MESH_SHIFT) & RenderQueueMask(RENDER_QUEUE_MESH_BITS));
+}
+
+void RenderQueueClear(render_queue *Queue)
+{
+    Queue->Keys.clear();
+    Queue->Items.clear();
+}
+
+void RenderQueuePush(render_queue *Queue, uint64_t Key, uint32_t Item)
+{
+    Queue->Keys.push_back(Key);
+    Queue->Items.push_back(Item);
+}
+
+void RenderQueueSort(render_queue *Queue)
+{
+    size_t Count = Queue->Keys.size();
+    if (Count < 2)
+        return;
+
+    uint32_t Histograms[8][256] = {};
+    for (uint64_t Key : Queue->Keys)
+        for (int Digit = 0; Digit < 8; Digit++)
+            Histograms[Digit][(Key >> (Digit * 8)) & 0xFF]++;
+
+    Queue->ScratchKeys.resize(Count);
+    Queue->ScratchItems.resize(Count);
+    uint64_t *SourceKeys = Queue->Keys.data();
+    uint32_t *SourceItems = Queue->Items.data();
+    uint64_t *DestinationKeys = Queue->ScratchKeys.data();
+    uint32_t *DestinationItems = Queue->ScratchItems.data();
+
+    for (int Digit = 0; Digit < 8; Digit++)
+    {
+        uint32_t *Histogram = Histograms[Digit];
+        uint32_t Shift = Digit * 8;
+        if (Histogram[(SourceKeys[0] >> Shift) & 0xFF] == Count)
+            continue;
+
+        uint32_t Offsets[256];
+        uint32_t Total = 0;
+        for (int Bucket = 0; Bucket < 256; Bucket++)
+        {
+            Offsets[Bucket] = Total;
+            Total += Histogram[Bucket];
+        }
+
+        for (size_t Index = 0; Index < Count; Index++)
+        {
+            uint32_t Slot = Offsets[(SourceKeys[Index] >> Shift) & 0xFF]++;
+            DestinationKeys[Slot] = SourceKeys[Index];
+            DestinationItems[Slot] = SourceItems[Index];
+        }
+        std::swap(SourceKeys, DestinationKeys);
+        std::swap(SourceItems, DestinationItems);
+    }
+
+    if (SourceKeys != Queue->Keys.data())
+    {
+        Queue->Keys.swap(Queue->ScratchKeys);
+        Queue->Items.swap(Queue->ScratchItems);
+    }
+}
+
+uint32_t RenderQueueGetChanges(const render_queue *Queue, uint32_t Index)
+{
+    uint64_t Key = Queue->Keys[Index];
+    if (Index == 0 || RenderQueueKeyPipeline(Key) != RenderQueueKeyPipeline(Queue->Keys[Index - 1]))
+        return RenderQueueChangePipeline | RenderQueueChangeMaterial | RenderQueueChangeMesh;
+
+    uint64_t Previous = Queue->Keys[Index - 1];
+    uint32_t Changes = RenderQueueChangeNone;
+    if (RenderQueueKeyMaterial(Key) != RenderQueueKeyMaterial(Previous))
+        Changes |= RenderQueueChangeMaterial;
+    if (RenderQueueKeyMesh(Key) != RenderQueueKeyMesh(Previous))
+        Changes |= RenderQueueChangeMesh;
+    return Changes;
+}
+
+void RenderQueueStatsAdd(render_queue_stats *Stats, uint32_t Changes)
+{
+    Stats->Draws++;
+    Stats->PipelineChanges += (Changes & RenderQueueChangePipeline) != 0;
+    Stats->MaterialChanges += (Changes & RenderQueueChangeMaterial) != 0;
+    Stats->MeshChanges += (Changes & RenderQueueChangeMesh) != 0;
+    Stats->StateChanges = Stats->PipelineChanges + Stats->MaterialChanges + Stats->MeshChanges;
+}
+
+uint32_t RenderQueueBenchmark()
+{
+    const uint32_t Counts[] = { 1'000, 10'000, 100'000 };
+    const uint32_t Pipelines = 4;
+    const uint32_t Materials = 64;
+    const uint32_t Meshes = 512;
+    const uint32_t Iterations = 20;
+
+    LogInfo("Render Queue Benchmark: %u pipelines, %u materials, %u meshes, draws submitted in random order", Pipelines, Materials, Meshes);
+
+    std::mt19937 Random(1234);
+    std::uniform_real_distribution<float> Depth(0.5f, 500.0f);
+    uint32_t Failures = 0;
+    for (uint32_t Count : Counts)
+    {
+        // NOTE(amelie.h): Every mesh keeps one material and pipeline, like a real model, and is instanced a few times.
+        render_queue Source;
+        for (uint32_t Draw = 0; Draw < Count; Draw++)
+        {
+            uint32_t Mesh = Random() % Meshes;
+            RenderQueuePush(&Source, RenderQueueMakeKey(Mesh % Pipelines, (Mesh * 7) % Materials, Depth(Random), Mesh), Draw);
+        }
+
+        render_queue_stats Unsorted = {};
+        for (uint32_t Index = 0; Index < Count; Index++)
+            RenderQueueStatsAdd(&Unsorted, RenderQueueGetChanges(&Source, Index));
+
+        render_queue Queue;
+        timer Timer;
+        TimerInit(&Timer);
+        for (uint32_t Iteration = 0; Iteration < Iterations; Iteration++)
+        {
+            Queue.Keys = Source.Keys;
+            Queue.Items = Source.Items;
+            RenderQueueSort(&Queue);
+        }
+        double RadixMs = NanosecondsToMilliseconds(TimerGetElapsedNanoseconds(&Timer)) / Iterations;
+
+        std::vector<uint32_t> Order(Count);
+        TimerRestart(&Timer);
+        for (uint32_t Iteration = 0; Iteration < Iterations; Iteration++)
+        {
+            std::iota(Order.begin(), Order.end(), 0);
+            std::stable_sort(Order.begin(), Order.end(), [&](uint32_t A, uint32_t B) { return Source.Keys[A] < Source.Keys[B]; });
+        }
+        double StdMs = NanosecondsToMilliseconds(TimerGetElapsedNanoseconds(&Timer)) / Iterations;
+
+        // NOTE(amelie.h): Both sorts are stable, so the radix sort has to land every draw on the same position.
+        uint32_t Mismatches = 0;
+        for (uint32_t Index = 0; Index < Count; Index++)
+            if (Queue.Items[Index] != Source.Items[Order[Index]])
+                Mismatches++;
+
+        render_queue_stats Sorted = {};
+        for (uint32_t Index = 0; Index < Count; Index++)
+            RenderQueueStatsAdd(&Sorted, RenderQueueGetChanges(&Queue, Index));
+
+        LogInfo("  %6u draws | radix %.3fms, std::stable_sort %.3fms (%.2fx, %s) | state changes %u -> %u (pipeline %u, material %u, mesh %u)",
+                Count, RadixMs, StdMs, StdMs / RadixMs, Mismatches ? "MISMATCH" : "same order",
+                Unsorted.StateChanges, Sorted.StateChanges, Sorted.PipelineChanges, Sorted.MaterialChanges, Sorted.MeshChanges);
+        if (Mismatches)
+        {
+            LogError("Render Queue Benchmark: Radix sort put %u of %u draws somewhere std::stable_sort didn't!", Mismatches, Count);
+            Failures++;
+        }
+    }
+
+    LogInfo("Render Queue Benchmark: %s", Failures ? "FAIL" : "PASS");
+    return Failures;
+}
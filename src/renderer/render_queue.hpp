@@ -0,0 +1,64 @@
+/**
+ *  Author: Amélie Heinrich
+ *  Company: Amélie Games
+ *  License: MIT
+ *  Create Time: 17/10/2026 18:35
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+// NOTE(amelie.h): Sort key layout, most significant first. Draws are grouped by pipeline, then material, and go front to
+// back inside a material so early depth rejection still helps. The mesh comes last so equal state stays together.
+//   63..56 pipeline | 55..36 material | 35..20 depth | 19..0 mesh
+#define RENDER_QUEUE_PIPELINE_BITS 8
+#define RENDER_QUEUE_MATERIAL_BITS 20
+#define RENDER_QUEUE_DEPTH_BITS 16
+#define RENDER_QUEUE_MESH_BITS 20
+
+enum render_queue_change
+{
+    RenderQueueChangeNone = 0,
+    RenderQueueChangePipeline = 1 << 0,
+    RenderQueueChangeMaterial = 1 << 1,
+    RenderQueueChangeMesh = 1 << 2
+};
+
+struct render_queue_stats
+{
+    uint32_t Draws;
+    uint32_t PipelineChanges;
+    uint32_t MaterialChanges;
+    uint32_t MeshChanges;
+    uint32_t StateChanges;
+};
+
+// NOTE(amelie.h): Items is whatever the pass wants back for each key, usually an index into its own draw list.
+struct render_queue
+{
+    std::vector<uint64_t> Keys;
+    std::vector<uint32_t> Items;
+
+    std::vector<uint64_t> ScratchKeys;
+    std::vector<uint32_t> ScratchItems;
+};
+
+uint64_t RenderQueueMakeKey(uint32_t Pipeline, uint32_t Material, float Depth, uint32_t Mesh);
+uint32_t RenderQueueKeyPipeline(uint64_t Key);
+uint32_t RenderQueueKeyMaterial(uint64_t Key);
+uint32_t RenderQueueKeyMesh(uint64_t Key);
+
+void RenderQueueClear(render_queue *Queue);
+void RenderQueuePush(render_queue *Queue, uint64_t Key, uint32_t Item);
+// NOTE(amelie.h): LSD radix sort on 8 bit digits, stable, digits every key shares are skipped.
+void RenderQueueSort(render_queue *Queue);
+
+// NOTE(amelie.h): What has to be bound to go from the draw at Index - 1 to the one at Index. Binding a pipeline drops
+// everything bound before it, so a pipeline change is also a material and mesh change.
+uint32_t RenderQueueGetChanges(const render_queue *Queue, uint32_t Index);
+void RenderQueueStatsAdd(render_queue_stats *Stats, uint32_t Changes);
+
+// NOTE(amelie.h): Returns how many queue sizes the radix sort ordered differently than std::stable_sort.
+uint32_t RenderQueueBenchmark();
@@ -10,10 +10,19 @@
 #include "gpu/gpu_context.hpp"
 #include "systems/event_system.hpp"
 #include "systems/input_types.hpp"
+#include "systems/job_system.hpp"
 #include "systems/shader_system.hpp"
 
+#include <algorithm>
 #include <stdlib.h>
 
+struct renderer_frame
+{
+    camera_data *Camera;
+    model_instance *Instances;
+    uint32_t InstanceCount;
+};
+
 struct renderer_data
 {
     forward_pass Forward;
@@ -21,10 +30,80 @@ struct renderer_data
     tonemapping_pass Tonemapping;
 
     renderer_settings Settings;
+    renderer_frame Frame;
+
+    // NOTE(amelie.h): Filled by RendererDrawModel between frames, the forward pass groups copies of the same model.
+    std::vector<model_instance> Instances;
+
+    render_graph Graph;
+    uint32_t HDRImage;
+    uint32_t DepthImage;
+    uint32_t LDRImage;
+    uint32_t Backbuffer;
+    uint32_t ForwardPass;
+    uint32_t ColorCorrectionPass;
 };
 
 renderer_data Renderer;
 
+void RendererRecordForward(render_graph *Graph, gpu_command_buffer *Buffer, void *Data)
+{
+    renderer_frame *Frame = (renderer_frame*)Data;
+    render_graph_pass *Pass = &Graph->Passes[Renderer.ForwardPass];
+    ForwardPassUpdate(&Renderer.Forward, Buffer, Pass->Workers.data(), (uint32_t)Pass->Workers.size(), Frame->Camera, Frame->Instances, Frame->InstanceCount, &Renderer.Settings,
+                      RenderGraphGetImage(Graph, Renderer.HDRImage), RenderGraphGetImage(Graph, Renderer.DepthImage));
+}
+
+void RendererRecordColorCorrection(render_graph *Graph, gpu_command_buffer *Buffer, void *Data)
+{
+    ColorCorrectionPassUpdate(&Renderer.ColorCorrection, Buffer, &Renderer.Settings.Allocation, RenderGraphGetImage(Graph, Renderer.HDRImage));
+}
+
+void RendererRecordTonemapping(render_graph *Graph, gpu_command_buffer *Buffer, void *Data)
+{
+    TonemappingPassUpdate(&Renderer.Tonemapping, Buffer, &Renderer.Settings.Allocation, RenderGraphGetImage(Graph, Renderer.HDRImage), RenderGraphGetImage(Graph, Renderer.LDRImage));
+}
+
+void RendererRecordBlit(render_graph *Graph, gpu_command_buffer *Buffer, void *Data)
+{
+    GpuCommandBufferBlit(Buffer, RenderGraphGetImage(Graph, Renderer.LDRImage), RenderGraphGetImage(Graph, Renderer.Backbuffer));
+}
+
+void RendererBuildGraph()
+{
+    render_graph *Graph = &Renderer.Graph;
+    hmm_v2 Dimensions = GpuGetDimensions();
+    uint32_t Width = (uint32_t)Dimensions.Width;
+    uint32_t Height = (uint32_t)Dimensions.Height;
+
+    // NOTE(amelie.h): The swap chain image comes back from presenting, which is the same state as common on D3D12.
+    // RendererStartRender picks it up in common to draw the UI on top.
+    RenderGraphFree(Graph);
+    Renderer.HDRImage = RenderGraphAddTransient(Graph, "HDR", Width, Height, gpu_image_format::RGBA16Float, gpu_image_usage::ImageUsageRenderTarget);
+    Renderer.DepthImage = RenderGraphAddTransient(Graph, "Depth", Width, Height, gpu_image_format::R32Depth, gpu_image_usage::ImageUsageDepthTarget);
+    Renderer.LDRImage = RenderGraphAddTransient(Graph, "LDR", Width, Height, gpu_image_format::RGBA8, gpu_image_usage::ImageUsageRenderTarget);
+    Renderer.Backbuffer = RenderGraphAddImported(Graph, "Backbuffer", gpu_image_layout::ImageLayoutPresent, gpu_image_layout::ImageLayoutCommon);
+
+    // NOTE(amelie.h): Splitting the draws only pays off when there is more than one thread to record them.
+    uint32_t ForwardWorkers = std::min(JobSystemThreadCount(), (uint32_t)FORWARD_PASS_MAX_WORKERS);
+    Renderer.ForwardPass = RenderGraphAddPass(Graph, "Forward", RendererRecordForward, &Renderer.Frame);
+    RenderGraphAddAccess(Graph, Renderer.ForwardPass, Renderer.HDRImage, gpu_image_layout::ImageLayoutRenderTarget, render_graph_access::Write);
+    RenderGraphAddAccess(Graph, Renderer.ForwardPass, Renderer.DepthImage, gpu_image_layout::ImageLayoutDepth, render_graph_access::Write);
+    RenderGraphSetWorkers(Graph, Renderer.ForwardPass, ForwardWorkers > 1 ? ForwardWorkers : 0);
+
+    Renderer.ColorCorrectionPass = RenderGraphAddPass(Graph, "Color Correction", RendererRecordColorCorrection, &Renderer.Frame);
+    RenderGraphAddAccess(Graph, Renderer.ColorCorrectionPass, Renderer.HDRImage, gpu_image_layout::ImageLayoutStorage, render_graph_access::ReadWrite);
+    RenderGraphSetEnabled(Graph, Renderer.ColorCorrectionPass, Renderer.Settings.EnableColorCorrection);
+
+    uint32_t Tonemapping = RenderGraphAddPass(Graph, "Tonemapping", RendererRecordTonemapping, &Renderer.Frame);
+    RenderGraphAddAccess(Graph, Tonemapping, Renderer.HDRImage, gpu_image_layout::ImageLayoutShaderResource, render_graph_access::Read);
+    RenderGraphAddAccess(Graph, Tonemapping, Renderer.LDRImage, gpu_image_layout::ImageLayoutStorage, render_graph_access::Write);
+
+    uint32_t Blit = RenderGraphAddPass(Graph, "Blit", RendererRecordBlit, &Renderer.Frame, true);
+    RenderGraphAddAccess(Graph, Blit, Renderer.LDRImage, gpu_image_layout::ImageLayoutCopySource, render_graph_access::Read);
+    RenderGraphAddAccess(Graph, Blit, Renderer.Backbuffer, gpu_image_layout::ImageLayoutCopyDest, render_graph_access::Write);
+}
+
 bool RendererOnKeyPressed(event_type Type, void *Sender, void *Listener, event_data Data)
 {   
     if (Data.data.u32[0] == (uint32_t)keyboard_key::F2)
@@ -36,24 +115,27 @@ bool RendererShaderRecompile(event_type Type, void *Sender, void *Listener, even
 {
     GpuWait();
 
-    if (Data.data.u32[0] == ShaderLibraryGetID("Forward") || Data.data.u32[0] == ShaderLibraryGetID("Wireframe"))
+    // NOTE(amelie.h): The shader system sends the library ID in u32[0], the library hands it out as an int.
+    int ShaderID = (int)Data.data.u32[0];
+    if (ShaderID == ShaderLibraryGetID("Forward") || ShaderID == ShaderLibraryGetID("Wireframe") ||
+        ShaderID == ShaderLibraryGetID("Forward Packed") || ShaderID == ShaderLibraryGetID("Wireframe Packed"))
     {
         ForwardPassExit(&Renderer.Forward);
         ForwardPassInit(&Renderer.Forward);
         return false;
     }
 
-    if (Data.data.u32[0] == ShaderLibraryGetID("Color Correction"))
+    if (ShaderID == ShaderLibraryGetID("Color Correction"))
     {
         ColorCorrectionPassExit(&Renderer.ColorCorrection);
-        ColorCorrectionPassInit(&Renderer.ColorCorrection, &Renderer.Forward.RenderTarget);
+        ColorCorrectionPassInit(&Renderer.ColorCorrection);
         return false;
     }
 
-    if (Data.data.u32[0] == ShaderLibraryGetID("Tonemapping"))
+    if (ShaderID == ShaderLibraryGetID("Tonemapping"))
     {
         TonemappingPassExit(&Renderer.Tonemapping);
-        TonemappingPassInit(&Renderer.Tonemapping, &Renderer.Forward.RenderTarget);
+        TonemappingPassInit(&Renderer.Tonemapping);
         return false;
     }
 
@@ -67,6 +149,7 @@ void RendererInit()
  
     Renderer.Settings.Wireframe = false;
     Renderer.Settings.EnableColorCorrection = true;
+    RendererSettingsLoad(&Renderer.Settings);
 
     Renderer.Settings.Settings.Tonemapper = tonemapping_algorithm::Filmic;
     Renderer.Settings.Settings.Exposure = 2.2f;
@@ -79,10 +162,12 @@ void RendererInit()
     Renderer.Settings.Settings.ColorFilterIntensity = 1.0f;
     Renderer.Settings.Settings.Saturation = HMM_Vec3(1.0f, 1.0f, 1.0f);
 
-    RendererSettingsInit(&Renderer.Settings);
     ForwardPassInit(&Renderer.Forward);
-    ColorCorrectionPassInit(&Renderer.ColorCorrection, &Renderer.Forward.RenderTarget);
-    TonemappingPassInit(&Renderer.Tonemapping, &Renderer.Forward.RenderTarget);
+    ColorCorrectionPassInit(&Renderer.ColorCorrection);
+    TonemappingPassInit(&Renderer.Tonemapping);
+
+    RenderGraphInit(&Renderer.Graph);
+    RendererBuildGraph();
 }
 
 void RendererExit()
@@ -90,7 +175,7 @@ void RendererExit()
     ForwardPassExit(&Renderer.Forward);
     ColorCorrectionPassExit(&Renderer.ColorCorrection);
     TonemappingPassExit(&Renderer.Tonemapping);
-    RendererSettingsFree(&Renderer.Settings);
+    RenderGraphFree(&Renderer.Graph);
 }
 
 void RendererStartSync()
@@ -101,21 +186,17 @@ void RendererStartSync()
 void RendererConstructFrame(camera_data *Camera)
 {
     RendererSettingsUpdate(&Renderer.Settings);
-    ForwardPassUpdate(&Renderer.Forward, Camera, Renderer.Settings.Wireframe);
-    if (Renderer.Settings.EnableColorCorrection)
-        ColorCorrectionPassUpdate(&Renderer.ColorCorrection, &Renderer.Settings.Buffer);
-    TonemappingPassUpdate(&Renderer.Tonemapping, &Renderer.Settings.Buffer);
 
-    gpu_command_buffer *Buffer = GpuGetImageCommandBuffer();
-    gpu_image *Image = GpuGetSwapChainImage();
+    renderer_frame *Frame = &Renderer.Frame;
+    Frame->Camera = Camera;
+    Frame->Instances = Renderer.Instances.data();
+    Frame->InstanceCount = (uint32_t)Renderer.Instances.size();
 
-    GpuCommandBufferBegin(Buffer);
-    GpuCommandBufferImageBarrier(Buffer, Image, gpu_image_layout::ImageLayoutCopyDest);
-    GpuCommandBufferImageBarrier(Buffer, &Renderer.Tonemapping.LDRImage, gpu_image_layout::ImageLayoutCopySource);
-    GpuCommandBufferBlit(Buffer, &Renderer.Tonemapping.LDRImage, Image);
-    GpuCommandBufferImageBarrier(Buffer, Image, gpu_image_layout::ImageLayoutCommon);
-    GpuCommandBufferEnd(Buffer);
-    GpuCommandBufferFlush(Buffer);
+    // NOTE(amelie.h): Toggling color correction recompiles the graph, the tonemapper then reads the forward output directly.
+    RenderGraphSetEnabled(&Renderer.Graph, Renderer.ColorCorrectionPass, Renderer.Settings.EnableColorCorrection);
+    RenderGraphSetImported(&Renderer.Graph, Renderer.Backbuffer, GpuGetSwapChainImage());
+    RenderGraphExecute(&Renderer.Graph);
+    Renderer.Instances.clear();
 }
 
 void RendererStartRender()
@@ -149,9 +230,7 @@ void RendererEndSync()
 void RendererResize(uint32_t Width, uint32_t Height)
 {
     GpuResize(Width, Height);
-    ForwardPassResize(&Renderer.Forward, Width, Height);
-    ColorCorrectionPassResize(&Renderer.ColorCorrection, Width, Height, &Renderer.Forward.RenderTarget);
-    TonemappingPassResize(&Renderer.Tonemapping, Width, Height, &Renderer.Forward.RenderTarget);
+    RendererBuildGraph();
 }
 
 void RendererScreenshot()
@@ -171,7 +250,28 @@ void RendererScreenshot()
     GpuBufferFree(&Temporary);
 }
 
+void RendererDrawModel(loaded_model *Model, hmm_mat4 Transform)
+{
+    Renderer.Instances.push_back({ Model, Transform });
+}
+
+void RendererDrawEntity(game_entity *Entity)
+{
+    if (Entity->Model)
+        RendererDrawModel(Entity->Model, Entity->Transform.Matrix);
+}
+
 renderer_settings *RendererGetSettings()
 {
     return &Renderer.Settings;
 }
+
+render_queue_stats RendererGetQueueStats()
+{
+    return Renderer.Forward.Stats;
+}
+
+render_graph *RendererGetGraph()
+{
+    return &Renderer.Graph;
+}
@@ -10,6 +10,7 @@
 #include <cstdint>
 
 #include "renderer_settings.hpp"
+#include "render_graph.hpp"
 #include "passes/forward_pass.hpp"
 #include "passes/color_correction_pass.hpp"
 #include "passes/tonemapping_pass.hpp"
@@ -23,4 +24,10 @@ void RendererEndRender();
 void RendererEndSync();
 void RendererResize(uint32_t Width, uint32_t Height);
 void RendererScreenshot();
+// NOTE(amelie.h): Queues one copy of the model for the next RendererConstructFrame. Copies of the same model are drawn instanced.
+void RendererDrawModel(loaded_model *Model, hmm_mat4 Transform);
+// NOTE(amelie.h): Queues the entity's model at its transform, entities without a model are skipped.
+void RendererDrawEntity(game_entity *Entity);
 renderer_settings *RendererGetSettings();
+render_queue_stats RendererGetQueueStats();
+render_graph *RendererGetGraph();
@@ -7,19 +7,20 @@
 
 #include "renderer_settings.hpp"
 
+#include "game_data.hpp"
 #include "systems/allocator_system.hpp"
 
-void RendererSettingsInit(renderer_settings *Settings)
-{
-    GpuBufferInit(&Settings->Buffer, 256, 0, gpu_buffer_type::Uniform);
-}
+#include <cstring>
 
-void RendererSettingsFree(renderer_settings *Settings)
+void RendererSettingsLoad(renderer_settings *Settings)
 {
-    GpuBufferFree(&Settings->Buffer);
+    Settings->LodThreshold = EgcF32(EgcFile, "lod_threshold");
+    Settings->OcclusionCulling = EgcB32(EgcFile, "occlusion_culling");
 }
 
 void RendererSettingsUpdate(renderer_settings *Settings)
 {
-    GpuBufferUpload(&Settings->Buffer, &Settings->Settings, sizeof(renderer_settings));
+    Settings->Allocation = GpuFrameAllocConstant(sizeof(settings_value));
+    if (Settings->Allocation.Data)
+        memcpy(Settings->Allocation.Data, &Settings->Settings, sizeof(settings_value));
 }
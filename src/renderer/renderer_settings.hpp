@@ -7,7 +7,7 @@
 
 #pragma once
 
-#include "gpu/gpu_buffer.hpp"
+#include "gpu/gpu_frame_allocator.hpp"
 
 #include "math_types.hpp"
 
@@ -44,14 +44,18 @@ struct settings_value
 
 struct renderer_settings
 {
-    gpu_buffer Buffer;
+    gpu_frame_allocation Allocation;
 
     bool Wireframe;
     bool EnableColorCorrection;
 
+    // NOTE(amelie.h): lod_threshold and occlusion_culling from the config, read by RendererSettingsLoad so the passes
+    // don't look them up every frame. Whoever changes the config has to load them again.
+    float LodThreshold;
+    bool OcclusionCulling;
+
     settings_value Settings;
 };
 
-void RendererSettingsInit(renderer_settings *Settings);
+void RendererSettingsLoad(renderer_settings *Settings);
 void RendererSettingsUpdate(renderer_settings *Settings);
-void RendererSettingsFree(renderer_settings *Settings);
@@ -0,0 +1,828 @@
+/**
+ *  Author: Amélie Heinrich
+ *  Company: Amélie Games
+ *  License: MIT
+ *  Create Time: 17/10/2026 18:15
+ */
+
+#include "bvh.hpp"
+
+#include "timer.hpp"
+#include "cameras/noclip_camera.hpp"
+#include "systems/log_system.hpp"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <numeric>
+#include <random>
+
+struct bvh_frustum_entry
+{
+    uint32_t Node;
+    uint32_t Mask;
+};
+
+aabb AabbUnion(aabb A, aabb B)
+{
+    aabb Result;
+    for (int Axis = 0; Axis < 3; Axis++)
+    {
+        Result.Min.Elements[Axis] = std::min(A.Min.Elements[Axis], B.Min.Elements[Axis]);
+        Result.Max.Elements[Axis] = std::max(A.Max.Elements[Axis], B.Max.Elements[Axis]);
+    }
+    return Result;
+}
+
+float AabbSurfaceArea(aabb Box)
+{
+    V3 Size = HMM_SubtractVec3(Box.Max, Box.Min);
+    return 2.0f * (Size.X * Size.Y + Size.Y * Size.Z + Size.Z * Size.X);
+}
+
+bool AabbOverlaps(aabb A, aabb B)
+{
+    for (int Axis = 0; Axis < 3; Axis++)
+        if (A.Min.Elements[Axis] > B.Max.Elements[Axis] || B.Min.Elements[Axis] > A.Max.Elements[Axis])
+            return false;
+    return true;
+}
+
+bool AabbContains(aabb Outer, aabb Inner)
+{
+    for (int Axis = 0; Axis < 3; Axis++)
+        if (Inner.Min.Elements[Axis] < Outer.Min.Elements[Axis] || Inner.Max.Elements[Axis] > Outer.Max.Elements[Axis])
+            return false;
+    return true;
+}
+
+aabb AabbFatten(aabb Box)
+{
+    V3 Margin = HMM_Vec3(BVH_FAT_MARGIN, BVH_FAT_MARGIN, BVH_FAT_MARGIN);
+    return { HMM_SubtractVec3(Box.Min, Margin), HMM_AddVec3(Box.Max, Margin) };
+}
+
+bool AabbRay(aabb Box, V3 Origin, V3 InverseDirection, float MaxDistance, float *Entry)
+{
+    float Near = 0.0f;
+    float Far = MaxDistance;
+    for (int Axis = 0; Axis < 3; Axis++)
+    {
+        float A = (Box.Min.Elements[Axis] - Origin.Elements[Axis]) * InverseDirection.Elements[Axis];
+        float B = (Box.Max.Elements[Axis] - Origin.Elements[Axis]) * InverseDirection.Elements[Axis];
+        Near = std::max(Near, std::min(A, B));
+        Far = std::min(Far, std::max(A, B));
+    }
+    *Entry = Near;
+    return Near <= Far;
+}
+
+bool BvhIsLeaf(const bvh_node& Node)
+{
+    return Node.Left == BVH_NULL_NODE;
+}
+
+void BvhInit(bvh *Tree)
+{
+    Tree->Nodes.clear();
+    Tree->Root = BVH_NULL_NODE;
+    Tree->FreeList = BVH_NULL_NODE;
+    Tree->LeafCount = 0;
+}
+
+void BvhClear(bvh *Tree)
+{
+    BvhInit(Tree);
+}
+
+uint32_t BvhAllocateNode(bvh *Tree)
+{
+    uint32_t Index;
+    if (Tree->FreeList == BVH_NULL_NODE)
+    {
+        Index = (uint32_t)Tree->Nodes.size();
+        Tree->Nodes.emplace_back();
+    }
+    else
+    {
+        Index = Tree->FreeList;
+        Tree->FreeList = Tree->Nodes[Index].Parent;
+    }
+
+    bvh_node& Node = Tree->Nodes[Index];
+    Node.Parent = BVH_NULL_NODE;
+    Node.Left = BVH_NULL_NODE;
+    Node.Right = BVH_NULL_NODE;
+    Node.UserData = BVH_NULL_NODE;
+    Node.Height = 0;
+    return Index;
+}
+
+void BvhFreeNode(bvh *Tree, uint32_t Index)
+{
+    Tree->Nodes[Index].Parent = Tree->FreeList;
+    Tree->Nodes[Index].Height = -1;
+    Tree->FreeList = Index;
+}
+
+void BvhReplaceChild(bvh *Tree, uint32_t Parent, uint32_t Old, uint32_t New)
+{
+    if (Parent == BVH_NULL_NODE)
+        Tree->Root = New;
+    else if (Tree->Nodes[Parent].Left == Old)
+        Tree->Nodes[Parent].Left = New;
+    else
+        Tree->Nodes[Parent].Right = New;
+}
+
+void BvhFitNode(bvh *Tree, uint32_t Index)
+{
+    bvh_node& Node = Tree->Nodes[Index];
+    Node.Box = AabbUnion(Tree->Nodes[Node.Left].Box, Tree->Nodes[Node.Right].Box);
+    Node.Height = 1 + std::max(Tree->Nodes[Node.Left].Height, Tree->Nodes[Node.Right].Height);
+}
+
+// NOTE(amelie.h): AVL style rotation, promotes the taller grandchild when A is unbalanced. Returns the new subtree root.
+uint32_t BvhBalance(bvh *Tree, uint32_t A)
+{
+    bvh_node& NodeA = Tree->Nodes[A];
+    if (BvhIsLeaf(NodeA) || NodeA.Height < 2)
+        return A;
+
+    uint32_t B = NodeA.Left;
+    uint32_t C = NodeA.Right;
+    int32_t Balance = Tree->Nodes[C].Height - Tree->Nodes[B].Height;
+    if (Balance > 1)
+    {
+        bvh_node& NodeC = Tree->Nodes[C];
+        uint32_t F = NodeC.Left;
+        uint32_t G = NodeC.Right;
+
+        NodeC.Left = A;
+        NodeC.Parent = NodeA.Parent;
+        NodeA.Parent = C;
+        BvhReplaceChild(Tree, NodeC.Parent, A, C);
+
+        uint32_t Keep = Tree->Nodes[F].Height > Tree->Nodes[G].Height ? F : G;
+        uint32_t Move = Keep == F ? G : F;
+        NodeC.Right = Keep;
+        NodeA.Right = Move;
+        Tree->Nodes[Move].Parent = A;
+        BvhFitNode(Tree, A);
+        BvhFitNode(Tree, C);
+        return C;
+    }
+    if (Balance < -1)
+    {
+        bvh_node& NodeB = Tree->Nodes[B];
+        uint32_t D = NodeB.Left;
+        uint32_t E = NodeB.Right;
+
+        NodeB.Left = A;
+        NodeB.Parent = NodeA.Parent;
+        NodeA.Parent = B;
+        BvhReplaceChild(Tree, NodeB.Parent, A, B);
+
+        uint32_t Keep = Tree->Nodes[D].Height > Tree->Nodes[E].Height ? D : E;
+        uint32_t Move = Keep == D ? E : D;
+        NodeB.Right = Keep;
+        NodeA.Left = Move;
+        Tree->Nodes[Move].Parent = A;
+        BvhFitNode(Tree, A);
+        BvhFitNode(Tree, B);
+        return B;
+    }
+    return A;
+}
+
+void BvhRefitAncestors(bvh *Tree, uint32_t Index, bool Balance)
+{
+    while (Index != BVH_NULL_NODE)
+    {
+        if (Balance)
+            Index = BvhBalance(Tree, Index);
+        BvhFitNode(Tree, Index);
+        Index = Tree->Nodes[Index].Parent;
+    }
+}
+
+void BvhInsertLeaf(bvh *Tree, uint32_t Leaf)
+{
+    if (Tree->Root == BVH_NULL_NODE)
+    {
+        Tree->Root = Leaf;
+        Tree->Nodes[Leaf].Parent = BVH_NULL_NODE;
+        return;
+    }
+
+    // NOTE(amelie.h): Branch and bound descent on the SAH cost of putting the leaf next to each candidate sibling.
+    aabb LeafBox = Tree->Nodes[Leaf].Box;
+    uint32_t Index = Tree->Root;
+    while (!BvhIsLeaf(Tree->Nodes[Index]))
+    {
+        const bvh_node& Node = Tree->Nodes[Index];
+        float Area = AabbSurfaceArea(Node.Box);
+        float Combined = AabbSurfaceArea(AabbUnion(Node.Box, LeafBox));
+        float Cost = 2.0f * Combined;
+        float Inherited = 2.0f * (Combined - Area);
+
+        auto ChildCost = [&](uint32_t Child) {
+            const bvh_node& ChildNode = Tree->Nodes[Child];
+            float Grown = AabbSurfaceArea(AabbUnion(LeafBox, ChildNode.Box));
+            return (BvhIsLeaf(ChildNode) ? Grown : Grown - AabbSurfaceArea(ChildNode.Box)) + Inherited;
+        };
+        float LeftCost = ChildCost(Node.Left);
+        float RightCost = ChildCost(Node.Right);
+        if (Cost < LeftCost && Cost < RightCost)
+            break;
+        Index = LeftCost < RightCost ? Node.Left : Node.Right;
+    }
+
+    uint32_t Sibling = Index;
+    uint32_t OldParent = Tree->Nodes[Sibling].Parent;
+    uint32_t NewParent = BvhAllocateNode(Tree);
+    bvh_node& Parent = Tree->Nodes[NewParent];
+    Parent.Parent = OldParent;
+    Parent.Left = Sibling;
+    Parent.Right = Leaf;
+    Tree->Nodes[Sibling].Parent = NewParent;
+    Tree->Nodes[Leaf].Parent = NewParent;
+    BvhReplaceChild(Tree, OldParent, Sibling, NewParent);
+
+    BvhRefitAncestors(Tree, NewParent, true);
+}
+
+void BvhRemoveLeaf(bvh *Tree, uint32_t Leaf)
+{
+    if (Leaf == Tree->Root)
+    {
+        Tree->Root = BVH_NULL_NODE;
+        return;
+    }
+
+    uint32_t Parent = Tree->Nodes[Leaf].Parent;
+    uint32_t GrandParent = Tree->Nodes[Parent].Parent;
+    uint32_t Sibling = Tree->Nodes[Parent].Left == Leaf ? Tree->Nodes[Parent].Right : Tree->Nodes[Parent].Left;
+
+    BvhReplaceChild(Tree, GrandParent, Parent, Sibling);
+    Tree->Nodes[Sibling].Parent = GrandParent;
+    BvhFreeNode(Tree, Parent);
+    BvhRefitAncestors(Tree, GrandParent, true);
+}
+
+uint32_t BvhInsert(bvh *Tree, aabb Box, uint32_t UserData)
+{
+    uint32_t Proxy = BvhAllocateNode(Tree);
+    Tree->Nodes[Proxy].Box = AabbFatten(Box);
+    Tree->Nodes[Proxy].UserData = UserData;
+    BvhInsertLeaf(Tree, Proxy);
+    Tree->LeafCount++;
+    return Proxy;
+}
+
+void BvhRemove(bvh *Tree, uint32_t Proxy)
+{
+    BvhRemoveLeaf(Tree, Proxy);
+    BvhFreeNode(Tree, Proxy);
+    Tree->LeafCount--;
+}
+
+bool BvhMove(bvh *Tree, uint32_t Proxy, aabb Box)
+{
+    if (AabbContains(Tree->Nodes[Proxy].Box, Box))
+        return false;
+
+    BvhRemoveLeaf(Tree, Proxy);
+    Tree->Nodes[Proxy].Box = AabbFatten(Box);
+    BvhInsertLeaf(Tree, Proxy);
+    return true;
+}
+
+uint32_t BvhBuildRange(bvh *Tree, const aabb *Boxes, const std::vector<V3>& Centroids, uint32_t *Objects, uint32_t Count, std::vector<uint32_t> *Proxies)
+{
+    uint32_t Node = BvhAllocateNode(Tree);
+    if (Count == 1)
+    {
+        Tree->Nodes[Node].Box = Boxes[Objects[0]];
+        Tree->Nodes[Node].UserData = Objects[0];
+        if (Proxies)
+            (*Proxies)[Objects[0]] = Node;
+        return Node;
+    }
+
+    aabb Bounds = Boxes[Objects[0]];
+    aabb CentroidBounds = { Centroids[Objects[0]], Centroids[Objects[0]] };
+    for (uint32_t Index = 1; Index < Count; Index++)
+    {
+        Bounds = AabbUnion(Bounds, Boxes[Objects[Index]]);
+        CentroidBounds = AabbUnion(CentroidBounds, { Centroids[Objects[Index]], Centroids[Objects[Index]] });
+    }
+
+    V3 Extent = HMM_SubtractVec3(CentroidBounds.Max, CentroidBounds.Min);
+    int Axis = Extent.X > Extent.Y ? (Extent.X > Extent.Z ? 0 : 2) : (Extent.Y > Extent.Z ? 1 : 2);
+    float Min = CentroidBounds.Min.Elements[Axis];
+    float Size = Extent.Elements[Axis];
+
+    // NOTE(amelie.h): Binned SAH, bucket centroids along the widest axis and sweep the BVH_SAH_BINS - 1 split planes.
+    uint32_t Mid = Count / 2;
+    if (Size > 0.0f)
+    {
+        auto BinOf = [&](uint32_t Object) {
+            return std::min(BVH_SAH_BINS - 1, (int)(BVH_SAH_BINS * (Centroids[Object].Elements[Axis] - Min) / Size));
+        };
+
+        uint32_t BinCounts[BVH_SAH_BINS] = {};
+        aabb BinBoxes[BVH_SAH_BINS];
+        for (uint32_t Index = 0; Index < Count; Index++)
+        {
+            int Bin = BinOf(Objects[Index]);
+            BinBoxes[Bin] = BinCounts[Bin] ? AabbUnion(BinBoxes[Bin], Boxes[Objects[Index]]) : Boxes[Objects[Index]];
+            BinCounts[Bin]++;
+        }
+
+        float RightAreas[BVH_SAH_BINS] = {};
+        uint32_t RightCounts[BVH_SAH_BINS] = {};
+        aabb Accumulated = {};
+        uint32_t Accumulator = 0;
+        for (int Bin = BVH_SAH_BINS - 1; Bin > 0; Bin--)
+        {
+            if (BinCounts[Bin])
+                Accumulated = Accumulator ? AabbUnion(Accumulated, BinBoxes[Bin]) : BinBoxes[Bin];
+            Accumulator += BinCounts[Bin];
+            RightAreas[Bin] = Accumulator ? AabbSurfaceArea(Accumulated) : 0.0f;
+            RightCounts[Bin] = Accumulator;
+        }
+
+        float BestCost = FLT_MAX;
+        int BestSplit = -1;
+        Accumulator = 0;
+        for (int Bin = 0; Bin < BVH_SAH_BINS - 1; Bin++)
+        {
+            if (BinCounts[Bin])
+                Accumulated = Accumulator ? AabbUnion(Accumulated, BinBoxes[Bin]) : BinBoxes[Bin];
+            Accumulator += BinCounts[Bin];
+            if (!Accumulator || !RightCounts[Bin + 1])
+                continue;
+
+            float Cost = AabbSurfaceArea(Accumulated) * Accumulator + RightAreas[Bin + 1] * RightCounts[Bin + 1];
+            if (Cost < BestCost)
+            {
+                BestCost = Cost;
+                BestSplit = Bin;
+            }
+        }
+
+        if (BestSplit >= 0)
+            Mid = (uint32_t)(std::partition(Objects, Objects + Count, [&](uint32_t Object) { return BinOf(Object) <= BestSplit; }) - Objects);
+        if (Mid == 0 || Mid == Count)
+            Mid = Count / 2;
+    }
+
+    uint32_t Left = BvhBuildRange(Tree, Boxes, Centroids, Objects, Mid, Proxies);
+    uint32_t Right = BvhBuildRange(Tree, Boxes, Centroids, Objects + Mid, Count - Mid, Proxies);
+    Tree->Nodes[Node].Left = Left;
+    Tree->Nodes[Node].Right = Right;
+    Tree->Nodes[Left].Parent = Node;
+    Tree->Nodes[Right].Parent = Node;
+    BvhFitNode(Tree, Node);
+    return Node;
+}
+
+void BvhBuild(bvh *Tree, const aabb *Boxes, uint32_t Count, std::vector<uint32_t> *Proxies)
+{
+    BvhInit(Tree);
+    if (Proxies)
+        Proxies->assign(Count, BVH_NULL_NODE);
+    if (!Count)
+        return;
+
+    std::vector<uint32_t> Objects(Count);
+    std::iota(Objects.begin(), Objects.end(), 0);
+    std::vector<V3> Centroids(Count);
+    for (uint32_t Index = 0; Index < Count; Index++)
+        Centroids[Index] = HMM_MultiplyVec3f(HMM_AddVec3(Boxes[Index].Min, Boxes[Index].Max), 0.5f);
+
+    Tree->Nodes.reserve(Count * 2 - 1);
+    Tree->Root = BvhBuildRange(Tree, Boxes, Centroids, Objects.data(), Count, Proxies);
+    Tree->LeafCount = Count;
+}
+
+void BvhRefitLeaf(bvh *Tree, uint32_t Proxy, aabb Box)
+{
+    Tree->Nodes[Proxy].Box = Box;
+    BvhRefitAncestors(Tree, Tree->Nodes[Proxy].Parent, false);
+}
+
+void BvhRefitNode(bvh *Tree, uint32_t Index)
+{
+    if (BvhIsLeaf(Tree->Nodes[Index]))
+        return;
+    BvhRefitNode(Tree, Tree->Nodes[Index].Left);
+    BvhRefitNode(Tree, Tree->Nodes[Index].Right);
+    BvhFitNode(Tree, Index);
+}
+
+void BvhRefit(bvh *Tree)
+{
+    if (Tree->Root != BVH_NULL_NODE)
+        BvhRefitNode(Tree, Tree->Root);
+}
+
+void BvhQueryFrustum(const bvh *Tree, const V4 *Planes, std::vector<uint32_t>& Results)
+{
+    if (Tree->Root == BVH_NULL_NODE)
+        return;
+
+    // NOTE(amelie.h): Mask holds the planes the parent straddles, a subtree fully inside a plane never tests it again.
+    std::vector<bvh_frustum_entry> Stack;
+    Stack.push_back({ Tree->Root, 0x3F });
+    while (!Stack.empty())
+    {
+        bvh_frustum_entry Entry = Stack.back();
+        Stack.pop_back();
+
+        const bvh_node& Node = Tree->Nodes[Entry.Node];
+        V3 Center = HMM_MultiplyVec3f(HMM_AddVec3(Node.Box.Min, Node.Box.Max), 0.5f);
+        V3 Extent = HMM_MultiplyVec3f(HMM_SubtractVec3(Node.Box.Max, Node.Box.Min), 0.5f);
+
+        bool Outside = false;
+        for (int Plane = 0; Plane < 6 && !Outside; Plane++)
+        {
+            if (!(Entry.Mask & (1 << Plane)))
+                continue;
+
+            V3 Normal = Planes[Plane].XYZ;
+            float Distance = HMM_DotVec3(Normal, Center) - Planes[Plane].W;
+            float Radius = fabsf(Normal.X) * Extent.X + fabsf(Normal.Y) * Extent.Y + fabsf(Normal.Z) * Extent.Z;
+            if (Distance + Radius < 0.0f)
+                Outside = true;
+            else if (Distance - Radius >= 0.0f)
+                Entry.Mask &= ~(1u << Plane);
+        }
+        if (Outside)
+            continue;
+
+        if (BvhIsLeaf(Node))
+        {
+            Results.push_back(Node.UserData);
+            continue;
+        }
+        Stack.push_back({ Node.Left, Entry.Mask });
+        Stack.push_back({ Node.Right, Entry.Mask });
+    }
+}
+
+void BvhQueryOverlap(const bvh *Tree, aabb Box, std::vector<uint32_t>& Results)
+{
+    if (Tree->Root == BVH_NULL_NODE)
+        return;
+
+    std::vector<uint32_t> Stack;
+    Stack.push_back(Tree->Root);
+    while (!Stack.empty())
+    {
+        const bvh_node& Node = Tree->Nodes[Stack.back()];
+        Stack.pop_back();
+        if (!AabbOverlaps(Node.Box, Box))
+            continue;
+
+        if (BvhIsLeaf(Node))
+        {
+            Results.push_back(Node.UserData);
+            continue;
+        }
+        Stack.push_back(Node.Left);
+        Stack.push_back(Node.Right);
+    }
+}
+
+bvh_ray_hit BvhRaycast(const bvh *Tree, V3 Origin, V3 Direction, float MaxDistance, const bvh_ray_callback& Callback)
+{
+    bvh_ray_hit Hit = { false, MaxDistance, BVH_NULL_NODE };
+    float Length = HMM_LengthVec3(Direction);
+    if (Tree->Root == BVH_NULL_NODE || Length <= 0.0f)
+        return Hit;
+
+    Direction = HMM_DivideVec3f(Direction, Length);
+    V3 Inverse = HMM_Vec3(1.0f / Direction.X, 1.0f / Direction.Y, 1.0f / Direction.Z);
+
+    std::vector<uint32_t> Stack;
+    Stack.push_back(Tree->Root);
+    while (!Stack.empty())
+    {
+        const bvh_node& Node = Tree->Nodes[Stack.back()];
+        Stack.pop_back();
+
+        float Entry;
+        if (!AabbRay(Node.Box, Origin, Inverse, Hit.Distance, &Entry))
+            continue;
+
+        if (BvhIsLeaf(Node))
+        {
+            float Distance = Callback ? Callback(Node.UserData, Origin, Direction, Hit.Distance) : Entry;
+            if (Distance >= 0.0f && Distance <= Hit.Distance)
+            {
+                Hit.Hit = true;
+                Hit.Distance = Distance;
+                Hit.UserData = Node.UserData;
+            }
+            continue;
+        }
+
+        // NOTE(amelie.h): Nearer child goes on top so its hits clip the ray before the far child is visited.
+        float LeftEntry;
+        float RightEntry;
+        bool LeftHit = AabbRay(Tree->Nodes[Node.Left].Box, Origin, Inverse, Hit.Distance, &LeftEntry);
+        bool RightHit = AabbRay(Tree->Nodes[Node.Right].Box, Origin, Inverse, Hit.Distance, &RightEntry);
+        if (LeftHit && RightHit)
+        {
+            Stack.push_back(LeftEntry < RightEntry ? Node.Right : Node.Left);
+            Stack.push_back(LeftEntry < RightEntry ? Node.Left : Node.Right);
+        }
+        else if (LeftHit)
+            Stack.push_back(Node.Left);
+        else if (RightHit)
+            Stack.push_back(Node.Right);
+    }
+    return Hit;
+}
+
+int32_t BvhGetHeight(const bvh *Tree)
+{
+    return Tree->Root == BVH_NULL_NODE ? 0 : Tree->Nodes[Tree->Root].Height;
+}
+
+float BvhGetCost(const bvh *Tree)
+{
+    // NOTE(amelie.h): Internal node area relative to the root, the SAH estimate of nodes visited by a random ray.
+    if (Tree->Root == BVH_NULL_NODE)
+        return 0.0f;
+
+    double Area = 0.0;
+    for (auto& Node : Tree->Nodes)
+        if (Node.Height > 0)
+            Area += AabbSurfaceArea(Node.Box);
+    return (float)(Area / AabbSurfaceArea(Tree->Nodes[Tree->Root].Box));
+}
+
+uint32_t BvhBenchmark()
+{
+    const uint32_t ObjectCount = 100'000;
+    const uint32_t LinearRays = 1'000;
+    const uint32_t TreeRays = 100'000;
+    const uint32_t OverlapQueries = 10'000;
+    const uint32_t CheckedOverlapQueries = 1'000;
+    const float WorldSize = 2000.0f;
+
+    std::mt19937 Random(1234);
+    std::uniform_real_distribution<float> Position(-WorldSize * 0.5f, WorldSize * 0.5f);
+    std::uniform_real_distribution<float> Size(0.5f, 10.0f);
+    std::uniform_real_distribution<float> Unit(-1.0f, 1.0f);
+
+    std::vector<aabb> Boxes(ObjectCount);
+    for (auto& Box : Boxes)
+    {
+        V3 Center = HMM_Vec3(Position(Random), Position(Random), Position(Random));
+        V3 Extent = HMM_Vec3(Size(Random), Size(Random), Size(Random));
+        Box = { HMM_SubtractVec3(Center, Extent), HMM_AddVec3(Center, Extent) };
+    }
+
+    LogInfo("BVH Benchmark: %u objects in a %.0f unit cube", ObjectCount, WorldSize);
+    uint32_t Failures = 0;
+
+    timer Timer;
+    TimerInit(&Timer);
+    bvh Dynamic;
+    BvhInit(&Dynamic);
+    std::vector<uint32_t> DynamicProxies(ObjectCount);
+    for (uint32_t Index = 0; Index < ObjectCount; Index++)
+        DynamicProxies[Index] = BvhInsert(&Dynamic, Boxes[Index], Index);
+    double InsertMs = NanosecondsToMilliseconds(TimerGetElapsedNanoseconds(&Timer));
+
+    TimerRestart(&Timer);
+    bvh Static;
+    std::vector<uint32_t> StaticProxies;
+    BvhBuild(&Static, Boxes.data(), ObjectCount, &StaticProxies);
+    double BuildMs = NanosecondsToMilliseconds(TimerGetElapsedNanoseconds(&Timer));
+
+    LogInfo("  dynamic inserts %.2fms (%.0f ns/insert), height %d, SAH cost %.1f", InsertMs, (InsertMs * 1'000'000.0) / ObjectCount, BvhGetHeight(&Dynamic), BvhGetCost(&Dynamic));
+    LogInfo("  SAH build       %.2fms, height %d, SAH cost %.1f", BuildMs, BvhGetHeight(&Static), BvhGetCost(&Static));
+
+    noclip_camera Camera = {};
+    Camera.Width = 1280.0f;
+    Camera.Height = 720.0f;
+    Camera.Position = HMM_Vec3(0.0f, 0.0f, 0.0f);
+    Camera.Front = HMM_Vec3(0.0f, 0.0f, -1.0f);
+    Camera.Up = HMM_Vec3(0.0f, 1.0f, 0.0f);
+    Camera.Right = HMM_Vec3(1.0f, 0.0f, 0.0f);
+    NoClipCameraUpdateFrustum(&Camera);
+    const V4 *Planes = Camera.Planes;
+
+    std::vector<uint32_t> Results;
+    Results.reserve(ObjectCount);
+    std::vector<uint32_t> LinearResults;
+    LinearResults.reserve(ObjectCount);
+    TimerRestart(&Timer);
+    uint32_t LinearVisible = 0;
+    for (uint32_t Index = 0; Index < ObjectCount; Index++)
+    {
+        const aabb& Box = Boxes[Index];
+        V3 Center = HMM_MultiplyVec3f(HMM_AddVec3(Box.Min, Box.Max), 0.5f);
+        V3 Extent = HMM_MultiplyVec3f(HMM_SubtractVec3(Box.Max, Box.Min), 0.5f);
+        bool Inside = true;
+        for (int Plane = 0; Plane < 6 && Inside; Plane++)
+        {
+            V3 Normal = Planes[Plane].XYZ;
+            float Radius = fabsf(Normal.X) * Extent.X + fabsf(Normal.Y) * Extent.Y + fabsf(Normal.Z) * Extent.Z;
+            Inside = HMM_DotVec3(Normal, Center) - Planes[Plane].W + Radius >= 0.0f;
+        }
+        LinearVisible += Inside;
+        if (Inside)
+            LinearResults.push_back(Index);
+    }
+    double LinearFrustumMs = NanosecondsToMilliseconds(TimerGetElapsedNanoseconds(&Timer));
+
+    TimerRestart(&Timer);
+    BvhQueryFrustum(&Static, Planes, Results);
+    double TreeFrustumMs = NanosecondsToMilliseconds(TimerGetElapsedNanoseconds(&Timer));
+    size_t TreeVisible = Results.size();
+    std::sort(Results.begin(), Results.end());
+    bool FrustumMatch = Results == LinearResults;
+    LogInfo("  frustum query   linear %.3fms, SAH tree %.3fms (%.1fx) | %u vs %zu visible, %s",
+            LinearFrustumMs, TreeFrustumMs, LinearFrustumMs / TreeFrustumMs, LinearVisible, TreeVisible, FrustumMatch ? "same objects" : "MISMATCH");
+    if (!FrustumMatch)
+    {
+        LogError("BVH Benchmark: Frustum query doesn't return the objects the linear test finds!");
+        Failures++;
+    }
+
+    std::vector<V3> Origins(TreeRays);
+    std::vector<V3> Directions(TreeRays);
+    for (uint32_t Ray = 0; Ray < TreeRays; Ray++)
+    {
+        Origins[Ray] = HMM_Vec3(Position(Random), Position(Random), Position(Random));
+        Directions[Ray] = HMM_Vec3(Unit(Random), Unit(Random), Unit(Random));
+    }
+
+    std::vector<bvh_ray_hit> LinearHitList(LinearRays);
+    TimerRestart(&Timer);
+    uint32_t LinearHits = 0;
+    for (uint32_t Ray = 0; Ray < LinearRays; Ray++)
+    {
+        V3 Direction = HMM_NormalizeVec3(Directions[Ray]);
+        V3 Inverse = HMM_Vec3(1.0f / Direction.X, 1.0f / Direction.Y, 1.0f / Direction.Z);
+        bvh_ray_hit Hit = { false, WorldSize, BVH_NULL_NODE };
+        for (uint32_t Index = 0; Index < ObjectCount; Index++)
+        {
+            float Entry;
+            if (AabbRay(Boxes[Index], Origins[Ray], Inverse, Hit.Distance, &Entry))
+                Hit = { true, Entry, Index };
+        }
+        LinearHits += Hit.Hit;
+        LinearHitList[Ray] = Hit;
+    }
+    double LinearRayMs = NanosecondsToMilliseconds(TimerGetElapsedNanoseconds(&Timer));
+
+    std::vector<bvh_ray_hit> TreeHitList(LinearRays);
+    uint32_t TreeHits = 0;
+    uint32_t MatchingHits = 0;
+    TimerRestart(&Timer);
+    for (uint32_t Ray = 0; Ray < TreeRays; Ray++)
+    {
+        bvh_ray_hit Hit = BvhRaycast(&Static, Origins[Ray], Directions[Ray], WorldSize);
+        TreeHits += Hit.Hit;
+        if (Ray < LinearRays)
+        {
+            MatchingHits += Hit.Hit;
+            TreeHitList[Ray] = Hit;
+        }
+    }
+    double TreeRayMs = NanosecondsToMilliseconds(TimerGetElapsedNanoseconds(&Timer));
+
+    // NOTE(amelie.h): Rays starting inside several boxes hit all of them at distance 0, any of those is the right answer
+    // as long as the object the tree reports really is hit at that distance.
+    uint32_t RayMismatches = 0;
+    for (uint32_t Ray = 0; Ray < LinearRays; Ray++)
+    {
+        const bvh_ray_hit& Linear = LinearHitList[Ray];
+        const bvh_ray_hit& Tree = TreeHitList[Ray];
+        if (Linear.Hit != Tree.Hit)
+        {
+            RayMismatches++;
+            continue;
+        }
+        if (!Linear.Hit)
+            continue;
+        if (fabsf(Linear.Distance - Tree.Distance) > 1e-3f * std::max(1.0f, Linear.Distance) || Tree.UserData >= ObjectCount)
+        {
+            RayMismatches++;
+            continue;
+        }
+        if (Linear.UserData != Tree.UserData)
+        {
+            V3 Direction = HMM_NormalizeVec3(Directions[Ray]);
+            V3 Inverse = HMM_Vec3(1.0f / Direction.X, 1.0f / Direction.Y, 1.0f / Direction.Z);
+            float Entry;
+            if (!AabbRay(Boxes[Tree.UserData], Origins[Ray], Inverse, WorldSize, &Entry) || fabsf(Entry - Linear.Distance) > 1e-3f * std::max(1.0f, Linear.Distance))
+                RayMismatches++;
+        }
+    }
+    LogInfo("  raycast         linear %.1f us/ray, SAH tree %.2f us/ray (%.0fx) | %u vs %u hits on the shared rays, %u mismatches",
+            (LinearRayMs * 1000.0) / LinearRays, (TreeRayMs * 1000.0) / TreeRays, (LinearRayMs / LinearRays) / (TreeRayMs / TreeRays), LinearHits, MatchingHits, RayMismatches);
+    if (RayMismatches)
+    {
+        LogError("BVH Benchmark: %u rays hit a different object or distance than the linear reference!", RayMismatches);
+        Failures++;
+    }
+
+    std::vector<aabb> Queries(OverlapQueries);
+    for (auto& Query : Queries)
+    {
+        V3 Center = HMM_Vec3(Position(Random), Position(Random), Position(Random));
+        V3 Extent = HMM_Vec3(25.0f, 25.0f, 25.0f);
+        Query = { HMM_SubtractVec3(Center, Extent), HMM_AddVec3(Center, Extent) };
+    }
+
+    TimerRestart(&Timer);
+    size_t Overlaps = 0;
+    for (auto& Query : Queries)
+    {
+        Results.clear();
+        BvhQueryOverlap(&Dynamic, Query, Results);
+        Overlaps += Results.size();
+    }
+    double OverlapMs = NanosecondsToMilliseconds(TimerGetElapsedNanoseconds(&Timer));
+
+    // NOTE(amelie.h): Leaves of the dynamic tree are fat, so the tree may return more than the exact boxes overlap but never less.
+    uint32_t MissedOverlaps = 0;
+    for (uint32_t Query = 0; Query < CheckedOverlapQueries; Query++)
+    {
+        Results.clear();
+        BvhQueryOverlap(&Dynamic, Queries[Query], Results);
+        std::sort(Results.begin(), Results.end());
+        for (uint32_t Index = 0; Index < ObjectCount; Index++)
+            if (AabbOverlaps(Boxes[Index], Queries[Query]) && !std::binary_search(Results.begin(), Results.end(), Index))
+                MissedOverlaps++;
+    }
+    LogInfo("  overlap query   dynamic tree %.2f us/query, %.1f results/query, %u missed on %u checked queries",
+            (OverlapMs * 1000.0) / OverlapQueries, (float)Overlaps / OverlapQueries, MissedOverlaps, CheckedOverlapQueries);
+    if (MissedOverlaps)
+    {
+        LogError("BVH Benchmark: Overlap queries missed %u overlapping objects!", MissedOverlaps);
+        Failures++;
+    }
+
+    // NOTE(amelie.h): Small jitter stays inside the fat boxes, big jumps force reinsertion.
+    std::uniform_real_distribution<float> Jitter(-0.05f, 0.05f);
+    std::uniform_real_distribution<float> Jump(-20.0f, 20.0f);
+    for (int Pass = 0; Pass < 2; Pass++)
+    {
+        std::vector<aabb> Moved(ObjectCount);
+        for (uint32_t Index = 0; Index < ObjectCount; Index++)
+        {
+            V3 Offset = Pass == 0 ? HMM_Vec3(Jitter(Random), Jitter(Random), Jitter(Random)) : HMM_Vec3(Jump(Random), Jump(Random), Jump(Random));
+            Moved[Index] = { HMM_AddVec3(Boxes[Index].Min, Offset), HMM_AddVec3(Boxes[Index].Max, Offset) };
+        }
+
+        uint32_t Reinserted = 0;
+        TimerRestart(&Timer);
+        for (uint32_t Index = 0; Index < ObjectCount; Index++)
+            Reinserted += BvhMove(&Dynamic, DynamicProxies[Index], Moved[Index]);
+        double MoveMs = NanosecondsToMilliseconds(TimerGetElapsedNanoseconds(&Timer));
+
+        uint32_t Escaped = 0;
+        for (uint32_t Index = 0; Index < ObjectCount; Index++)
+            Escaped += !AabbContains(Dynamic.Nodes[DynamicProxies[Index]].Box, Moved[Index]);
+        LogInfo("  move (%s)    %.0f ns/move, %u reinserted, height %d, SAH cost %.1f, %u boxes outside their leaf",
+                Pass == 0 ? "small" : "large", (MoveMs * 1'000'000.0) / ObjectCount, Reinserted, BvhGetHeight(&Dynamic), BvhGetCost(&Dynamic), Escaped);
+        if (Escaped)
+        {
+            LogError("BVH Benchmark: %u moved objects are outside their leaf box!", Escaped);
+            Failures++;
+        }
+    }
+
+    TimerRestart(&Timer);
+    for (uint32_t Index = 0; Index < ObjectCount; Index++)
+    {
+        V3 Offset = HMM_Vec3(Jitter(Random), Jitter(Random), Jitter(Random));
+        aabb Moved = { HMM_AddVec3(Boxes[Index].Min, Offset), HMM_AddVec3(Boxes[Index].Max, Offset) };
+        Static.Nodes[StaticProxies[Index]].Box = Moved;
+    }
+    BvhRefit(&Static);
+    double RefitMs = NanosecondsToMilliseconds(TimerGetElapsedNanoseconds(&Timer));
+    LogInfo("  full refit      %.2fms after moving every leaf, SAH cost %.1f", RefitMs, BvhGetCost(&Static));
+
+    uint32_t Uncovered = 0;
+    for (const bvh_node& Node : Static.Nodes)
+        if (!BvhIsLeaf(Node))
+            Uncovered += !AabbContains(Node.Box, Static.Nodes[Node.Left].Box) || !AabbContains(Node.Box, Static.Nodes[Node.Right].Box);
+    if (Uncovered)
+    {
+        LogError("BVH Benchmark: %u nodes don't contain their children after the refit!", Uncovered);
+        Failures++;
+    }
+
+    LogInfo("BVH Benchmark: %s", Failures ? "FAIL" : "PASS");
+    return Failures;
+}
@@ -0,0 +1,84 @@
+/**
+ *  Author: Amélie Heinrich
+ *  Company: Amélie Games
+ *  License: MIT
+ *  Create Time: 17/10/2026 18:15
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "math_types.hpp"
+
+#define BVH_NULL_NODE UINT32_MAX
+#define BVH_SAH_BINS 16
+#define BVH_FAT_MARGIN 0.1f
+
+// NOTE(amelie.h): Leaves hold a single object each and have Left == BVH_NULL_NODE. A leaf node index is the proxy handed
+// back on insertion, UserData is whatever the caller wants back from queries (an entity index for now).
+// Free nodes are chained through Parent and have a Height of -1.
+struct bvh_node
+{
+    aabb Box;
+    uint32_t Parent;
+    uint32_t Left;
+    uint32_t Right;
+    uint32_t UserData;
+    int32_t Height;
+};
+
+// NOTE(amelie.h): One tree for both kinds of content. Dynamic objects go through BvhInsert/BvhMove, which keep the tree
+// balanced with rotations and give leaves a fat box so small motions don't touch the tree. Static levels are built in one
+// go with BvhBuild (binned SAH), and BvhRefit updates boxes in place when the topology is still good enough.
+struct bvh
+{
+    std::vector<bvh_node> Nodes;
+    uint32_t Root;
+    uint32_t FreeList;
+    uint32_t LeafCount;
+};
+
+struct bvh_ray_hit
+{
+    bool Hit;
+    float Distance;
+    uint32_t UserData;
+};
+
+// NOTE(amelie.h): Called for every leaf the ray reaches. Return the distance of the real hit or a negative value to skip
+// the object, the ray is then clipped to that distance. Without a callback leaf boxes count as hits.
+typedef std::function<float(uint32_t UserData, V3 Origin, V3 Direction, float MaxDistance)> bvh_ray_callback;
+
+aabb AabbUnion(aabb A, aabb B);
+float AabbSurfaceArea(aabb Box);
+bool AabbOverlaps(aabb A, aabb B);
+bool AabbContains(aabb Outer, aabb Inner);
+// NOTE(amelie.h): Slab test, Entry is where the ray enters the box (0 when it starts inside).
+bool AabbRay(aabb Box, V3 Origin, V3 InverseDirection, float MaxDistance, float *Entry);
+
+void BvhInit(bvh *Tree);
+void BvhClear(bvh *Tree);
+
+uint32_t BvhInsert(bvh *Tree, aabb Box, uint32_t UserData);
+void BvhRemove(bvh *Tree, uint32_t Proxy);
+// NOTE(amelie.h): Returns true when the leaf had to be reinserted because Box left its fat box.
+bool BvhMove(bvh *Tree, uint32_t Proxy, aabb Box);
+
+void BvhBuild(bvh *Tree, const aabb *Boxes, uint32_t Count, std::vector<uint32_t> *Proxies = nullptr);
+// NOTE(amelie.h): Incremental refit, sets a leaf box and walks its ancestors. BvhRefit redoes every internal node.
+void BvhRefitLeaf(bvh *Tree, uint32_t Proxy, aabb Box);
+void BvhRefit(bvh *Tree);
+
+// NOTE(amelie.h): Planes use the camera_data convention, normals pointing inside and W the distance along the normal.
+void BvhQueryFrustum(const bvh *Tree, const V4 *Planes, std::vector<uint32_t>& Results);
+void BvhQueryOverlap(const bvh *Tree, aabb Box, std::vector<uint32_t>& Results);
+bvh_ray_hit BvhRaycast(const bvh *Tree, V3 Origin, V3 Direction, float MaxDistance, const bvh_ray_callback& Callback = nullptr);
+
+int32_t BvhGetHeight(const bvh *Tree);
+float BvhGetCost(const bvh *Tree);
+
+// NOTE(amelie.h): Checks every query against a linear scan of the same boxes. Returns the number of checks that failed.
+uint32_t BvhBenchmark();
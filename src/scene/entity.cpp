@@ -0,0 +1,27 @@
+/**
+ *  Author: Amélie Heinrich
+ *  Company: Amélie Games
+ *  License: MIT
+ *  Create Time: 17/10/2026 18:20
+ */
+
+#include "entity.hpp"
+
+#include "bvh.hpp"
+#include "renderer/culling.hpp"
+
+void EntityUpdateBounds(game_entity *Entity)
+{
+    // NOTE(amelie.h): Entities without a model are points, they still need a box to live in the BVH.
+    V3 Position = Entity->Transform.Position;
+    Entity->Bounds = { Position, Position };
+    if (!Entity->Model)
+        return;
+
+    for (size_t MeshIndex = 0; MeshIndex < Entity->Model->Meshes.size(); MeshIndex++)
+    {
+        mesh *Mesh = &Entity->Model->Meshes[MeshIndex];
+        aabb Box = AabbTransform(Mesh->Box, Entity->Transform.Matrix * Mesh->Transform);
+        Entity->Bounds = MeshIndex ? AabbUnion(Entity->Bounds, Box) : Box;
+    }
+}
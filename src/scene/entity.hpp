@@ -15,6 +15,12 @@ struct game_entity
 {
     transform Transform;
 
-    loaded_model Model;
-    bool HasModel;
+    // NOTE(amelie.h): Shared by every entity placing the same asset, null when the entity has nothing to draw.
+    loaded_model *Model;
+
+    // NOTE(amelie.h): World space, refreshed by EntityUpdateBounds. BvhProxy is the entity's leaf in the scene BVH.
+    aabb Bounds;
+    uint32_t BvhProxy;
 };
+
+void EntityUpdateBounds(game_entity *Entity);
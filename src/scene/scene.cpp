@@ -0,0 +1,173 @@
+/**
+ *  Author: Amélie Heinrich
+ *  Company: Amélie Games
+ *  License: MIT
+ *  Create Time: 17/10/2026 21:10
+ */
+
+#include "scene.hpp"
+
+#include "systems/log_system.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#define SCENE_VALIDATE_RAY_LENGTH 10000.0f
+#define SCENE_VALIDATE_EPSILON 1e-3f
+
+void SceneInit(game_scene *Scene)
+{
+    Scene->Entities.clear();
+    BvhInit(&Scene->Tree);
+}
+
+void SceneFree(game_scene *Scene)
+{
+    Scene->Entities.clear();
+    BvhClear(&Scene->Tree);
+}
+
+uint32_t SceneAddEntity(game_scene *Scene, loaded_model *Model, transform Transform)
+{
+    uint32_t Index = (uint32_t)Scene->Entities.size();
+    game_entity& Entity = Scene->Entities.emplace_back();
+    Entity.Transform = Transform;
+    Entity.Model = Model;
+    TransformUpdate(&Entity.Transform);
+    EntityUpdateBounds(&Entity);
+    Entity.BvhProxy = BvhInsert(&Scene->Tree, Entity.Bounds, Index);
+    return Index;
+}
+
+void SceneMoveEntity(game_scene *Scene, uint32_t Entity)
+{
+    game_entity *Moved = &Scene->Entities[Entity];
+    TransformUpdate(&Moved->Transform);
+    EntityUpdateBounds(Moved);
+    BvhMove(&Scene->Tree, Moved->BvhProxy, Moved->Bounds);
+}
+
+void SceneQueryFrustum(const game_scene *Scene, const V4 *Planes, std::vector<uint32_t>& Results)
+{
+    Results.clear();
+    BvhQueryFrustum(&Scene->Tree, Planes, Results);
+}
+
+bvh_ray_hit ScenePick(const game_scene *Scene, V3 Origin, V3 Direction, float MaxDistance)
+{
+    // NOTE(amelie.h): The tree only knows the fat boxes, the callback tests the real bounds.
+    return BvhRaycast(&Scene->Tree, Origin, Direction, MaxDistance, [Scene](uint32_t UserData, V3 Origin, V3 Direction, float MaxDistance) {
+        V3 Inverse = HMM_Vec3(1.0f / Direction.X, 1.0f / Direction.Y, 1.0f / Direction.Z);
+        float Entry;
+        return AabbRay(Scene->Entities[UserData].Bounds, Origin, Inverse, MaxDistance, &Entry) ? Entry : -1.0f;
+    });
+}
+
+bool SceneBoxInFrustum(aabb Box, const V4 *Planes)
+{
+    V3 Center = HMM_MultiplyVec3f(HMM_AddVec3(Box.Min, Box.Max), 0.5f);
+    V3 Extent = HMM_MultiplyVec3f(HMM_SubtractVec3(Box.Max, Box.Min), 0.5f);
+    for (int Plane = 0; Plane < 6; Plane++)
+    {
+        V3 Normal = Planes[Plane].XYZ;
+        float Distance = HMM_DotVec3(Normal, Center) - Planes[Plane].W;
+        float Radius = fabsf(Normal.X) * Extent.X + fabsf(Normal.Y) * Extent.Y + fabsf(Normal.Z) * Extent.Z;
+        if (Distance + Radius < 0.0f)
+            return false;
+    }
+    return true;
+}
+
+uint32_t SceneCheckQueries(game_scene *Scene, camera_data *Camera, const char *Stage)
+{
+    uint32_t Failures = 0;
+
+    std::vector<uint32_t> Results;
+    SceneQueryFrustum(Scene, Camera->Planes, Results);
+    std::sort(Results.begin(), Results.end());
+    uint32_t Missed = 0;
+    uint32_t Visible = 0;
+    for (uint32_t Index = 0; Index < Scene->Entities.size(); Index++)
+    {
+        if (!SceneBoxInFrustum(Scene->Entities[Index].Bounds, Camera->Planes))
+            continue;
+        Visible++;
+        Missed += !std::binary_search(Results.begin(), Results.end(), Index);
+    }
+    if (Missed)
+    {
+        LogError("Scene: %s, frustum query missed %u of %u visible entities!", Stage, Missed, Visible);
+        Failures++;
+    }
+
+    // NOTE(amelie.h): One ray at every entity from the camera, the nearest box on the way has to be the one picked.
+    uint32_t WrongPicks = 0;
+    for (game_entity& Target : Scene->Entities)
+    {
+        V3 Center = HMM_MultiplyVec3f(HMM_AddVec3(Target.Bounds.Min, Target.Bounds.Max), 0.5f);
+        V3 Direction = HMM_SubtractVec3(Center, Camera->Position);
+        float Length = HMM_LengthVec3(Direction);
+        if (Length <= 0.0f)
+            continue;
+        Direction = HMM_DivideVec3f(Direction, Length);
+        V3 Inverse = HMM_Vec3(1.0f / Direction.X, 1.0f / Direction.Y, 1.0f / Direction.Z);
+
+        bvh_ray_hit Expected = { false, SCENE_VALIDATE_RAY_LENGTH, BVH_NULL_NODE };
+        for (uint32_t Index = 0; Index < Scene->Entities.size(); Index++)
+        {
+            float Entry;
+            if (AabbRay(Scene->Entities[Index].Bounds, Camera->Position, Inverse, Expected.Distance, &Entry))
+                Expected = { true, Entry, Index };
+        }
+
+        bvh_ray_hit Picked = ScenePick(Scene, Camera->Position, Direction, SCENE_VALIDATE_RAY_LENGTH);
+        bool Matches = Picked.Hit == Expected.Hit && fabsf(Picked.Distance - Expected.Distance) <= SCENE_VALIDATE_EPSILON;
+        if (!Matches && Picked.Hit && Picked.Distance < Expected.Distance)
+        {
+            // NOTE(amelie.h): The tree normalizes the direction again, a ray grazing the edge of a box can then go either
+            // way. A nearer pick is only wrong when it also misses the box grown by a hair.
+            V3 Margin = HMM_Vec3(SCENE_VALIDATE_EPSILON, SCENE_VALIDATE_EPSILON, SCENE_VALIDATE_EPSILON);
+            aabb Box = Scene->Entities[Picked.UserData].Bounds;
+            Box = { HMM_SubtractVec3(Box.Min, Margin), HMM_AddVec3(Box.Max, Margin) };
+            float Entry;
+            Matches = AabbRay(Box, Camera->Position, Inverse, SCENE_VALIDATE_RAY_LENGTH, &Entry) && Entry <= Picked.Distance;
+        }
+        WrongPicks += !Matches;
+    }
+    if (WrongPicks)
+    {
+        LogError("Scene: %s, %u of %zu picks don't match the linear ray test!", Stage, WrongPicks, Scene->Entities.size());
+        Failures++;
+    }
+
+    LogInfo("  %s: %zu entities, %zu from the frustum query for %u visible, tree height %d",
+            Stage, Scene->Entities.size(), Results.size(), Visible, BvhGetHeight(&Scene->Tree));
+    return Failures;
+}
+
+uint32_t SceneValidate(game_scene *Scene, camera_data *Camera)
+{
+    LogInfo("Scene Validation: %zu entities", Scene->Entities.size());
+    uint32_t Failures = SceneCheckQueries(Scene, Camera, "as placed");
+
+    // NOTE(amelie.h): Odd entities move a little and stay in their fat box, even ones jump far enough to be reinserted.
+    std::vector<V3> Positions;
+    for (uint32_t Index = 0; Index < Scene->Entities.size(); Index++)
+    {
+        Positions.push_back(Scene->Entities[Index].Transform.Position);
+        float Offset = (Index & 1) ? BVH_FAT_MARGIN * 0.5f : 7.0f * (float)(Index % 5) - 14.0f;
+        Scene->Entities[Index].Transform.Position = HMM_AddVec3(Positions[Index], HMM_Vec3(Offset, 0.0f, Offset * 0.5f));
+        SceneMoveEntity(Scene, Index);
+    }
+    Failures += SceneCheckQueries(Scene, Camera, "moved");
+
+    for (uint32_t Index = 0; Index < Scene->Entities.size(); Index++)
+    {
+        Scene->Entities[Index].Transform.Position = Positions[Index];
+        SceneMoveEntity(Scene, Index);
+    }
+    Failures += SceneCheckQueries(Scene, Camera, "moved back");
+
+    LogInfo("Scene Validation: %s", Failures ? "FAIL" : "PASS");
+    return Failures;
+}
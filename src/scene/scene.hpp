@@ -7,6 +7,9 @@
 
 #pragma once
 
+#include <vector>
+
+#include "bvh.hpp"
 #include "entity.hpp"
 
 struct camera_data
@@ -14,4 +17,28 @@ struct camera_data
     hmm_mat4 View;
     hmm_mat4 Projection;
     hmm_vec3 Position;
+    hmm_vec4 Planes[6]; // NOTE(amelie.h): World space frustum planes, see NoClipCameraUpdateFrustum.
+};
+
+// NOTE(amelie.h): Owns the entities and a BVH over their world bounds, every leaf's UserData is an entity index. Entity
+// indices don't change, there is no removal yet.
+struct game_scene
+{
+    std::vector<game_entity> Entities;
+    bvh Tree;
 };
+
+void SceneInit(game_scene *Scene);
+void SceneFree(game_scene *Scene);
+uint32_t SceneAddEntity(game_scene *Scene, loaded_model *Model, transform Transform);
+// NOTE(amelie.h): Call after changing the entity's transform, it updates the matrix, the bounds and the BVH leaf.
+void SceneMoveEntity(game_scene *Scene, uint32_t Entity);
+
+// NOTE(amelie.h): Entities whose leaf touches the frustum. Leaves are fattened, so a few entities just outside come back.
+void SceneQueryFrustum(const game_scene *Scene, const V4 *Planes, std::vector<uint32_t>& Results);
+// NOTE(amelie.h): Nearest entity whose bounds the ray hits, UserData is the entity index.
+bvh_ray_hit ScenePick(const game_scene *Scene, V3 Origin, V3 Direction, float MaxDistance);
+
+// NOTE(amelie.h): Moves the entities around and checks both queries against a linear scan of the entity bounds, then
+// puts them back. Returns the number of checks that failed.
+uint32_t SceneValidate(game_scene *Scene, camera_data *Camera);
@@ -7,7 +7,7 @@
 
 #include "file_system.hpp"
 
-#include <Windows.h>
+#include <sys/stat.h>
 #include <sstream>
 #include <fstream>
 
@@ -48,3 +48,12 @@ std::string FileRead(const std::string& Path)
     Stream.close();
     return StringStream.str();
 }
+
+std::string FileReplaceExtension(const std::string& Path, const std::string& Extension)
+{
+    size_t Dot = Path.find_last_of('.');
+    size_t Slash = Path.find_last_of("/\\");
+    if (Dot == std::string::npos || (Slash != std::string::npos && Dot < Slash))
+        return Path + Extension;
+    return Path.substr(0, Dot) + Extension;
+}
@@ -16,8 +16,21 @@ struct file_buffer
     std::vector<char> Data;
 };
 
+// NOTE(amelie.h): Read-only view of a whole file, backed by the OS page cache. Data stays valid until FileMappingClose.
+struct file_mapping
+{
+    const uint8_t *Data;
+    uint64_t Size;
+    void *Handle;
+    void *Mapping;
+};
+
 bool FileBufferExists(const std::string& Path);
 uint64_t FileBufferGetSize(const std::string& Path);
 void FileBufferRead(const std::string& Path, file_buffer *Buffer);
 
 std::string FileRead(const std::string& Path);
+std::string FileReplaceExtension(const std::string& Path, const std::string& Extension);
+
+bool FileMappingOpen(file_mapping *Mapping, const std::string& Path);
+void FileMappingClose(file_mapping *Mapping);
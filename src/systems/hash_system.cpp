@@ -0,0 +1,37 @@
+/**
+ *  Author: Amélie Heinrich
+ *  Company: Amélie Games
+ *  License: MIT
+ *  Create Time: 17/10/2026 17:00
+ */
+
+#include "hash_system.hpp"
+
+#include "file_system.hpp"
+
+uint64_t HashFNV1a(const void *Data, uint64_t Size, uint64_t Hash)
+{
+    const uint8_t *Bytes = (const uint8_t*)Data;
+    for (uint64_t Index = 0; Index < Size; Index++)
+    {
+        Hash ^= Bytes[Index];
+        Hash *= HASH_FNV1A_PRIME;
+    }
+    return Hash;
+}
+
+uint64_t HashString(const std::string& String, uint64_t Hash)
+{
+    return HashFNV1a(String.data(), String.size(), Hash);
+}
+
+uint64_t HashFile(const std::string& Path, uint64_t Hash)
+{
+    file_mapping Mapping;
+    if (!FileMappingOpen(&Mapping, Path))
+        return Hash;
+
+    Hash = HashFNV1a(Mapping.Data, Mapping.Size, Hash);
+    FileMappingClose(&Mapping);
+    return Hash;
+}
@@ -0,0 +1,19 @@
+/**
+ *  Author: Amélie Heinrich
+ *  Company: Amélie Games
+ *  License: MIT
+ *  Create Time: 17/10/2026 17:00
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#define HASH_FNV1A_OFFSET 0xCBF29CE484222325ull
+#define HASH_FNV1A_PRIME 0x00000100000001B3ull
+
+// NOTE(amelie.h): 64-bit FNV-1a. Pass a previous result as Hash to keep hashing across several buffers.
+uint64_t HashFNV1a(const void *Data, uint64_t Size, uint64_t Hash = HASH_FNV1A_OFFSET);
+uint64_t HashString(const std::string& String, uint64_t Hash = HASH_FNV1A_OFFSET);
+uint64_t HashFile(const std::string& Path, uint64_t Hash = HASH_FNV1A_OFFSET);
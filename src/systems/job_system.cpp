@@ -0,0 +1,330 @@
+/**
+ *  Author: Amélie Heinrich
+ *  Company: Amélie Games
+ *  License: MIT
+ *  Create Time: 17/10/2026 13:10
+ */
+
+#include "job_system.hpp"
+
+#include "log_system.hpp"
+#include "timer.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <condition_variable>
+#include <deque>
+#include <thread>
+
+struct job_queue
+{
+    std::mutex Lock;
+    std::deque<job> Jobs;
+};
+
+struct job_system
+{
+    std::vector<std::thread> Workers;
+    job_queue *Queues;
+    uint32_t ThreadCount;
+
+    std::atomic<bool> Running;
+    std::atomic<int32_t> PendingJobs;
+    std::atomic<int32_t> SleepingWorkers;
+    std::mutex WakeLock;
+    std::condition_variable WakeCondition;
+};
+
+job_system JobSystem;
+thread_local uint32_t JobThreadIndex = 0;
+
+void JobSystemPush(job& Job)
+{
+    job_queue *Queue = &JobSystem.Queues[JobThreadIndex];
+    {
+        std::lock_guard<std::mutex> Guard(Queue->Lock);
+        Queue->Jobs.push_back(Job);
+    }
+
+    JobSystem.PendingJobs++;
+    if (JobSystem.SleepingWorkers > 0)
+    {
+        std::lock_guard<std::mutex> Guard(JobSystem.WakeLock);
+        JobSystem.WakeCondition.notify_one();
+    }
+}
+
+// NOTE(amelie.h): Own queue is LIFO for cache warmth, stealing is FIFO so thieves take the oldest (usually biggest) work.
+bool JobSystemPop(job *Out)
+{
+    job_queue *Own = &JobSystem.Queues[JobThreadIndex];
+    {
+        std::lock_guard<std::mutex> Guard(Own->Lock);
+        if (!Own->Jobs.empty())
+        {
+            *Out = Own->Jobs.back();
+            Own->Jobs.pop_back();
+            JobSystem.PendingJobs--;
+            return true;
+        }
+    }
+
+    for (uint32_t Offset = 1; Offset < JobSystem.ThreadCount; Offset++)
+    {
+        job_queue *Victim = &JobSystem.Queues[(JobThreadIndex + Offset) % JobSystem.ThreadCount];
+        std::unique_lock<std::mutex> Guard(Victim->Lock, std::try_to_lock);
+        if (Guard.owns_lock() && !Victim->Jobs.empty())
+        {
+            *Out = Victim->Jobs.front();
+            Victim->Jobs.pop_front();
+            JobSystem.PendingJobs--;
+            return true;
+        }
+    }
+    return false;
+}
+
+void JobCounterRelease(job_counter *Counter)
+{
+    if (!Counter)
+        return;
+
+    // NOTE(amelie.h): The final decrement happens under the lock, JobSystemWait takes the same lock before
+    // returning so the counter can't go out of scope while we're still draining its continuations.
+    int32_t Value = Counter->Value.load();
+    while (Value > 1)
+    {
+        if (Counter->Value.compare_exchange_weak(Value, Value - 1))
+            return;
+    }
+
+    std::vector<job> Continuations;
+    {
+        std::lock_guard<std::mutex> Guard(Counter->Lock);
+        if (Counter->Value.fetch_sub(1) == 1)
+            Continuations.swap(Counter->Continuations);
+    }
+    for (auto& Continuation : Continuations)
+        JobSystemPush(Continuation);
+}
+
+bool JobSystemExecuteOne()
+{
+    job Job;
+    if (!JobSystemPop(&Job))
+        return false;
+
+    if (Job.RangeFunction)
+        Job.RangeFunction(Job.Data, Job.Start, Job.End);
+    else
+        Job.Function(Job.Data);
+    JobCounterRelease(Job.Counter);
+    return true;
+}
+
+void JobSystemWorker(uint32_t Index)
+{
+    JobThreadIndex = Index;
+    while (JobSystem.Running)
+    {
+        if (JobSystemExecuteOne())
+            continue;
+
+        std::unique_lock<std::mutex> Guard(JobSystem.WakeLock);
+        JobSystem.SleepingWorkers++;
+        JobSystem.WakeCondition.wait(Guard, []() { return JobSystem.PendingJobs > 0 || !JobSystem.Running; });
+        JobSystem.SleepingWorkers--;
+    }
+}
+
+void JobSystemInit(uint32_t ThreadCount)
+{
+    if (ThreadCount == 0)
+        ThreadCount = std::max(std::thread::hardware_concurrency(), 1u);
+
+    JobSystem.ThreadCount = ThreadCount;
+    JobSystem.Queues = new job_queue[ThreadCount];
+    JobSystem.Running = true;
+    JobSystem.PendingJobs = 0;
+    JobSystem.SleepingWorkers = 0;
+    JobThreadIndex = 0;
+
+    for (uint32_t Index = 1; Index < ThreadCount; Index++)
+        JobSystem.Workers.emplace_back(JobSystemWorker, Index);
+
+    LogInfo("Job System: Running on %u threads", ThreadCount);
+}
+
+void JobSystemExit()
+{
+    {
+        std::lock_guard<std::mutex> Guard(JobSystem.WakeLock);
+        JobSystem.Running = false;
+        JobSystem.WakeCondition.notify_all();
+    }
+    for (auto& Worker : JobSystem.Workers)
+        Worker.join();
+    JobSystem.Workers.clear();
+    delete[] JobSystem.Queues;
+    JobSystem.Queues = nullptr;
+}
+
+uint32_t JobSystemThreadCount()
+{
+    return JobSystem.ThreadCount;
+}
+
+uint32_t JobSystemThreadIndex()
+{
+    return JobThreadIndex;
+}
+
+void JobSystemRun(job_counter *Counter, PFN_Job Function, void *Data)
+{
+    job Job = {};
+    Job.Function = Function;
+    Job.Data = Data;
+    Job.Counter = Counter;
+    if (Counter)
+        Counter->Value++;
+    JobSystemPush(Job);
+}
+
+void JobSystemRunAfter(job_counter *Dependency, job_counter *Counter, PFN_Job Function, void *Data)
+{
+    job Job = {};
+    Job.Function = Function;
+    Job.Data = Data;
+    Job.Counter = Counter;
+    if (Counter)
+        Counter->Value++;
+
+    {
+        std::lock_guard<std::mutex> Guard(Dependency->Lock);
+        if (Dependency->Value > 0)
+        {
+            Dependency->Continuations.push_back(Job);
+            return;
+        }
+    }
+    JobSystemPush(Job);
+}
+
+void ParallelFor(job_counter *Counter, uint32_t Count, uint32_t BatchSize, PFN_JobRange Function, void *Data)
+{
+    if (Count == 0)
+        return;
+    if (BatchSize == 0)
+        BatchSize = std::max(Count / (JobSystem.ThreadCount * 4), 1u);
+
+    for (uint32_t Start = 0; Start < Count; Start += BatchSize)
+    {
+        job Job = {};
+        Job.RangeFunction = Function;
+        Job.Data = Data;
+        Job.Start = Start;
+        Job.End = std::min(Start + BatchSize, Count);
+        Job.Counter = Counter;
+        Counter->Value++;
+        JobSystemPush(Job);
+    }
+}
+
+void JobSystemWait(job_counter *Counter)
+{
+    while (Counter->Value > 0)
+    {
+        if (!JobSystemExecuteOne())
+            std::this_thread::yield();
+    }
+
+    std::lock_guard<std::mutex> Guard(Counter->Lock);
+}
+
+//~ NOTE(amelie.h): Benchmark
+
+// NOTE(amelie.h): Only counts itself so the benchmark can tell whether a job got lost or ran twice.
+void BenchmarkEmptyJob(void *Data)
+{
+    ((std::atomic<uint32_t>*)Data)->fetch_add(1, std::memory_order_relaxed);
+}
+
+void BenchmarkWorkRange(void *Data, uint32_t Start, uint32_t End)
+{
+    float *Output = (float*)Data;
+    for (uint32_t Index = Start; Index < End; Index++)
+    {
+        float Value = (float)Index;
+        for (int Iteration = 0; Iteration < 64; Iteration++)
+            Value = sqrtf(Value + 1.0f) * 1.0001f;
+        Output[Index] = Value;
+    }
+}
+
+uint32_t JobSystemBenchmark()
+{
+    const uint32_t EmptyJobCount = 100'000;
+    const uint32_t WorkItemCount = 1 << 20;
+
+    uint32_t DefaultThreads = JobSystem.ThreadCount;
+    uint32_t MaxThreads = std::max(std::thread::hardware_concurrency(), 1u);
+    std::vector<float> Output(WorkItemCount);
+    std::vector<float> Expected(WorkItemCount);
+    BenchmarkWorkRange(Expected.data(), 0, WorkItemCount);
+    double SingleThreadMs = 0.0;
+    uint32_t Failures = 0;
+
+    LogInfo("Job System Benchmark: %u empty jobs, ParallelFor over %u items", EmptyJobCount, WorkItemCount);
+    std::vector<uint32_t> ThreadCounts;
+    for (uint32_t Threads = 1; Threads < MaxThreads; Threads *= 2)
+        ThreadCounts.push_back(Threads);
+    ThreadCounts.push_back(MaxThreads);
+
+    JobSystemExit();
+    for (uint32_t Threads : ThreadCounts)
+    {
+        JobSystemInit(Threads);
+
+        job_counter Counter;
+        std::atomic<uint32_t> Executed(0);
+        timer Timer;
+        TimerInit(&Timer);
+        for (uint32_t Index = 0; Index < EmptyJobCount; Index++)
+            JobSystemRun(&Counter, BenchmarkEmptyJob, &Executed);
+        JobSystemWait(&Counter);
+        double EmptyMs = NanosecondsToMilliseconds(TimerGetElapsedNanoseconds(&Timer));
+        if (Executed.load() != EmptyJobCount || Counter.Value.load() != 0)
+        {
+            LogError("Job System Benchmark: %u threads ran %u of %u jobs and left the counter at %d!", Threads, Executed.load(), EmptyJobCount, Counter.Value.load());
+            Failures++;
+        }
+
+        // NOTE(amelie.h): Every item starts out wrong, so a range that never ran shows up as a mismatch.
+        std::fill(Output.begin(), Output.end(), -1.0f);
+        TimerRestart(&Timer);
+        ParallelFor(&Counter, WorkItemCount, 4096, BenchmarkWorkRange, Output.data());
+        JobSystemWait(&Counter);
+        double WorkMs = NanosecondsToMilliseconds(TimerGetElapsedNanoseconds(&Timer));
+        if (Threads == 1)
+            SingleThreadMs = WorkMs;
+
+        uint32_t Missing = 0;
+        for (uint32_t Index = 0; Index < WorkItemCount; Index++)
+            if (Output[Index] != Expected[Index])
+                Missing++;
+        if (Missing || Counter.Value.load() != 0)
+        {
+            LogError("Job System Benchmark: %u threads left %u of %u ParallelFor items unwritten and the counter at %d!", Threads, Missing, WorkItemCount, Counter.Value.load());
+            Failures++;
+        }
+
+        LogInfo("  %2u threads | %.1f ns/job overhead | ParallelFor %.3fms (%.2fx)",
+                Threads, (EmptyMs * 1'000'000.0) / EmptyJobCount, WorkMs, SingleThreadMs / WorkMs);
+
+        JobSystemExit();
+    }
+    JobSystemInit(DefaultThreads);
+
+    LogInfo("Job System Benchmark: %s", Failures ? "FAIL" : "PASS");
+    return Failures;
+}
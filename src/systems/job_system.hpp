@@ -0,0 +1,54 @@
+/**
+ *  Author: Amélie Heinrich
+ *  Company: Amélie Games
+ *  License: MIT
+ *  Create Time: 17/10/2026 13:05
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+typedef void (*PFN_Job)(void *Data);
+typedef void (*PFN_JobRange)(void *Data, uint32_t Start, uint32_t End);
+
+struct job_counter;
+
+struct job
+{
+    PFN_Job Function;
+    PFN_JobRange RangeFunction;
+    void *Data;
+    uint32_t Start;
+    uint32_t End;
+    job_counter *Counter;
+};
+
+// NOTE(amelie.h): Counts the jobs still in flight. Continuations queued with JobSystemRunAfter are released when it hits zero.
+struct job_counter
+{
+    std::atomic<int32_t> Value;
+    std::mutex Lock;
+    std::vector<job> Continuations;
+
+    job_counter() : Value(0) {}
+};
+
+// NOTE(amelie.h): ThreadCount includes the calling thread, 0 picks one thread per hardware core.
+void JobSystemInit(uint32_t ThreadCount = 0);
+void JobSystemExit();
+uint32_t JobSystemThreadCount();
+uint32_t JobSystemThreadIndex();
+
+void JobSystemRun(job_counter *Counter, PFN_Job Function, void *Data);
+void JobSystemRunAfter(job_counter *Dependency, job_counter *Counter, PFN_Job Function, void *Data);
+void ParallelFor(job_counter *Counter, uint32_t Count, uint32_t BatchSize, PFN_JobRange Function, void *Data);
+
+// NOTE(amelie.h): The waiting thread executes queued jobs until the counter drains.
+void JobSystemWait(job_counter *Counter);
+
+// NOTE(amelie.h): Returns how many thread counts lost or repeated work.
+uint32_t JobSystemBenchmark();
@@ -0,0 +1,54 @@
+/**
+ *  Author: Amélie Heinrich
+ *  Company: Amélie Games
+ *  License: MIT
+ *  Create Time: 17/10/2026 16:30
+ */
+
+#include "systems/file_system.hpp"
+
+#include "systems/log_system.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+bool FileMappingOpen(file_mapping *Mapping, const std::string& Path)
+{
+    *Mapping = {};
+
+    int File = open(Path.c_str(), O_RDONLY);
+    if (File < 0)
+    {
+        LogError("Failed to open file %s for mapping!", Path.c_str());
+        return false;
+    }
+
+    struct stat Stat;
+    if (fstat(File, &Stat) != 0 || Stat.st_size == 0)
+    {
+        LogError("Failed to map empty or unreadable file %s!", Path.c_str());
+        close(File);
+        return false;
+    }
+
+    void *Data = mmap(nullptr, Stat.st_size, PROT_READ, MAP_PRIVATE, File, 0);
+    close(File);
+    if (Data == MAP_FAILED)
+    {
+        LogError("Failed to map file %s!", Path.c_str());
+        return false;
+    }
+
+    Mapping->Data = (const uint8_t*)Data;
+    Mapping->Size = Stat.st_size;
+    return true;
+}
+
+void FileMappingClose(file_mapping *Mapping)
+{
+    if (Mapping->Data)
+        munmap((void*)Mapping->Data, Mapping->Size);
+    *Mapping = {};
+}
@@ -0,0 +1,35 @@
+/**
+ *  Author: Amélie Heinrich
+ *  Company: Amélie Games
+ *  License: MIT
+ *  Create Time: 17/10/2026 11:10
+ */
+
+#include "systems/input_system.hpp"
+
+// NOTE(amelie.h): The Linux build is headless for now, so there is no input to poll.
+
+bool IsKeyPressed(keyboard_key Key)
+{
+    return false;
+}
+
+bool IsKeyReleased(keyboard_key Key)
+{
+    return !IsKeyPressed(Key);
+}
+
+bool IsMouseButtonPressed(mouse_button Button)
+{
+    return false;
+}
+
+bool IsMouseButtonReleased(mouse_button Button)
+{
+    return !IsMouseButtonPressed(Button);
+}
+
+V2 GetMousePosition()
+{
+    return HMM_Vec2(0.0f, 0.0f);
+}
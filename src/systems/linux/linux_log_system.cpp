@@ -0,0 +1,71 @@
+/**
+ *  Author: Amélie Heinrich
+ *  Company: Amélie Games
+ *  License: MIT
+ *  Create Time: 17/10/2026 11:12
+ */
+
+#include "systems/log_system.hpp"
+
+#include "game_data.hpp"
+#include "gui/dev_terminal.hpp"
+
+#include <stdarg.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <fstream>
+
+log_buffer LogBuffer;
+
+void LogOutput(log_level Level, const char *Message, ...)
+{
+    if (Level == log_level::Debug && EgcB32(EgcFile, "debug_enabled") == false)
+        return;
+
+    const char* LevelStrings[6] = {"[FATAL]: ", "[ERROR]: ", "[WARN]:  ", "[INFO]:  ", "[DEBUG]: ", "[TRACE]: "};
+    bool IsError = Level < log_level::Warn;
+	
+    char OutMessage[32000] = {0};
+	
+    va_list ArgPointer;
+    va_start(ArgPointer, Message);
+    vsnprintf(OutMessage, 32000, Message, ArgPointer);
+    va_end(ArgPointer);
+	
+    // NOTE(amelie.h): Room for the level prefix and the newline on top of a full message, so nothing gets cut.
+    char FinalMessage[sizeof(OutMessage) + 16];
+    snprintf(FinalMessage, sizeof(FinalMessage), "%s%s\n", LevelStrings[static_cast<uint16_t>(Level)], OutMessage);
+
+    std::string Line(FinalMessage);
+    LogBuffer.LogTracker.push_back(Line);
+
+    // NOTE(amelie.h): Only colorize when attached to a terminal, CI logs stay plain.
+    FILE *Stream = IsError ? stderr : stdout;
+    static const char *Colors[6] = {"\033[41;97m", "\033[31m", "\033[33m", "\033[32m", "\033[34m", "\033[90m"};
+    if (isatty(fileno(Stream)))
+        fprintf(Stream, "%s%s\033[0m", Colors[static_cast<uint16_t>(Level)], FinalMessage);
+    else
+        fputs(FinalMessage, Stream);
+
+    DevTerminalAddLog("%s", FinalMessage);
+}
+
+void LogResetColor()
+{
+    if (isatty(fileno(stdout)))
+        fputs("\033[0m", stdout);
+    if (isatty(fileno(stderr)))
+        fputs("\033[0m", stderr);
+    fflush(stdout);
+    fflush(stderr);
+}
+
+void LogSaveFile(const std::string& Path)
+{
+    std::ofstream LogFile(Path, std::ios::trunc);
+    for (auto& Line : LogBuffer.LogTracker)
+        LogFile << Line;
+    LogFile.close();
+}
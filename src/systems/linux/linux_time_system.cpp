@@ -0,0 +1,17 @@
+/**
+ *  Author: Amélie Heinrich
+ *  Company: Amélie Games
+ *  License: MIT
+ *  Create Time: 17/10/2026 11:06
+ */
+
+#include "systems/time_system.hpp"
+
+#include <time.h>
+
+uint64_t TimeGetNanoseconds()
+{
+    timespec Time;
+    clock_gettime(CLOCK_MONOTONIC, &Time);
+    return (uint64_t)Time.tv_sec * 1'000'000'000 + (uint64_t)Time.tv_nsec;
+}
@@ -0,0 +1,13 @@
+/**
+ *  Author: Amélie Heinrich
+ *  Company: Amélie Games
+ *  License: MIT
+ *  Create Time: 17/10/2026 11:05
+ */
+
+#pragma once
+
+#include <cstdint>
+
+// NOTE(amelie.h): Monotonic wall clock, unaffected by system time changes.
+uint64_t TimeGetNanoseconds();
@@ -0,0 +1,66 @@
+/**
+ *  Author: Amélie Heinrich
+ *  Company: Amélie Games
+ *  License: MIT
+ *  Create Time: 17/10/2026 16:35
+ */
+
+#include "systems/file_system.hpp"
+
+#include "systems/log_system.hpp"
+
+#include <Windows.h>
+
+bool FileMappingOpen(file_mapping *Mapping, const std::string& Path)
+{
+    *Mapping = {};
+
+    HANDLE File = CreateFileA(Path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (File == INVALID_HANDLE_VALUE)
+    {
+        LogError("Failed to open file %s for mapping!", Path.c_str());
+        return false;
+    }
+
+    LARGE_INTEGER Size;
+    if (!GetFileSizeEx(File, &Size) || Size.QuadPart == 0)
+    {
+        LogError("Failed to map empty or unreadable file %s!", Path.c_str());
+        CloseHandle(File);
+        return false;
+    }
+
+    HANDLE FileMapping = CreateFileMappingA(File, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!FileMapping)
+    {
+        LogError("Failed to create file mapping for %s!", Path.c_str());
+        CloseHandle(File);
+        return false;
+    }
+
+    void *Data = MapViewOfFile(FileMapping, FILE_MAP_READ, 0, 0, 0);
+    if (!Data)
+    {
+        LogError("Failed to map view of file %s!", Path.c_str());
+        CloseHandle(FileMapping);
+        CloseHandle(File);
+        return false;
+    }
+
+    Mapping->Data = (const uint8_t*)Data;
+    Mapping->Size = Size.QuadPart;
+    Mapping->Handle = File;
+    Mapping->Mapping = FileMapping;
+    return true;
+}
+
+void FileMappingClose(file_mapping *Mapping)
+{
+    if (Mapping->Data)
+        UnmapViewOfFile(Mapping->Data);
+    if (Mapping->Mapping)
+        CloseHandle((HANDLE)Mapping->Mapping);
+    if (Mapping->Handle)
+        CloseHandle((HANDLE)Mapping->Handle);
+    *Mapping = {};
+}
@@ -0,0 +1,25 @@
+/**
+ *  Author: Amélie Heinrich
+ *  Company: Amélie Games
+ *  License: MIT
+ *  Create Time: 17/10/2026 11:08
+ */
+
+#include "systems/time_system.hpp"
+
+#include <Windows.h>
+
+uint64_t TimeGetNanoseconds()
+{
+    static LARGE_INTEGER Frequency = {};
+    if (Frequency.QuadPart == 0)
+        QueryPerformanceFrequency(&Frequency);
+
+    LARGE_INTEGER Counter;
+    QueryPerformanceCounter(&Counter);
+
+    // NOTE(amelie.h): Split to avoid overflowing Counter * 1e9 after a few days of uptime.
+    uint64_t Seconds = Counter.QuadPart / Frequency.QuadPart;
+    uint64_t Remainder = Counter.QuadPart % Frequency.QuadPart;
+    return Seconds * 1'000'000'000 + (Remainder * 1'000'000'000) / Frequency.QuadPart;
+}
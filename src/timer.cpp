@@ -7,19 +7,64 @@
 
 #include "timer.hpp"
 
-#include <ctime>
+#include "systems/time_system.hpp"
+
+#include <algorithm>
 
 void TimerInit(timer *Timer)
 {   
-    Timer->start = clock();
+    Timer->Start = TimeGetNanoseconds();
+}
+
+uint64_t TimerGetElapsedNanoseconds(timer *Timer)
+{
+    return TimeGetNanoseconds() - Timer->Start;
 }
 
 float TimerGetElapsed(timer *Timer)
 {
-    return clock() - Timer->start;
+    return (float)NanosecondsToMilliseconds(TimerGetElapsedNanoseconds(Timer));
 }
 
 void TimerRestart(timer *Timer)
 {
-    Timer->start = clock();
+    Timer->Start = TimeGetNanoseconds();
+}
+
+void FrameStatsInit(frame_stats *Stats, uint32_t Window)
+{
+    Stats->History.assign(Window, 0.0f);
+    Stats->Head = 0;
+    Stats->Count = 0;
+}
+
+void FrameStatsPush(frame_stats *Stats, float Milliseconds)
+{
+    Stats->History[Stats->Head] = Milliseconds;
+    Stats->Head = (Stats->Head + 1) % Stats->History.size();
+    Stats->Count = std::min(Stats->Count + 1, (uint32_t)Stats->History.size());
+}
+
+frame_stats_summary FrameStatsSummarize(frame_stats *Stats)
+{
+    frame_stats_summary Summary = {};
+    Summary.Samples = Stats->Count;
+    if (Stats->Count == 0)
+        return (Summary);
+
+    // NOTE(amelie.h): Until the window is full the valid samples are the first Count entries.
+    std::vector<float> Sorted(Stats->History.begin(), Stats->History.begin() + Stats->Count);
+    std::sort(Sorted.begin(), Sorted.end());
+
+    double Total = 0.0;
+    for (float Sample : Sorted)
+        Total += Sample;
+
+    uint32_t P99Index = std::min((uint32_t)(Sorted.size() * 0.99f), (uint32_t)Sorted.size() - 1);
+
+    Summary.Min = Sorted.front();
+    Summary.Max = Sorted.back();
+    Summary.Average = (float)(Total / Sorted.size());
+    Summary.P99 = Sorted[P99Index];
+    return (Summary);
 }
@@ -7,13 +7,40 @@
 
 #pragma once
 
+#include <cstdint>
+#include <vector>
+
 #define ToSeconds(Value) Value / 1000.0f
+#define NanosecondsToMilliseconds(Value) ((Value) / 1'000'000.0)
 
 struct timer
 {
-    float start;
+    uint64_t Start;
 };
 
 void TimerInit(timer *Timer);
+uint64_t TimerGetElapsedNanoseconds(timer *Timer);
+// NOTE(amelie.h): Milliseconds, kept as float for the existing callers.
 float TimerGetElapsed(timer *Timer);
 void TimerRestart(timer *Timer);
+
+struct frame_stats_summary
+{
+    float Min;
+    float Average;
+    float Max;
+    float P99;
+    uint32_t Samples;
+};
+
+// NOTE(amelie.h): Rolling window of frame times in milliseconds.
+struct frame_stats
+{
+    std::vector<float> History;
+    uint32_t Head;
+    uint32_t Count;
+};
+
+void FrameStatsInit(frame_stats *Stats, uint32_t Window);
+void FrameStatsPush(frame_stats *Stats, float Milliseconds);
+frame_stats_summary FrameStatsSummarize(frame_stats *Stats);
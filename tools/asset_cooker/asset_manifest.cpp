@@ -0,0 +1,75 @@
+/**
+ *  Author: Amélie Heinrich
+ *  Company: Amélie Games
+ *  License: MIT
+ *  Create Time: 17/10/2026 17:15
+ */
+
+#include "asset_manifest.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <vector>
+
+#include "systems/file_system.hpp"
+#include "systems/log_system.hpp"
+
+void AssetManifestLoad(asset_manifest *Manifest, const std::string& Path)
+{
+    Manifest->Entries.clear();
+
+    std::ifstream Stream(Path);
+    if (!Stream.is_open())
+        return;
+
+    std::string Line;
+    while (std::getline(Stream, Line))
+    {
+        size_t First = Line.find('\t');
+        size_t Second = Line.find('\t', First + 1);
+        if (First != 16 || Second == std::string::npos)
+        {
+            LogWarn("Asset manifest: Skipping malformed line \"%s\"", Line.c_str());
+            continue;
+        }
+
+        asset_manifest_entry Entry;
+        Entry.Hash = strtoull(Line.substr(0, First).c_str(), nullptr, 16);
+        Entry.Cooked = Line.substr(Second + 1);
+        Manifest->Entries[Line.substr(First + 1, Second - First - 1)] = Entry;
+    }
+}
+
+void AssetManifestSave(asset_manifest *Manifest, const std::string& Path)
+{
+    // NOTE(amelie.h): Sorted so the manifest diffs cleanly between runs.
+    std::vector<std::string> Sources;
+    for (auto& Entry : Manifest->Entries)
+        Sources.push_back(Entry.first);
+    std::sort(Sources.begin(), Sources.end());
+
+    std::ofstream Stream(Path, std::ios::trunc);
+    if (!Stream.is_open())
+    {
+        LogError("Asset manifest: Failed to open %s for writing!", Path.c_str());
+        return;
+    }
+
+    char Hash[17];
+    for (auto& Source : Sources)
+    {
+        asset_manifest_entry& Entry = Manifest->Entries[Source];
+        snprintf(Hash, sizeof(Hash), "%016llx", (unsigned long long)Entry.Hash);
+        Stream << Hash << '\t' << Source << '\t' << Entry.Cooked << '\n';
+    }
+}
+
+bool AssetManifestUpToDate(asset_manifest *Manifest, const std::string& Source, uint64_t Hash)
+{
+    auto Iterator = Manifest->Entries.find(Source);
+    if (Iterator == Manifest->Entries.end())
+        return false;
+    return Iterator->second.Hash == Hash && FileBufferExists(Iterator->second.Cooked);
+}
@@ -0,0 +1,29 @@
+/**
+ *  Author: Amélie Heinrich
+ *  Company: Amélie Games
+ *  License: MIT
+ *  Create Time: 17/10/2026 17:15
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+
+struct asset_manifest_entry
+{
+    uint64_t Hash;
+    std::string Cooked;
+};
+
+// NOTE(amelie.h): One tab separated line per source asset: hash, source path, cooked path. The hash covers the source, the files it
+// references and the cooker version, so an asset is only cooked again when one of those changes.
+struct asset_manifest
+{
+    std::unordered_map<std::string, asset_manifest_entry> Entries;
+};
+
+void AssetManifestLoad(asset_manifest *Manifest, const std::string& Path);
+void AssetManifestSave(asset_manifest *Manifest, const std::string& Path);
+bool AssetManifestUpToDate(asset_manifest *Manifest, const std::string& Source, uint64_t Hash);
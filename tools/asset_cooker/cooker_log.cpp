@@ -0,0 +1,25 @@
+/**
+ *  Author: Amélie Heinrich
+ *  Company: Amélie Games
+ *  License: MIT
+ *  Create Time: 17/10/2026 17:20
+ */
+
+#include "systems/log_system.hpp"
+
+#include <stdarg.h>
+#include <stdio.h>
+
+// NOTE(amelie.h): The engine logger pulls in the dev terminal and config, the cooker only needs plain console output.
+void LogOutput(log_level Level, const char *Message, ...)
+{
+    const char* LevelStrings[6] = {"[FATAL]: ", "[ERROR]: ", "[WARN]:  ", "[INFO]:  ", "[DEBUG]: ", "[TRACE]: "};
+    FILE *Stream = Level < log_level::Warn ? stderr : stdout;
+
+    va_list ArgPointer;
+    va_start(ArgPointer, Message);
+    fputs(LevelStrings[static_cast<uint16_t>(Level)], Stream);
+    vfprintf(Stream, Message, ArgPointer);
+    fputc('\n', Stream);
+    va_end(ArgPointer);
+}
@@ -0,0 +1,197 @@
+/**
+ *  Author: Amélie Heinrich
+ *  Company: Amélie Games
+ *  License: MIT
+ *  Create Time: 17/10/2026 17:20
+ */
+
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "asset_manifest.hpp"
+#include "mesh_cooker.hpp"
+#include "texture_cooker.hpp"
+
+#include "renderer/image_format.hpp"
+#include "renderer/mesh_format.hpp"
+#include "systems/file_system.hpp"
+#include "systems/hash_system.hpp"
+#include "systems/log_system.hpp"
+#include "timer.hpp"
+
+#define ASSET_COOKER_VERSION 4
+#define ASSET_COOKER_MANIFEST "cooked_manifest.txt"
+
+enum class asset_type
+{
+    Unknown,
+    Mesh,
+    Texture
+};
+
+asset_type AssetGetType(const std::string& Extension)
+{
+    if (Extension == ".gltf" || Extension == ".glb" || Extension == ".obj" || Extension == ".fbx")
+        return asset_type::Mesh;
+    if (Extension == ".png" || Extension == ".jpg" || Extension == ".jpeg" || Extension == ".tga" || Extension == ".hdr")
+        return asset_type::Texture;
+    return asset_type::Unknown;
+}
+
+// NOTE(amelie.h): Files a source pulls in at import time (glTF buffers, OBJ material libraries). They go into the
+// hash so editing a .bin alone still triggers a recook. Images are left out, they are cooked as their own assets.
+std::vector<std::string> AssetGetDependencies(const std::string& Path, const std::string& Extension)
+{
+    std::vector<std::string> Dependencies;
+    if (Extension != ".gltf" && Extension != ".obj")
+        return Dependencies;
+
+    std::string Directory = std::filesystem::path(Path).parent_path().generic_string();
+    std::string Source = FileRead(Path);
+    const char *Key = Extension == ".gltf" ? "\"uri\"" : "mtllib ";
+
+    for (size_t Cursor = Source.find(Key); Cursor != std::string::npos; Cursor = Source.find(Key, Cursor + 1))
+    {
+        std::string Name;
+        if (Extension == ".gltf")
+        {
+            size_t Start = Source.find('"', Source.find(':', Cursor + 5));
+            size_t End = Source.find('"', Start + 1);
+            if (Start == std::string::npos || End == std::string::npos)
+                break;
+            Name = Source.substr(Start + 1, End - Start - 1);
+        }
+        else
+        {
+            size_t Start = Cursor + strlen(Key);
+            Name = Source.substr(Start, Source.find_first_of("\r\n", Start) - Start);
+        }
+
+        std::string Dependency = Directory + '/' + Name;
+        if (Name.rfind("data:", 0) == 0 || AssetGetType(std::filesystem::path(Name).extension().string()) == asset_type::Texture)
+            continue;
+        if (FileBufferExists(Dependency))
+            Dependencies.push_back(Dependency);
+    }
+    return Dependencies;
+}
+
+uint64_t AssetHash(const std::string& Path, const std::string& Extension, mesh_vertex_format Format)
+{
+    uint32_t Versions[4] = { ASSET_COOKER_VERSION, MESH_FILE_VERSION, IMAGE_FILE_VERSION, (uint32_t)Format };
+
+    uint64_t Hash = HashFNV1a(Versions, sizeof(Versions));
+    Hash = HashFile(Path, Hash);
+    for (auto& Dependency : AssetGetDependencies(Path, Extension))
+        Hash = HashFile(Dependency, Hash);
+    return Hash;
+}
+
+void PrintUsage()
+{
+    std::cout << "USAGE" << std::endl;
+    std::cout << "\t./asset_cooker [directory] [-f] [-v full|packed|quantized]" << std::endl;
+    std::cout << "DESCRIPTION" << std::endl;
+    std::cout << "\tdirectory The asset directory to cook, defaults to assets." << std::endl;
+    std::cout << "FLAGS" << std::endl;
+    std::cout << "\t-f Cook every asset, ignoring the manifest." << std::endl;
+    std::cout << "\t-v Vertex format of cooked meshes, defaults to packed." << std::endl;
+}
+
+int main(int argc, char **argv)
+{
+    std::string Directory = "assets";
+    bool Force = false;
+    mesh_vertex_format Format = mesh_vertex_format::Packed;
+    for (int Argument = 1; Argument < argc; Argument++)
+    {
+        if (strcmp(argv[Argument], "-h") == 0)
+        {
+            PrintUsage();
+            return 0;
+        }
+        if (strcmp(argv[Argument], "-f") == 0)
+            Force = true;
+        else if (strcmp(argv[Argument], "-v") == 0 && Argument + 1 < argc)
+        {
+            const char *Name = argv[++Argument];
+            if (strcmp(Name, "full") == 0)
+                Format = mesh_vertex_format::Full;
+            else if (strcmp(Name, "packed") == 0)
+                Format = mesh_vertex_format::Packed;
+            else if (strcmp(Name, "quantized") == 0)
+                Format = mesh_vertex_format::Quantized;
+            else
+            {
+                std::cout << "Invalid vertex format! ./asset_cooker -h for help" << std::endl;
+                return -1;
+            }
+        }
+        else
+            Directory = argv[Argument];
+    }
+
+    if (!std::filesystem::is_directory(Directory))
+    {
+        std::cout << "Invalid directory! " << Directory << std::endl;
+        return -1;
+    }
+
+    timer Timer;
+    TimerInit(&Timer);
+
+    std::string ManifestPath = Directory + "/" + ASSET_COOKER_MANIFEST;
+    asset_manifest Manifest;
+    if (!Force)
+        AssetManifestLoad(&Manifest, ManifestPath);
+
+    std::vector<std::string> Sources;
+    for (auto& File : std::filesystem::recursive_directory_iterator(Directory))
+        if (File.is_regular_file() && AssetGetType(File.path().extension().string()) != asset_type::Unknown)
+            Sources.push_back(File.path().generic_string());
+
+    uint32_t Cooked = 0;
+    uint32_t Skipped = 0;
+    uint32_t Failed = 0;
+    asset_manifest Output;
+    for (auto& Source : Sources)
+    {
+        std::string Extension = std::filesystem::path(Source).extension().string();
+        asset_type Type = AssetGetType(Extension);
+        std::string Destination = FileReplaceExtension(Source, Type == asset_type::Mesh ? ".mesh" : ".tex");
+
+        uint64_t Hash = AssetHash(Source, Extension, Type == asset_type::Mesh ? Format : mesh_vertex_format::Full);
+        if (AssetManifestUpToDate(&Manifest, Source, Hash))
+        {
+            Output.Entries[Source] = Manifest.Entries[Source];
+            Skipped++;
+            continue;
+        }
+
+        bool Result = Type == asset_type::Mesh ? MeshCook(Source, Destination, Format) : TextureCook(Source, Destination);
+        if (!Result)
+        {
+            Failed++;
+            continue;
+        }
+        Output.Entries[Source] = { Hash, Destination };
+        Cooked++;
+    }
+
+    // NOTE(amelie.h): Sources that disappeared since the last run take their cooked file with them.
+    for (auto& Entry : Manifest.Entries)
+    {
+        if (Output.Entries.find(Entry.first) == Output.Entries.end() && !FileBufferExists(Entry.first) && FileBufferExists(Entry.second.Cooked))
+        {
+            LogInfo("Removing stale cooked asset %s", Entry.second.Cooked.c_str());
+            std::filesystem::remove(Entry.second.Cooked);
+        }
+    }
+
+    AssetManifestSave(&Output, ManifestPath);
+    LogInfo("Asset cooker: %u cooked, %u up to date, %u failed in %.2fms", Cooked, Skipped, Failed, TimerGetElapsed(&Timer));
+    return Failed ? -1 : 0;
+}
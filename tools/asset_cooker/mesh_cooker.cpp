@@ -0,0 +1,250 @@
+/**
+ *  Author: Amélie Heinrich
+ *  Company: Amélie Games
+ *  License: MIT
+ *  Create Time: 17/10/2026 16:55
+ */
+
+#include "mesh_cooker.hpp"
+#include "mesh_optimizer.hpp"
+#include "vertex_encoder.hpp"
+
+#include <assimp/Importer.hpp>
+#include <assimp/scene.h>
+#include <assimp/postprocess.h>
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+#include "renderer/mesh.hpp"
+#include "renderer/mesh_format.hpp"
+#include "renderer/meshlet.hpp"
+#include "systems/file_system.hpp"
+#include "systems/log_system.hpp"
+
+struct cooked_mesh
+{
+    mesh_file_entry Entry;
+    std::vector<mesh_vertex> Vertices;
+    std::vector<uint8_t> VertexData;
+    std::vector<uint32_t> Indices;
+    std::vector<uint8_t> IndexData;
+    meshlet_data Meshlets;
+};
+
+std::string MeshCookTexturePath(aiMaterial *Material, aiTextureType Type)
+{
+    aiString String;
+    Material->GetTexture(Type, 0, &String);
+    if (!String.length)
+        return "";
+    if (String.C_Str()[0] == '*')
+    {
+        LogWarn("Mesh cooker: Embedded texture %s is not supported, skipping it!", String.C_Str());
+        return "";
+    }
+
+    // NOTE(amelie.h): The texture is cooked on its own by the asset cooker, so point at its cooked file.
+    std::string Cooked = FileReplaceExtension(String.C_Str(), ".tex");
+    if (Cooked.size() >= MESH_FILE_PATH_LENGTH)
+    {
+        LogWarn("Mesh cooker: Texture path %s is too long, skipping it!", Cooked.c_str());
+        return "";
+    }
+    return Cooked;
+}
+
+void MeshCookBounds(mesh_file_entry *Entry, const std::vector<mesh_vertex>& Vertices)
+{
+    if (Vertices.empty())
+        return;
+
+    // NOTE(amelie.h): Centered on the box, not minimal, but tight enough for LOD selection and culling.
+    V3 Min = Vertices[0].Position;
+    V3 Max = Vertices[0].Position;
+    for (auto& Vertex : Vertices)
+    {
+        for (int Axis = 0; Axis < 3; Axis++)
+        {
+            Min.Elements[Axis] = std::min(Min.Elements[Axis], Vertex.Position.Elements[Axis]);
+            Max.Elements[Axis] = std::max(Max.Elements[Axis], Vertex.Position.Elements[Axis]);
+        }
+    }
+
+    V3 Center = HMM_MultiplyVec3f(HMM_AddVec3(Min, Max), 0.5f);
+    float Radius = 0.0f;
+    for (auto& Vertex : Vertices)
+        Radius = std::max(Radius, HMM_LengthVec3(HMM_SubtractVec3(Vertex.Position, Center)));
+
+    for (int Axis = 0; Axis < 3; Axis++)
+        Entry->BoundsCenter[Axis] = Center.Elements[Axis];
+    Entry->BoundsRadius = Radius;
+}
+
+void MeshCookMesh(std::vector<cooked_mesh>& Meshes, aiMesh *Mesh, const aiScene *Scene, const aiMatrix4x4& Transform, mesh_vertex_format Format)
+{
+    cooked_mesh Out = {};
+
+    Out.Vertices.resize(Mesh->mNumVertices);
+    for (uint32_t VertexIndex = 0; VertexIndex < Mesh->mNumVertices; VertexIndex++)
+    {
+        mesh_vertex& Vertex = Out.Vertices[VertexIndex];
+
+        Vertex.Position = HMM_Vec3(Mesh->mVertices[VertexIndex].x, Mesh->mVertices[VertexIndex].y, Mesh->mVertices[VertexIndex].z);
+        if (Mesh->HasNormals())
+            Vertex.Normal = HMM_Vec3(Mesh->mNormals[VertexIndex].x, Mesh->mNormals[VertexIndex].y, Mesh->mNormals[VertexIndex].z);
+        else
+            Vertex.Normal = HMM_Vec3(0.0f, 0.0f, 0.0f);
+        if (Mesh->mTextureCoords[0])
+            Vertex.UV = HMM_Vec2(Mesh->mTextureCoords[0][VertexIndex].x, Mesh->mTextureCoords[0][VertexIndex].y);
+        else
+            Vertex.UV = HMM_Vec2(0.0f, 0.0f);
+    }
+
+    // NOTE(amelie.h): The importer already drops points and lines, anything that still isn't a triangle would shift every
+    // face after it.
+    Out.Indices.reserve(Mesh->mNumFaces * 3);
+    for (uint32_t FaceIndex = 0; FaceIndex < Mesh->mNumFaces; FaceIndex++)
+    {
+        const aiFace& Face = Mesh->mFaces[FaceIndex];
+        if (Face.mNumIndices != 3)
+            continue;
+        Out.Indices.insert(Out.Indices.end(), Face.mIndices, Face.mIndices + 3);
+    }
+    if (Out.Indices.empty())
+    {
+        LogWarn("Mesh cooker: Mesh %s has no triangles, skipping it!", Mesh->mName.C_Str());
+        return;
+    }
+    std::vector<mesh_lod> Lods;
+    MeshOptimize(Out.Vertices, Out.Indices, Lods, Mesh->mName.C_Str());
+    Out.Entry.LodCount = (uint32_t)Lods.size();
+    for (size_t Level = 0; Level < Lods.size(); Level++)
+    {
+        Out.Entry.Lods[Level].FirstIndex = Lods[Level].FirstIndex;
+        Out.Entry.Lods[Level].IndexCount = Lods[Level].IndexCount;
+        Out.Entry.Lods[Level].Error = Lods[Level].Error;
+    }
+    MeshCookBounds(&Out.Entry, Out.Vertices);
+
+    MeshletBuild(&Out.Meshlets, Out.Vertices, Out.Indices.data(), Lods[0].IndexCount);
+    Out.Entry.MeshletCount = (uint32_t)Out.Meshlets.Meshlets.size();
+    Out.Entry.MeshletVertexCount = (uint32_t)Out.Meshlets.Vertices.size();
+    Out.Entry.MeshletTriangleCount = (uint32_t)Out.Meshlets.Triangles.size() / 3;
+    VertexEncode(Out.VertexData, Out.Vertices, Format, Out.Entry.PositionOffset, Out.Entry.PositionScale);
+
+    // NOTE(amelie.h): Assimp matrices are row major, hmm_mat4 is column major.
+    for (int Column = 0; Column < 4; Column++)
+        for (int Row = 0; Row < 4; Row++)
+            Out.Entry.Transform[Column * 4 + Row] = Transform[Row][Column];
+
+    aiMaterial *Material = Scene->mMaterials[Mesh->mMaterialIndex];
+    strcpy(Out.Entry.Albedo, MeshCookTexturePath(Material, aiTextureType_DIFFUSE).c_str());
+    strcpy(Out.Entry.Normal, MeshCookTexturePath(Material, aiTextureType_NORMALS).c_str());
+
+    Out.Entry.VertexCount = Out.Vertices.size();
+    Out.Entry.IndexCount = Out.Indices.size();
+
+    // NOTE(amelie.h): Half the index memory and bandwidth for everything small enough to be addressed with 16 bits.
+    Out.Entry.IndexStride = Out.Vertices.size() < 65536 ? sizeof(uint16_t) : sizeof(uint32_t);
+    Out.IndexData.resize(Out.Indices.size() * Out.Entry.IndexStride);
+    if (Out.Entry.IndexStride == sizeof(uint16_t))
+    {
+        uint16_t *Narrow = (uint16_t*)Out.IndexData.data();
+        for (size_t Index = 0; Index < Out.Indices.size(); Index++)
+            Narrow[Index] = (uint16_t)Out.Indices[Index];
+    }
+    else
+    {
+        memcpy(Out.IndexData.data(), Out.Indices.data(), Out.IndexData.size());
+    }
+
+    Meshes.push_back(std::move(Out));
+}
+
+void MeshCookNode(std::vector<cooked_mesh>& Meshes, aiNode *Node, const aiScene *Scene, const aiMatrix4x4& Parent, mesh_vertex_format Format)
+{
+    aiMatrix4x4 Transform = Parent * Node->mTransformation;
+
+    for (uint32_t MeshIndex = 0; MeshIndex < Node->mNumMeshes; MeshIndex++)
+        MeshCookMesh(Meshes, Scene->mMeshes[Node->mMeshes[MeshIndex]], Scene, Transform, Format);
+    for (uint32_t ChildIndex = 0; ChildIndex < Node->mNumChildren; ChildIndex++)
+        MeshCookNode(Meshes, Node->mChildren[ChildIndex], Scene, Transform, Format);
+}
+
+uint64_t MeshCookAlign(uint64_t Offset)
+{
+    return (Offset + MESH_FILE_ALIGNMENT - 1) & ~(uint64_t)(MESH_FILE_ALIGNMENT - 1);
+}
+
+bool MeshCook(const std::string& Source, const std::string& Destination, mesh_vertex_format Format)
+{
+    Assimp::Importer Importer;
+    Importer.SetPropertyInteger(AI_CONFIG_PP_SBP_REMOVE, aiPrimitiveType_POINT | aiPrimitiveType_LINE);
+    const aiScene *Scene = Importer.ReadFile(Source, aiProcess_Triangulate | aiProcess_SortByPType | aiProcess_CalcTangentSpace);
+    if (!Scene || Scene->mFlags & AI_SCENE_FLAGS_INCOMPLETE || !Scene->mRootNode)
+    {
+        LogError("Mesh cooker: Failed to import %s! (%s)", Source.c_str(), Importer.GetErrorString());
+        return false;
+    }
+
+    std::vector<cooked_mesh> Meshes;
+    MeshCookNode(Meshes, Scene->mRootNode, Scene, aiMatrix4x4(), Format);
+
+    mesh_file_header Header = {};
+    Header.Magic = MESH_FILE_MAGIC;
+    Header.Version = MESH_FILE_VERSION;
+    Header.MeshCount = (uint32_t)Meshes.size();
+    Header.VertexStride = VertexEncodeStride(Format);
+    Header.VertexFormat = (uint32_t)Format;
+
+    uint64_t Offset = MeshCookAlign(sizeof(mesh_file_header) + Meshes.size() * sizeof(mesh_file_entry));
+    for (auto& Mesh : Meshes)
+    {
+        Mesh.Entry.VertexOffset = Offset;
+        Offset = MeshCookAlign(Offset + Mesh.VertexData.size());
+        Mesh.Entry.IndexOffset = Offset;
+        Offset = MeshCookAlign(Offset + Mesh.IndexData.size());
+        Mesh.Entry.MeshletOffset = Offset;
+        Offset = MeshCookAlign(Offset + Mesh.Meshlets.Meshlets.size() * sizeof(meshlet));
+        Mesh.Entry.MeshletVertexOffset = Offset;
+        Offset = MeshCookAlign(Offset + Mesh.Meshlets.Vertices.size() * sizeof(uint32_t));
+        Mesh.Entry.MeshletTriangleOffset = Offset;
+        Offset = MeshCookAlign(Offset + Mesh.Meshlets.Triangles.size());
+    }
+
+    std::vector<uint8_t> Blob(Offset, 0);
+    memcpy(Blob.data(), &Header, sizeof(Header));
+    for (size_t MeshIndex = 0; MeshIndex < Meshes.size(); MeshIndex++)
+    {
+        cooked_mesh& Mesh = Meshes[MeshIndex];
+        memcpy(Blob.data() + sizeof(Header) + MeshIndex * sizeof(mesh_file_entry), &Mesh.Entry, sizeof(mesh_file_entry));
+        memcpy(Blob.data() + Mesh.Entry.VertexOffset, Mesh.VertexData.data(), Mesh.VertexData.size());
+        memcpy(Blob.data() + Mesh.Entry.IndexOffset, Mesh.IndexData.data(), Mesh.IndexData.size());
+        memcpy(Blob.data() + Mesh.Entry.MeshletOffset, Mesh.Meshlets.Meshlets.data(), Mesh.Meshlets.Meshlets.size() * sizeof(meshlet));
+        memcpy(Blob.data() + Mesh.Entry.MeshletVertexOffset, Mesh.Meshlets.Vertices.data(), Mesh.Meshlets.Vertices.size() * sizeof(uint32_t));
+        memcpy(Blob.data() + Mesh.Entry.MeshletTriangleOffset, Mesh.Meshlets.Triangles.data(), Mesh.Meshlets.Triangles.size());
+    }
+
+    std::ofstream Stream(Destination, std::ios::binary | std::ios::trunc);
+    if (!Stream.is_open())
+    {
+        LogError("Mesh cooker: Failed to open %s for writing!", Destination.c_str());
+        return false;
+    }
+    Stream.write((const char*)Blob.data(), Blob.size());
+    Stream.close();
+    if (!Stream.good())
+    {
+        LogError("Mesh cooker: Failed to write %s!", Destination.c_str());
+        if (std::filesystem::is_regular_file(Destination))
+            std::filesystem::remove(Destination);
+        return false;
+    }
+
+    LogInfo("Mesh cooker: Cooked %s -> %s (%u meshes, %llu bytes)", Source.c_str(), Destination.c_str(), Header.MeshCount, (unsigned long long)Blob.size());
+    return true;
+}
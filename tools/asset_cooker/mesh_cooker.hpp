@@ -0,0 +1,16 @@
+/**
+ *  Author: Amélie Heinrich
+ *  Company: Amélie Games
+ *  License: MIT
+ *  Create Time: 17/10/2026 16:50
+ */
+
+#pragma once
+
+#include <string>
+
+#include "renderer/mesh.hpp"
+
+// NOTE(amelie.h): Imports a source model with Assimp and writes it out in the cooked format from mesh_format.hpp.
+// Texture references are rewritten to the .tex files TextureCook produces next to the source images.
+bool MeshCook(const std::string& Source, const std::string& Destination, mesh_vertex_format Format);
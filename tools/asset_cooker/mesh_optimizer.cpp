@@ -0,0 +1,350 @@
+/**
+ *  Author: Amélie Heinrich
+ *  Company: Amélie Games
+ *  License: MIT
+ *  Create Time: 17/10/2026 17:30
+ */
+
+#include "mesh_optimizer.hpp"
+#include "mesh_simplifier.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#include "systems/hash_system.hpp"
+#include "systems/log_system.hpp"
+
+mesh_optimizer_stats MeshOptimizerAnalyze(const std::vector<uint32_t>& Indices, uint32_t VertexCount, uint32_t CacheSize)
+{
+    mesh_optimizer_stats Stats = {};
+    if (Indices.empty())
+        return Stats;
+
+    // NOTE(amelie.h): FIFO cache simulated with timestamps: a vertex is a hit while it is one of the last CacheSize misses.
+    std::vector<uint32_t> CacheTime(VertexCount, 0);
+    std::vector<bool> Referenced(VertexCount, false);
+    uint32_t Timestamp = CacheSize + 1;
+    uint32_t Misses = 0;
+    uint32_t ReferencedCount = 0;
+
+    for (uint32_t Index : Indices)
+    {
+        if (Timestamp - CacheTime[Index] > CacheSize)
+        {
+            CacheTime[Index] = Timestamp++;
+            Misses++;
+        }
+        if (!Referenced[Index])
+        {
+            Referenced[Index] = true;
+            ReferencedCount++;
+        }
+    }
+
+    Stats.Misses = Misses;
+    Stats.ACMR = (float)Misses / (Indices.size() / 3);
+    Stats.ATVR = (float)Misses / ReferencedCount;
+    return Stats;
+}
+
+uint32_t MeshOptimizerWeld(std::vector<mesh_vertex>& Vertices, std::vector<uint32_t>& Indices)
+{
+    uint32_t TableSize = 1;
+    while (TableSize < Vertices.size() * 2)
+        TableSize <<= 1;
+
+    // NOTE(amelie.h): Open addressing on the raw vertex bytes. Importers split vertices per face, so exact duplicates are common.
+    std::vector<uint32_t> Table(TableSize, UINT32_MAX);
+    std::vector<uint32_t> Remap(Vertices.size());
+    std::vector<mesh_vertex> Unique;
+    Unique.reserve(Vertices.size());
+
+    for (uint32_t VertexIndex = 0; VertexIndex < Vertices.size(); VertexIndex++)
+    {
+        const mesh_vertex& Vertex = Vertices[VertexIndex];
+        uint32_t Slot = (uint32_t)HashFNV1a(&Vertex, sizeof(mesh_vertex)) & (TableSize - 1);
+        while (Table[Slot] != UINT32_MAX && memcmp(&Unique[Table[Slot]], &Vertex, sizeof(mesh_vertex)) != 0)
+            Slot = (Slot + 1) & (TableSize - 1);
+
+        if (Table[Slot] == UINT32_MAX)
+        {
+            Table[Slot] = (uint32_t)Unique.size();
+            Unique.push_back(Vertex);
+        }
+        Remap[VertexIndex] = Table[Slot];
+    }
+
+    for (auto& Index : Indices)
+        Index = Remap[Index];
+
+    uint32_t Removed = (uint32_t)(Vertices.size() - Unique.size());
+    Vertices = std::move(Unique);
+    return Removed;
+}
+
+// NOTE(amelie.h): Tipsify, from Sander, Nehab and Barczak, "Fast Triangle Reordering for Vertex Locality and Reduced
+// Overdraw" (2007). Fans around a vertex, then moves to the neighbour that will still be in the cache the longest.
+// Whenever it has to jump somewhere unrelated the cache is effectively cold, so that is where a cluster starts.
+void MeshOptimizerVertexCache(std::vector<uint32_t>& Indices, uint32_t VertexCount, std::vector<uint32_t> *Clusters, uint32_t CacheSize)
+{
+    uint32_t TriangleCount = (uint32_t)(Indices.size() / 3);
+    if (Clusters)
+        Clusters->clear();
+    if (!TriangleCount)
+        return;
+
+    std::vector<uint32_t> LiveCount(VertexCount, 0);
+    for (uint32_t Index : Indices)
+        LiveCount[Index]++;
+
+    std::vector<uint32_t> AdjacencyOffset(VertexCount + 1, 0);
+    for (uint32_t VertexIndex = 0; VertexIndex < VertexCount; VertexIndex++)
+        AdjacencyOffset[VertexIndex + 1] = AdjacencyOffset[VertexIndex] + LiveCount[VertexIndex];
+    std::vector<uint32_t> Adjacency(Indices.size());
+    std::vector<uint32_t> Fill(AdjacencyOffset.begin(), AdjacencyOffset.end() - 1);
+    for (uint32_t Triangle = 0; Triangle < TriangleCount; Triangle++)
+        for (uint32_t Corner = 0; Corner < 3; Corner++)
+            Adjacency[Fill[Indices[Triangle * 3 + Corner]]++] = Triangle;
+
+    std::vector<uint32_t> CacheTime(VertexCount, 0);
+    std::vector<bool> Emitted(TriangleCount, false);
+    std::vector<uint32_t> DeadEnd;
+    std::vector<uint32_t> Candidates;
+    std::vector<uint32_t> Output;
+    Output.reserve(Indices.size());
+
+    uint32_t Timestamp = CacheSize + 1;
+    uint32_t Cursor = 0;
+    int64_t Fanning = Indices[0];
+    if (Clusters)
+        Clusters->push_back(0);
+
+    while (Fanning >= 0)
+    {
+        Candidates.clear();
+        for (uint32_t Slot = AdjacencyOffset[Fanning]; Slot < AdjacencyOffset[Fanning + 1]; Slot++)
+        {
+            uint32_t Triangle = Adjacency[Slot];
+            if (Emitted[Triangle])
+                continue;
+
+            for (uint32_t Corner = 0; Corner < 3; Corner++)
+            {
+                uint32_t Vertex = Indices[Triangle * 3 + Corner];
+                Output.push_back(Vertex);
+                DeadEnd.push_back(Vertex);
+                Candidates.push_back(Vertex);
+                LiveCount[Vertex]--;
+                if (Timestamp - CacheTime[Vertex] > CacheSize)
+                    CacheTime[Vertex] = Timestamp++;
+            }
+            Emitted[Triangle] = true;
+        }
+
+        // NOTE(amelie.h): Prefer the candidate whose remaining fan still fits in the cache and that entered it first.
+        int64_t Next = -1;
+        uint32_t Best = 0;
+        for (uint32_t Vertex : Candidates)
+        {
+            if (!LiveCount[Vertex])
+                continue;
+            uint32_t Priority = 0;
+            if (Timestamp - CacheTime[Vertex] + 2 * LiveCount[Vertex] <= CacheSize)
+                Priority = Timestamp - CacheTime[Vertex];
+            if (Priority > Best)
+            {
+                Best = Priority;
+                Next = Vertex;
+            }
+        }
+        if (Next >= 0)
+        {
+            Fanning = Next;
+            continue;
+        }
+
+        while (!DeadEnd.empty() && Next < 0)
+        {
+            uint32_t Vertex = DeadEnd.back();
+            DeadEnd.pop_back();
+            if (LiveCount[Vertex])
+                Next = Vertex;
+        }
+        if (Next < 0)
+        {
+            while (Cursor < VertexCount && !LiveCount[Cursor])
+                Cursor++;
+            if (Cursor < VertexCount)
+                Next = Cursor;
+        }
+
+        if (Next >= 0 && Clusters)
+            Clusters->push_back((uint32_t)(Output.size() / 3));
+        Fanning = Next;
+    }
+
+    Indices = std::move(Output);
+}
+
+// NOTE(amelie.h): Same paper, second half. Clusters that face away from the mesh center are likely occluders, so they
+// are drawn first. Sorting whole clusters keeps most of the cache locality Tipsify bought us.
+void MeshOptimizerOverdraw(std::vector<uint32_t>& Indices, const std::vector<mesh_vertex>& Vertices, const std::vector<uint32_t>& Clusters, float Threshold)
+{
+    uint32_t TriangleCount = (uint32_t)(Indices.size() / 3);
+    if (Clusters.size() < 2)
+        return;
+
+    // NOTE(amelie.h): Tiny clusters would make the sort shuffle single fans, merge neighbours up to a minimum size first.
+    std::vector<uint32_t> Starts;
+    for (uint32_t Start : Clusters)
+        if (Starts.empty() || Start - Starts.back() >= MESH_OPTIMIZER_CLUSTER_MIN_TRIANGLES)
+            Starts.push_back(Start);
+    if (Starts.size() < 2)
+        return;
+
+    V3 MeshCenter = HMM_Vec3(0.0f, 0.0f, 0.0f);
+    for (auto& Vertex : Vertices)
+        MeshCenter = HMM_AddVec3(MeshCenter, Vertex.Position);
+    MeshCenter = HMM_DivideVec3f(MeshCenter, (float)Vertices.size());
+
+    struct overdraw_cluster
+    {
+        uint32_t Start;
+        uint32_t End;
+        float Sort;
+    };
+
+    std::vector<overdraw_cluster> Sorted;
+    for (uint32_t ClusterIndex = 0; ClusterIndex < Starts.size(); ClusterIndex++)
+    {
+        overdraw_cluster Cluster;
+        Cluster.Start = Starts[ClusterIndex];
+        Cluster.End = ClusterIndex + 1 < Starts.size() ? Starts[ClusterIndex + 1] : TriangleCount;
+
+        V3 Center = HMM_Vec3(0.0f, 0.0f, 0.0f);
+        V3 Normal = HMM_Vec3(0.0f, 0.0f, 0.0f);
+        float Area = 0.0f;
+        for (uint32_t Triangle = Cluster.Start; Triangle < Cluster.End; Triangle++)
+        {
+            V3 A = Vertices[Indices[Triangle * 3 + 0]].Position;
+            V3 B = Vertices[Indices[Triangle * 3 + 1]].Position;
+            V3 C = Vertices[Indices[Triangle * 3 + 2]].Position;
+
+            V3 Cross = HMM_Cross(HMM_SubtractVec3(B, A), HMM_SubtractVec3(C, A));
+            float TriangleArea = HMM_LengthVec3(Cross);
+            Center = HMM_AddVec3(Center, HMM_MultiplyVec3f(HMM_AddVec3(HMM_AddVec3(A, B), C), TriangleArea / 3.0f));
+            Normal = HMM_AddVec3(Normal, Cross);
+            Area += TriangleArea;
+        }
+        if (Area > 0.0f)
+            Center = HMM_DivideVec3f(Center, Area);
+        if (HMM_LengthVec3(Normal) > 0.0f)
+            Normal = HMM_NormalizeVec3(Normal);
+
+        Cluster.Sort = HMM_DotVec3(HMM_SubtractVec3(Center, MeshCenter), Normal);
+        Sorted.push_back(Cluster);
+    }
+
+    std::stable_sort(Sorted.begin(), Sorted.end(), [](const overdraw_cluster& A, const overdraw_cluster& B) {
+        return A.Sort > B.Sort;
+    });
+
+    std::vector<uint32_t> Output;
+    Output.reserve(Indices.size());
+    for (auto& Cluster : Sorted)
+        Output.insert(Output.end(), Indices.begin() + Cluster.Start * 3, Indices.begin() + Cluster.End * 3);
+
+    // NOTE(amelie.h): Vertex work is the cost we can measure, so give up on overdraw if it hurts the cache too much.
+    float Before = MeshOptimizerAnalyze(Indices, (uint32_t)Vertices.size()).ACMR;
+    float After = MeshOptimizerAnalyze(Output, (uint32_t)Vertices.size()).ACMR;
+    if (After <= Before * Threshold)
+        Indices = std::move(Output);
+}
+
+void MeshOptimizerVertexFetch(std::vector<mesh_vertex>& Vertices, std::vector<uint32_t>& Indices)
+{
+    // NOTE(amelie.h): Lay vertices out in first-use order so the input assembler streams through memory. Unreferenced
+    // vertices are dropped on the way.
+    std::vector<uint32_t> Remap(Vertices.size(), UINT32_MAX);
+    std::vector<mesh_vertex> Output;
+    Output.reserve(Vertices.size());
+
+    for (auto& Index : Indices)
+    {
+        if (Remap[Index] == UINT32_MAX)
+        {
+            Remap[Index] = (uint32_t)Output.size();
+            Output.push_back(Vertices[Index]);
+        }
+        Index = Remap[Index];
+    }
+
+    Vertices = std::move(Output);
+}
+
+void MeshOptimize(std::vector<mesh_vertex>& Vertices, std::vector<uint32_t>& Indices, std::vector<mesh_lod>& Lods, const char *Name)
+{
+    Lods.clear();
+    if (Indices.size() < 3)
+    {
+        Lods.push_back({ 0, (uint32_t)Indices.size(), 0.0f });
+        return;
+    }
+
+    uint32_t SourceVertexCount = (uint32_t)Vertices.size();
+    mesh_optimizer_stats Before = MeshOptimizerAnalyze(Indices, SourceVertexCount);
+
+    MeshOptimizerWeld(Vertices, Indices);
+
+    V3 Min = Vertices[0].Position;
+    V3 Max = Vertices[0].Position;
+    for (auto& Vertex : Vertices)
+    {
+        for (int Axis = 0; Axis < 3; Axis++)
+        {
+            Min.Elements[Axis] = std::min(Min.Elements[Axis], Vertex.Position.Elements[Axis]);
+            Max.Elements[Axis] = std::max(Max.Elements[Axis], Vertex.Position.Elements[Axis]);
+        }
+    }
+    float Radius = HMM_LengthVec3(HMM_SubtractVec3(Max, Min)) * 0.5f;
+
+    // NOTE(amelie.h): Every LOD is simplified from the previous one, so errors add up along the chain.
+    std::vector<std::vector<uint32_t>> Chain;
+    std::vector<float> Errors;
+    Chain.push_back(Indices);
+    Errors.push_back(0.0f);
+    while (Chain.size() < MESH_MAX_LODS)
+    {
+        const std::vector<uint32_t>& Previous = Chain.back();
+        uint32_t Target = (uint32_t)(Previous.size() / 3 * MESH_OPTIMIZER_LOD_REDUCTION) * 3;
+
+        float Error = 0.0f;
+        std::vector<uint32_t> Simplified = MeshSimplify(Vertices, Previous, Target, Radius * MESH_OPTIMIZER_LOD_MAX_ERROR, &Error);
+        if (Simplified.empty() || Simplified.size() > Previous.size() * MESH_OPTIMIZER_LOD_MIN_REDUCTION)
+            break;
+
+        Errors.push_back(Errors.back() + Error);
+        Chain.push_back(std::move(Simplified));
+    }
+
+    // NOTE(amelie.h): Overdraw only matters up close, the coarser LODs only get the vertex cache pass.
+    Indices.clear();
+    for (size_t Level = 0; Level < Chain.size(); Level++)
+    {
+        std::vector<uint32_t> Clusters;
+        MeshOptimizerVertexCache(Chain[Level], (uint32_t)Vertices.size(), &Clusters);
+        if (Level == 0)
+            MeshOptimizerOverdraw(Chain[Level], Vertices, Clusters);
+
+        Lods.push_back({ (uint32_t)Indices.size(), (uint32_t)Chain[Level].size(), Errors[Level] });
+        Indices.insert(Indices.end(), Chain[Level].begin(), Chain[Level].end());
+    }
+    MeshOptimizerVertexFetch(Vertices, Indices);
+
+    std::vector<uint32_t> Lod0(Indices.begin(), Indices.begin() + Lods[0].IndexCount);
+    mesh_optimizer_stats After = MeshOptimizerAnalyze(Lod0, (uint32_t)Vertices.size());
+    LogInfo("Mesh optimizer: %s: %u -> %zu vertices, %u -> %u vertex shader invocations, ACMR %.3f -> %.3f, ATVR %.3f -> %.3f",
+            Name, SourceVertexCount, Vertices.size(), Before.Misses, After.Misses, Before.ACMR, After.ACMR, Before.ATVR, After.ATVR);
+    for (size_t Level = 1; Level < Lods.size(); Level++)
+        LogInfo("Mesh optimizer: %s: LOD %zu has %u triangles, error %.4f", Name, Level, Lods[Level].IndexCount / 3, Lods[Level].Error);
+}
@@ -0,0 +1,43 @@
+/**
+ *  Author: Amélie Heinrich
+ *  Company: Amélie Games
+ *  License: MIT
+ *  Create Time: 17/10/2026 17:30
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "renderer/mesh.hpp"
+
+#define MESH_OPTIMIZER_CACHE_SIZE 16
+#define MESH_OPTIMIZER_CLUSTER_MIN_TRIANGLES 64
+#define MESH_OPTIMIZER_OVERDRAW_THRESHOLD 1.05f
+#define MESH_OPTIMIZER_LOD_REDUCTION 0.5f
+#define MESH_OPTIMIZER_LOD_MIN_REDUCTION 0.85f
+#define MESH_OPTIMIZER_LOD_MAX_ERROR 0.05f
+
+// NOTE(amelie.h): ACMR is cache misses per triangle (0.5 is the floor for a regular grid, 3 is no reuse at all).
+// ATVR is cache misses per referenced vertex, 1 means every vertex is shaded exactly once. Misses is the estimated
+// vertex shader invocation count for one draw, the number VSInvocations reports on the GPU.
+struct mesh_optimizer_stats
+{
+    uint32_t Misses;
+    float ACMR;
+    float ATVR;
+};
+
+mesh_optimizer_stats MeshOptimizerAnalyze(const std::vector<uint32_t>& Indices, uint32_t VertexCount, uint32_t CacheSize = MESH_OPTIMIZER_CACHE_SIZE);
+
+// NOTE(amelie.h): Each stage can be used on its own, MeshOptimize runs them all in the right order.
+uint32_t MeshOptimizerWeld(std::vector<mesh_vertex>& Vertices, std::vector<uint32_t>& Indices);
+void MeshOptimizerVertexCache(std::vector<uint32_t>& Indices, uint32_t VertexCount, std::vector<uint32_t> *Clusters, uint32_t CacheSize = MESH_OPTIMIZER_CACHE_SIZE);
+void MeshOptimizerOverdraw(std::vector<uint32_t>& Indices, const std::vector<mesh_vertex>& Vertices, const std::vector<uint32_t>& Clusters, float Threshold = MESH_OPTIMIZER_OVERDRAW_THRESHOLD);
+void MeshOptimizerVertexFetch(std::vector<mesh_vertex>& Vertices, std::vector<uint32_t>& Indices);
+
+// NOTE(amelie.h): Builds the LOD chain too. Each LOD targets MESH_OPTIMIZER_LOD_REDUCTION of the previous one's triangles
+// with an error below MESH_OPTIMIZER_LOD_MAX_ERROR of the mesh radius, the chain stops once a step removes less than
+// 1 - MESH_OPTIMIZER_LOD_MIN_REDUCTION of the triangles. Indices ends up holding every LOD back to back, finest first.
+void MeshOptimize(std::vector<mesh_vertex>& Vertices, std::vector<uint32_t>& Indices, std::vector<mesh_lod>& Lods, const char *Name);
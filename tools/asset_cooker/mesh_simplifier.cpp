@@ -0,0 +1,306 @@
+/**
+ *  Author: Amélie Heinrich
+ *  Company: Amélie Games
+ *  License: MIT
+ *  Create Time: 17/10/2026 17:55
+ */
+
+#include "mesh_simplifier.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+
+#include "systems/hash_system.hpp"
+
+struct simplifier_quadric
+{
+    double A[10]; // NOTE(amelie.h): Upper triangle of the symmetric 4x4 matrix: aa ab ac ad bb bc bd cc cd dd
+    double Weight;
+};
+
+struct simplifier_collapse
+{
+    uint32_t From;
+    uint32_t To;
+    double Cost;
+};
+
+void SimplifierQuadricAdd(simplifier_quadric *Q, const simplifier_quadric *Other)
+{
+    for (int Index = 0; Index < 10; Index++)
+        Q->A[Index] += Other->A[Index];
+    Q->Weight += Other->Weight;
+}
+
+void SimplifierQuadricPlane(simplifier_quadric *Q, V3 A, V3 B, V3 C)
+{
+    V3 Normal = HMM_Cross(HMM_SubtractVec3(B, A), HMM_SubtractVec3(C, A));
+    float Length = HMM_LengthVec3(Normal);
+    if (Length <= 0.0f)
+        return;
+
+    // NOTE(amelie.h): Area weighted so big triangles dominate, Weight lets us turn the sum back into a mean squared distance.
+    double Area = Length * 0.5;
+    double X = Normal.X / Length;
+    double Y = Normal.Y / Length;
+    double Z = Normal.Z / Length;
+    double W = -(X * A.X + Y * A.Y + Z * A.Z);
+
+    double Plane[10] = { X * X, X * Y, X * Z, X * W, Y * Y, Y * Z, Y * W, Z * Z, Z * W, W * W };
+    for (int Index = 0; Index < 10; Index++)
+        Q->A[Index] += Plane[Index] * Area;
+    Q->Weight += Area;
+}
+
+double SimplifierQuadricError(const simplifier_quadric *Q, V3 P)
+{
+    double X = P.X;
+    double Y = P.Y;
+    double Z = P.Z;
+    double Error = Q->A[0] * X * X + 2 * Q->A[1] * X * Y + 2 * Q->A[2] * X * Z + 2 * Q->A[3] * X
+                 + Q->A[4] * Y * Y + 2 * Q->A[5] * Y * Z + 2 * Q->A[6] * Y
+                 + Q->A[7] * Z * Z + 2 * Q->A[8] * Z
+                 + Q->A[9];
+    return Q->Weight > 0.0 ? fabs(Error) / Q->Weight : 0.0;
+}
+
+uint64_t SimplifierEdgeKey(uint32_t A, uint32_t B)
+{
+    return ((uint64_t)A << 32) | B;
+}
+
+bool SimplifierFlips(const std::vector<mesh_vertex>& Vertices, const std::vector<uint32_t>& Indices, const std::vector<uint32_t>& Triangles, uint32_t From, uint32_t To)
+{
+    for (uint32_t Triangle : Triangles)
+    {
+        const uint32_t *Corners = &Indices[Triangle * 3];
+        if (Corners[0] == To || Corners[1] == To || Corners[2] == To)
+            continue;
+
+        V3 P[3];
+        V3 Q[3];
+        for (int Corner = 0; Corner < 3; Corner++)
+        {
+            P[Corner] = Vertices[Corners[Corner]].Position;
+            Q[Corner] = Corners[Corner] == From ? Vertices[To].Position : P[Corner];
+        }
+
+        V3 Before = HMM_Cross(HMM_SubtractVec3(P[1], P[0]), HMM_SubtractVec3(P[2], P[0]));
+        V3 After = HMM_Cross(HMM_SubtractVec3(Q[1], Q[0]), HMM_SubtractVec3(Q[2], Q[0]));
+        if (HMM_DotVec3(Before, After) <= 0.0f)
+            return true;
+    }
+    return false;
+}
+
+// NOTE(amelie.h): Closest point on triangle ABC to P, by Voronoi region (Ericson, "Real-Time Collision Detection" 5.1.5).
+V3 SimplifierClosestPoint(V3 P, V3 A, V3 B, V3 C)
+{
+    V3 AB = HMM_SubtractVec3(B, A);
+    V3 AC = HMM_SubtractVec3(C, A);
+    V3 AP = HMM_SubtractVec3(P, A);
+    float D1 = HMM_DotVec3(AB, AP);
+    float D2 = HMM_DotVec3(AC, AP);
+    if (D1 <= 0.0f && D2 <= 0.0f)
+        return A;
+
+    V3 BP = HMM_SubtractVec3(P, B);
+    float D3 = HMM_DotVec3(AB, BP);
+    float D4 = HMM_DotVec3(AC, BP);
+    if (D3 >= 0.0f && D4 <= D3)
+        return B;
+
+    float VC = D1 * D4 - D3 * D2;
+    if (VC <= 0.0f && D1 >= 0.0f && D3 <= 0.0f)
+        return HMM_AddVec3(A, HMM_MultiplyVec3f(AB, D1 / (D1 - D3)));
+
+    V3 CP = HMM_SubtractVec3(P, C);
+    float D5 = HMM_DotVec3(AB, CP);
+    float D6 = HMM_DotVec3(AC, CP);
+    if (D6 >= 0.0f && D5 <= D6)
+        return C;
+
+    float VB = D5 * D2 - D1 * D6;
+    if (VB <= 0.0f && D2 >= 0.0f && D6 <= 0.0f)
+        return HMM_AddVec3(A, HMM_MultiplyVec3f(AC, D2 / (D2 - D6)));
+
+    float VA = D3 * D6 - D5 * D4;
+    if (VA <= 0.0f && D4 - D3 >= 0.0f && D5 - D6 >= 0.0f)
+        return HMM_AddVec3(B, HMM_MultiplyVec3f(HMM_SubtractVec3(C, B), (D4 - D3) / ((D4 - D3) + (D5 - D6))));
+
+    float Denominator = 1.0f / (VA + VB + VC);
+    return HMM_AddVec3(A, HMM_AddVec3(HMM_MultiplyVec3f(AB, VB * Denominator), HMM_MultiplyVec3f(AC, VC * Denominator)));
+}
+
+std::vector<uint32_t> MeshSimplify(const std::vector<mesh_vertex>& Vertices, const std::vector<uint32_t>& Indices, uint32_t TargetIndexCount, float TargetError, float *ResultError)
+{
+    uint32_t VertexCount = (uint32_t)Vertices.size();
+    std::vector<uint32_t> Result = Indices;
+    *ResultError = 0.0f;
+
+    // NOTE(amelie.h): Vertices sharing a position with another vertex sit on an attribute seam.
+    std::vector<bool> Locked(VertexCount, false);
+    std::unordered_map<uint64_t, uint32_t> Positions;
+    std::vector<uint32_t> PositionCount(VertexCount, 0);
+    std::vector<uint32_t> PositionOwner(VertexCount);
+    for (uint32_t Vertex = 0; Vertex < VertexCount; Vertex++)
+    {
+        uint64_t Key = HashFNV1a(&Vertices[Vertex].Position, sizeof(V3));
+        auto Iterator = Positions.emplace(Key, Vertex).first;
+        PositionOwner[Vertex] = Iterator->second;
+        PositionCount[Iterator->second]++;
+    }
+    for (uint32_t Vertex = 0; Vertex < VertexCount; Vertex++)
+        if (PositionCount[PositionOwner[Vertex]] > 1)
+            Locked[Vertex] = true;
+
+    // NOTE(amelie.h): An edge without its twin is a border, an edge seen twice in the same direction is non-manifold.
+    std::unordered_map<uint64_t, uint32_t> Edges;
+    for (size_t Corner = 0; Corner < Result.size(); Corner++)
+    {
+        uint32_t A = Result[Corner];
+        uint32_t B = Result[Corner - Corner % 3 + (Corner + 1) % 3];
+        Edges[SimplifierEdgeKey(A, B)]++;
+    }
+    for (auto& Edge : Edges)
+    {
+        uint32_t A = (uint32_t)(Edge.first >> 32);
+        uint32_t B = (uint32_t)Edge.first;
+        auto Twin = Edges.find(SimplifierEdgeKey(B, A));
+        if (Edge.second > 1 || Twin == Edges.end() || Twin->second > 1)
+        {
+            Locked[A] = true;
+            Locked[B] = true;
+        }
+    }
+
+    std::vector<simplifier_quadric> Quadrics(VertexCount, simplifier_quadric{});
+    for (size_t Triangle = 0; Triangle < Result.size() / 3; Triangle++)
+    {
+        simplifier_quadric Plane = {};
+        SimplifierQuadricPlane(&Plane, Vertices[Result[Triangle * 3 + 0]].Position, Vertices[Result[Triangle * 3 + 1]].Position, Vertices[Result[Triangle * 3 + 2]].Position);
+        for (int Corner = 0; Corner < 3; Corner++)
+            SimplifierQuadricAdd(&Quadrics[Result[Triangle * 3 + Corner]], &Plane);
+    }
+
+    // NOTE(amelie.h): Collapsed follows every source vertex to the vertex it ended up merged into.
+    double MaxCost = (double)TargetError * TargetError;
+    std::vector<uint32_t> Collapsed(VertexCount);
+    for (uint32_t Vertex = 0; Vertex < VertexCount; Vertex++)
+        Collapsed[Vertex] = Vertex;
+    std::vector<uint32_t> Remap(VertexCount);
+    std::vector<bool> Touched(VertexCount);
+    std::vector<std::vector<uint32_t>> Adjacency(VertexCount);
+    std::vector<simplifier_collapse> Collapses;
+
+    while (Result.size() > TargetIndexCount)
+    {
+        for (auto& Triangles : Adjacency)
+            Triangles.clear();
+        for (uint32_t Triangle = 0; Triangle < Result.size() / 3; Triangle++)
+            for (int Corner = 0; Corner < 3; Corner++)
+                Adjacency[Result[Triangle * 3 + Corner]].push_back(Triangle);
+
+        Collapses.clear();
+        for (size_t Corner = 0; Corner < Result.size(); Corner++)
+        {
+            uint32_t From = Result[Corner];
+            uint32_t To = Result[Corner - Corner % 3 + (Corner + 1) % 3];
+            if (Locked[From])
+                continue;
+
+            simplifier_quadric Combined = Quadrics[From];
+            SimplifierQuadricAdd(&Combined, &Quadrics[To]);
+            double Cost = SimplifierQuadricError(&Combined, Vertices[To].Position);
+            if (Cost <= MaxCost)
+                Collapses.push_back({ From, To, Cost });
+        }
+        if (Collapses.empty())
+            break;
+        std::sort(Collapses.begin(), Collapses.end(), [](const simplifier_collapse& A, const simplifier_collapse& B) {
+            return A.Cost < B.Cost;
+        });
+
+        // NOTE(amelie.h): Each pass only collapses edges whose neighbourhoods don't overlap, so the flip tests stay valid.
+        // Every collapse of an interior vertex removes two triangles.
+        for (uint32_t Vertex = 0; Vertex < VertexCount; Vertex++)
+            Remap[Vertex] = Vertex;
+        std::fill(Touched.begin(), Touched.end(), false);
+
+        size_t Remaining = Result.size();
+        uint32_t Performed = 0;
+        for (auto& Collapse : Collapses)
+        {
+            if (Remaining <= TargetIndexCount)
+                break;
+            if (Touched[Collapse.From] || Touched[Collapse.To])
+                continue;
+            if (SimplifierFlips(Vertices, Result, Adjacency[Collapse.From], Collapse.From, Collapse.To))
+                continue;
+
+            Remap[Collapse.From] = Collapse.To;
+            SimplifierQuadricAdd(&Quadrics[Collapse.To], &Quadrics[Collapse.From]);
+            for (uint32_t Triangle : Adjacency[Collapse.From])
+                for (int Corner = 0; Corner < 3; Corner++)
+                    Touched[Result[Triangle * 3 + Corner]] = true;
+
+            Remaining -= 6;
+            Performed++;
+        }
+        if (!Performed)
+            break;
+        for (uint32_t& Target : Collapsed)
+            Target = Remap[Target];
+
+        size_t Write = 0;
+        for (size_t Triangle = 0; Triangle < Result.size() / 3; Triangle++)
+        {
+            uint32_t A = Remap[Result[Triangle * 3 + 0]];
+            uint32_t B = Remap[Result[Triangle * 3 + 1]];
+            uint32_t C = Remap[Result[Triangle * 3 + 2]];
+            if (A == B || B == C || A == C)
+                continue;
+            Result[Write++] = A;
+            Result[Write++] = B;
+            Result[Write++] = C;
+        }
+        Result.resize(Write);
+    }
+
+    // NOTE(amelie.h): The quadric cost is an area weighted mean, good for ordering collapses but not a distance. The error
+    // is measured instead: every removed vertex against the triangles within two rings of the vertex it was merged into,
+    // which is where the surface it used to be on ended up.
+    for (auto& Triangles : Adjacency)
+        Triangles.clear();
+    for (uint32_t Triangle = 0; Triangle < Result.size() / 3; Triangle++)
+        for (int Corner = 0; Corner < 3; Corner++)
+            Adjacency[Result[Triangle * 3 + Corner]].push_back(Triangle);
+
+    float WorstError = 0.0f;
+    for (uint32_t Vertex = 0; Vertex < VertexCount; Vertex++)
+    {
+        uint32_t Target = Collapsed[Vertex];
+        if (Target == Vertex || Adjacency[Target].empty())
+            continue;
+
+        V3 Position = Vertices[Vertex].Position;
+        float Nearest = HMM_LengthVec3(HMM_SubtractVec3(Vertices[Target].Position, Position));
+        for (uint32_t Fan : Adjacency[Target])
+        {
+            for (int FanCorner = 0; FanCorner < 3; FanCorner++)
+            {
+                for (uint32_t Triangle : Adjacency[Result[Fan * 3 + FanCorner]])
+                {
+                    const uint32_t *Corners = &Result[Triangle * 3];
+                    V3 Closest = SimplifierClosestPoint(Position, Vertices[Corners[0]].Position, Vertices[Corners[1]].Position, Vertices[Corners[2]].Position);
+                    Nearest = std::min(Nearest, HMM_LengthVec3(HMM_SubtractVec3(Closest, Position)));
+                }
+            }
+        }
+        WorstError = std::max(WorstError, Nearest);
+    }
+
+    *ResultError = WorstError;
+    return Result;
+}
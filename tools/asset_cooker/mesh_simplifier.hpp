@@ -0,0 +1,20 @@
+/**
+ *  Author: Amélie Heinrich
+ *  Company: Amélie Games
+ *  License: MIT
+ *  Create Time: 17/10/2026 17:55
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "renderer/mesh.hpp"
+
+// NOTE(amelie.h): Quadric error edge collapse (Garland and Heckbert, "Surface Simplification Using Quadric Error Metrics").
+// Vertices only ever collapse onto existing vertices, so every LOD indexes into the same vertex buffer. Border vertices,
+// attribute seams and non-manifold vertices are locked so the silhouette and UV layout stay intact.
+// Returns the simplified indices and writes the largest object space distance from a removed vertex to the simplified
+// surface into ResultError.
+std::vector<uint32_t> MeshSimplify(const std::vector<mesh_vertex>& Vertices, const std::vector<uint32_t>& Indices, uint32_t TargetIndexCount, float TargetError, float *ResultError);
@@ -0,0 +1,55 @@
+/**
+ *  Author: Amélie Heinrich
+ *  Company: Amélie Games
+ *  License: MIT
+ *  Create Time: 17/10/2026 17:10
+ */
+
+#include "texture_cooker.hpp"
+
+#include <filesystem>
+#include <fstream>
+
+#include "renderer/cpu_image.hpp"
+#include "renderer/image_format.hpp"
+#include "systems/log_system.hpp"
+
+bool TextureCook(const std::string& Source, const std::string& Destination)
+{
+    cpu_image Image;
+    CpuImageLoad(&Image, Source);
+    if (!Image.Data)
+        return false;
+
+    // NOTE(amelie.h): stb always expands to RGBA, Channels only reports what the source file had.
+    image_file_header Header = {};
+    Header.Magic = IMAGE_FILE_MAGIC;
+    Header.Version = IMAGE_FILE_VERSION;
+    Header.Width = Image.Width;
+    Header.Height = Image.Height;
+    Header.Channels = 4;
+    Header.Float = Image.Float;
+    uint64_t Size = CpuImageGetSize(Header.Width, Header.Height, Header.Channels, Header.Float);
+
+    std::ofstream Stream(Destination, std::ios::binary | std::ios::trunc);
+    if (!Stream.is_open())
+    {
+        LogError("Texture cooker: Failed to open %s for writing!", Destination.c_str());
+        CpuImageFree(&Image);
+        return false;
+    }
+    Stream.write((const char*)&Header, sizeof(Header));
+    Stream.write((const char*)Image.Data, Size);
+    Stream.close();
+    CpuImageFree(&Image);
+    if (!Stream.good())
+    {
+        LogError("Texture cooker: Failed to write %s!", Destination.c_str());
+        if (std::filesystem::is_regular_file(Destination))
+            std::filesystem::remove(Destination);
+        return false;
+    }
+
+    LogInfo("Texture cooker: Cooked %s -> %s (%ux%u, %llu bytes)", Source.c_str(), Destination.c_str(), Header.Width, Header.Height, (unsigned long long)(Size + sizeof(Header)));
+    return true;
+}
@@ -0,0 +1,13 @@
+/**
+ *  Author: Amélie Heinrich
+ *  Company: Amélie Games
+ *  License: MIT
+ *  Create Time: 17/10/2026 17:10
+ */
+
+#pragma once
+
+#include <string>
+
+// NOTE(amelie.h): Decodes a source image once and writes the raw RGBA pixels in the cooked format from image_format.hpp.
+bool TextureCook(const std::string& Source, const std::string& Destination);
@@ -0,0 +1,156 @@
+/**
+ *  Author: Amélie Heinrich
+ *  Company: Amélie Games
+ *  License: MIT
+ *  Create Time: 17/10/2026 17:45
+ */
+
+#include "vertex_encoder.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+uint32_t VertexEncodeStride(mesh_vertex_format Format)
+{
+    switch (Format)
+    {
+        case mesh_vertex_format::Packed:
+            return sizeof(mesh_vertex_packed);
+        case mesh_vertex_format::Quantized:
+            return sizeof(mesh_vertex_quantized);
+        default:
+            return sizeof(mesh_vertex);
+    }
+}
+
+uint16_t VertexEncodeHalf(float Value)
+{
+    uint32_t Bits;
+    memcpy(&Bits, &Value, sizeof(Bits));
+
+    uint32_t Sign = (Bits >> 16) & 0x8000;
+    int32_t Exponent = (int32_t)((Bits >> 23) & 0xFF) - 127 + 15;
+    uint32_t Mantissa = Bits & 0x7FFFFF;
+
+    if (((Bits >> 23) & 0xFF) == 0xFF)
+        return (uint16_t)(Sign | 0x7C00 | (Mantissa ? 0x200 : 0));
+    if (Exponent >= 31)
+        return (uint16_t)(Sign | 0x7C00);
+    if (Exponent <= 0)
+    {
+        // NOTE(amelie.h): Denormal or zero, shift the implicit bit in and round to nearest.
+        if (Exponent < -10)
+            return (uint16_t)Sign;
+        Mantissa |= 0x800000;
+        uint32_t Shift = 14 - Exponent;
+        uint32_t Half = Mantissa >> Shift;
+        if ((Mantissa >> (Shift - 1)) & 1)
+            Half++;
+        return (uint16_t)(Sign | Half);
+    }
+
+    uint32_t Half = Sign | ((uint32_t)Exponent << 10) | (Mantissa >> 13);
+    if (Mantissa & 0x1000)
+        Half++;
+    return (uint16_t)Half;
+}
+
+int16_t VertexEncodeSNorm16(float Value)
+{
+    return (int16_t)std::lround(std::clamp(Value, -1.0f, 1.0f) * 32767.0f);
+}
+
+void VertexEncodeOctahedral(V3 Normal, int16_t Out[2])
+{
+    float Length = fabsf(Normal.X) + fabsf(Normal.Y) + fabsf(Normal.Z);
+    if (Length == 0.0f)
+    {
+        Out[0] = 0;
+        Out[1] = 0;
+        return;
+    }
+
+    float X = Normal.X / Length;
+    float Y = Normal.Y / Length;
+    if (Normal.Z < 0.0f)
+    {
+        float FoldX = (1.0f - fabsf(Y)) * (X >= 0.0f ? 1.0f : -1.0f);
+        float FoldY = (1.0f - fabsf(X)) * (Y >= 0.0f ? 1.0f : -1.0f);
+        X = FoldX;
+        Y = FoldY;
+    }
+
+    Out[0] = VertexEncodeSNorm16(X);
+    Out[1] = VertexEncodeSNorm16(Y);
+}
+
+void VertexEncode(std::vector<uint8_t>& Out, const std::vector<mesh_vertex>& Vertices, mesh_vertex_format Format, float PositionOffset[3], float PositionScale[3])
+{
+    for (int Axis = 0; Axis < 3; Axis++)
+    {
+        PositionOffset[Axis] = 0.0f;
+        PositionScale[Axis] = 1.0f;
+    }
+
+    switch (Format)
+    {
+        case mesh_vertex_format::Full:
+        {
+            Out.resize(Vertices.size() * sizeof(mesh_vertex));
+            memcpy(Out.data(), Vertices.data(), Out.size());
+            break;
+        }
+        case mesh_vertex_format::Packed:
+        {
+            Out.resize(Vertices.size() * sizeof(mesh_vertex_packed));
+            mesh_vertex_packed *Packed = (mesh_vertex_packed*)Out.data();
+            for (size_t VertexIndex = 0; VertexIndex < Vertices.size(); VertexIndex++)
+            {
+                Packed[VertexIndex].Position = Vertices[VertexIndex].Position;
+                VertexEncodeOctahedral(Vertices[VertexIndex].Normal, Packed[VertexIndex].Normal);
+                Packed[VertexIndex].UV[0] = VertexEncodeHalf(Vertices[VertexIndex].UV.X);
+                Packed[VertexIndex].UV[1] = VertexEncodeHalf(Vertices[VertexIndex].UV.Y);
+            }
+            break;
+        }
+        case mesh_vertex_format::Quantized:
+        {
+            V3 Min = Vertices.empty() ? HMM_Vec3(0.0f, 0.0f, 0.0f) : Vertices[0].Position;
+            V3 Max = Min;
+            for (auto& Vertex : Vertices)
+            {
+                for (int Axis = 0; Axis < 3; Axis++)
+                {
+                    Min.Elements[Axis] = std::min(Min.Elements[Axis], Vertex.Position.Elements[Axis]);
+                    Max.Elements[Axis] = std::max(Max.Elements[Axis], Vertex.Position.Elements[Axis]);
+                }
+            }
+
+            // NOTE(amelie.h): The input assembler maps unorm16 to [0, 1], so the scale is the full extent of the mesh.
+            for (int Axis = 0; Axis < 3; Axis++)
+            {
+                PositionOffset[Axis] = Min.Elements[Axis];
+                PositionScale[Axis] = Max.Elements[Axis] - Min.Elements[Axis];
+            }
+
+            Out.resize(Vertices.size() * sizeof(mesh_vertex_quantized));
+            mesh_vertex_quantized *Quantized = (mesh_vertex_quantized*)Out.data();
+            for (size_t VertexIndex = 0; VertexIndex < Vertices.size(); VertexIndex++)
+            {
+                for (int Axis = 0; Axis < 3; Axis++)
+                {
+                    float Normalized = PositionScale[Axis] > 0.0f ? (Vertices[VertexIndex].Position.Elements[Axis] - PositionOffset[Axis]) / PositionScale[Axis] : 0.0f;
+                    Quantized[VertexIndex].Position[Axis] = (uint16_t)std::lround(std::clamp(Normalized, 0.0f, 1.0f) * 65535.0f);
+                }
+                Quantized[VertexIndex].Position[3] = 0;
+                VertexEncodeOctahedral(Vertices[VertexIndex].Normal, Quantized[VertexIndex].Normal);
+                Quantized[VertexIndex].UV[0] = VertexEncodeHalf(Vertices[VertexIndex].UV.X);
+                Quantized[VertexIndex].UV[1] = VertexEncodeHalf(Vertices[VertexIndex].UV.Y);
+            }
+            break;
+        }
+        default:
+            break;
+    }
+}
@@ -0,0 +1,21 @@
+/**
+ *  Author: Amélie Heinrich
+ *  Company: Amélie Games
+ *  License: MIT
+ *  Create Time: 17/10/2026 17:45
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "renderer/mesh.hpp"
+
+uint32_t VertexEncodeStride(mesh_vertex_format Format);
+uint16_t VertexEncodeHalf(float Value);
+void VertexEncodeOctahedral(V3 Normal, int16_t Out[2]);
+
+// NOTE(amelie.h): Writes Vertices in the given layout. PositionOffset/PositionScale receive the dequantization
+// transform (zero and one unless the format quantizes positions).
+void VertexEncode(std::vector<uint8_t>& Out, const std::vector<mesh_vertex>& Vertices, mesh_vertex_format Format, float PositionOffset[3], float PositionScale[3]);
@@ -23,3 +23,31 @@ target("egs_compiler")
     if is_plat("windows") then
         add_syslinks("d3dcompiler")
     end
+
+target("asset_cooker")
+    set_languages("c11", "c++20")
+    set_rundir("$(projectdir)")
+    add_deps("stb")
+    add_files("asset_cooker/*.cpp")
+    add_files("../src/timer.cpp", "../src/renderer/cpu_image.cpp", "../src/renderer/meshlet.cpp", "../src/systems/file_system.cpp", "../src/systems/hash_system.cpp")
+    add_includedirs("../src", "../external")
+
+    if is_mode("debug") then
+        set_symbols("debug")
+        set_optimize("none")
+    end
+
+    if is_mode("release") then
+        set_symbols("hidden")
+        set_optimize("fastest")
+        set_strip("all")
+    end
+
+    if is_plat("windows") then
+        add_linkdirs("../bin/")
+        add_syslinks("kernel32", "assimp-vc143-mtd")
+        add_files("../src/systems/windows/windows_file_system.cpp", "../src/systems/windows/windows_time_system.cpp")
+    elseif is_plat("linux") then
+        add_syslinks("assimp")
+        add_files("../src/systems/linux/linux_file_system.cpp", "../src/systems/linux/linux_time_system.cpp")
+    end
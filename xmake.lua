@@ -11,12 +11,14 @@ includes("external", "tools")
 
 option("rhi")
     set_default("d3d12")
+    set_values("d3d12", "vulkan", "null")
+    set_description("Render hardware interface to build the game against")
 
 target("Game")
     set_languages("c11", "c++20")
     set_rundir(".")
     add_deps("ImGui", "dr_libs", "stb")
-    add_files("src/*.cpp", "src/cameras/*.cpp", "src/gui/*.cpp", "src/renderer/*.cpp", "src/renderer/passes/*.cpp", "src/scene/*.cpp", "src/systems/*.cpp")
+    add_files("src/*.cpp", "src/cameras/*.cpp", "src/gpu/*.cpp", "src/gui/*.cpp", "src/renderer/*.cpp", "src/renderer/passes/*.cpp", "src/scene/*.cpp", "src/systems/*.cpp")
     add_headerfiles("src/**.hpp")
     add_includedirs("src", "external", { public = true })
     add_linkdirs("bin/")
@@ -41,13 +43,18 @@ target("Game")
         add_linkdirs(os.getenv("VULKAN_SDK") .. "/Lib")
         add_syslinks("vulkan-1")
         add_files("src/gpu/vulkan/*.cpp", "src/gui/vulkan/*.cpp")
+    elseif get_config("rhi") == "null" then
+        add_files("src/gpu/null/*.cpp", "src/gui/null/*.cpp")
     end
 
     if is_plat("windows") then
-        add_syslinks("user32", "dsound", "gdi32", "kernel32", "assimp-vc143-mtd")
+        add_syslinks("user32", "dsound", "gdi32", "kernel32")
         add_files("src/apu/dsound/*.cpp", "src/systems/windows/*.cpp", "src/windows/*.cpp")
         add_files("src/main_win32.cpp")
+    elseif is_plat("linux") then
+        add_syslinks("pthread", "dl")
+        add_files("src/apu/null/*.cpp", "src/systems/linux/*.cpp", "src/linux/*.cpp")
+        add_files("src/main_linux.cpp")
     end
     -- TODO(amelie.h): MacOS
-    -- TODO(amelie.h): Linux
     -- TODO(amelie.h): Nintendo Switch? :flushed: